@@ -38,7 +38,7 @@ std::size_t VerifySyncCommitteeSignature(
     }
 
     /* VALIDATE PUBKEYS AGAINST SYNC COMMITTEE ROOT */
-    component computeSyncCommitteeRoot = PoseidonG1Array(SYNC_COMMITTEE_SIZE, N, K);
+    component computeSyncCommitteeRoot = PoseidonG1Commitment(SYNC_COMMITTEE_SIZE, N, K);
     for (int i = 0; i < SYNC_COMMITTEE_SIZE; i++) {
         for (std::size_t j = 0; j < K; j++) {
             computeSyncCommitteeRoot.pubkeys[i][0][j] = pubkeys[i][0][j];
@@ -1,3 +1,6 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_HASH_TO_FIELD_HPP
+#define ETHEREUM_CONSENSUS_PROOF_HASH_TO_FIELD_HPP
+
 #include <array>
 
 #include <ethereum/consensus_proof/constants.hpp>
@@ -36,6 +39,78 @@ std::array<std::size_t, l> I2OSP(std::size_t in) {
     return acc;
 }
 
+/*
+ * SHA-256 of PREFIX_BLOCKS constant blocks, then the signal bytes in, then
+ * the constant bytes tail. The compression starts from midstate, the state
+ * after the prefix, which costs nothing; the padding counts the prefix in
+ * the message length. tail and the padding are bits known at compile time,
+ * so a block made only of them has a constant message schedule and those
+ * constraints fold away.
+ */
+template<std::size_t PREFIX_BLOCKS, std::size_t INPUT_LEN, std::size_t TAIL_LEN>
+std::array<std::size_t, 32> Sha256BytesFolded(const std::array<std::size_t, 8> &midstate,
+                                              const std::array<std::size_t, INPUT_LEN> &in,
+                                              const std::array<std::size_t, TAIL_LEN> &tail) {
+    std::size_t MSG_LEN = INPUT_LEN + TAIL_LEN;
+    std::size_t TOTAL_BITS = 8 * (64 * PREFIX_BLOCKS + MSG_LEN);
+    std::size_t NUM_BLOCKS = (8 * MSG_LEN + 1 + 64 + 511) / 512;
+    std::array<std::size_t, 32> out;
+
+    // message bits, most significant first, followed by 1 || 0* || be64(TOTAL_BITS)
+    std::array<std::size_t, NUM_BLOCKS * 512> paddedIn;
+    component bytesToBits[INPUT_LEN];
+    for (int i = 0; i < INPUT_LEN; i++) {
+        bytesToBits[i] = Num2Bits(8);
+        bytesToBits[i].in = in[i];
+        for (int j = 0; j < 8; j++) {
+            paddedIn[8 * i + j] = bytesToBits[i].out[7 - j];
+        }
+    }
+    for (int i = 0; i < TAIL_LEN; i++) {
+        for (int j = 0; j < 8; j++) {
+            paddedIn[8 * (INPUT_LEN + i) + j] = (tail[i] >> (7 - j)) & 1;
+        }
+    }
+    for (int i = 8 * MSG_LEN; i < NUM_BLOCKS * 512 - 64; i++) {
+        paddedIn[i] = (i == 8 * MSG_LEN) ? 1 : 0;
+    }
+    for (int i = 0; i < 64; i++) {
+        paddedIn[NUM_BLOCKS * 512 - 1 - i] = (TOTAL_BITS >> i) & 1;
+    }
+
+    component compression[NUM_BLOCKS];
+    for (int b = 0; b < NUM_BLOCKS; b++) {
+        compression[b] = Sha256compression();
+        for (int k = 0; k < 256; k++) {
+            if (b == 0) {
+                compression[b].hin[k] = (midstate[k / 32] >> (31 - k % 32)) & 1;
+            } else {
+                compression[b].hin[k] = compression[b - 1].out[k];
+            }
+        }
+        for (int k = 0; k < 512; k++) {
+            compression[b].inp[k] = paddedIn[b * 512 + k];
+        }
+    }
+
+    component bitsToBytes[32];
+    for (int i = 0; i < 32; i++) {
+        bitsToBytes[i] = Bits2Num(8);
+        for (int j = 0; j < 8; j++) {
+            bitsToBytes[i].in[j] = compression[NUM_BLOCKS - 1].out[8 * i + 7 - j];
+        }
+        out[i] = bitsToBytes[i].out;
+    }
+
+    return out;
+}
+
+/*
+ * dst must be a compile-time constant (DOMAIN_SEPERATOR_TAG): together with
+ * the lengths and block indices it forms the constant tails of the hashes,
+ * and the all-zero Z_pad block of b_0 is replaced by its midstate, saving
+ * one compression.
+ */
 template<std::size_t MSG_LEN, std::size_t DST_LEN, std::size_t EXPANDED_LEN>
 std::array<std::size_t, EXPANDED_LEN> ExpandMessageXMD(const std::array<std::size_t, MSG_LEN> &msg,
                                                        const std::array<std::size_t, DST_LEN> &dst) {
@@ -52,67 +127,39 @@ std::array<std::size_t, EXPANDED_LEN> ExpandMessageXMD(const std::array<std::siz
     }
     dstPrime[DST_LEN] = i2ospDst[0];
 
-    std::array<std::size_t, 2> i2ospLibStr = I2OSP<2>(EXPANDED_LEN);
-
-    // b_0 = sha256(Z_pad || msg || l_i_b_str || i2osp(0, 1) || DST_prime)
-    std::size_t S256_0_INPUT_BYTE_LEN = R_IN_BYTES + MSG_LEN + 2 + 1 + DST_LEN + 1;
-    component sha0 = Sha256Bytes(S256_0_INPUT_BYTE_LEN);
-    for (int i = 0; i < S256_0_INPUT_BYTE_LEN; i++) {
-        if (i < R_IN_BYTES) {
-            sha0.in[i] = 0;
-        } else if (i < R_IN_BYTES + MSG_LEN) {
-            sha0.in[i] = msg[i - R_IN_BYTES];
-        } else if (i < R_IN_BYTES + MSG_LEN + 2) {
-            sha0.in[i] = i2ospLibStr.out[i - R_IN_BYTES - MSG_LEN];
-        } else if (i < R_IN_BYTES + MSG_LEN + 2 + 1) {
-            sha0.in[i] = 0;
+    // b_0 = sha256(Z_pad || msg || l_i_b_str || i2osp(0, 1) || DST_prime), from the midstate of Z_pad
+    std::array<std::size_t, 2 + 1 + DST_LEN + 1> sha0Tail;
+    for (int i = 0; i < 2 + 1 + DST_LEN + 1; i++) {
+        if (i < 2) {
+            sha0Tail[i] = (EXPANDED_LEN >> (8 * (1 - i))) & 255;
+        } else if (i < 2 + 1) {
+            sha0Tail[i] = 0;
         } else {
-            sha0.in[i] = dstPrime[i - R_IN_BYTES - MSG_LEN - 2 - 1];
+            sha0Tail[i] = dstPrime[i - 2 - 1];
         }
     }
-
-    // b[0] = sha256(s256_0.out || i2osp(1, 1) || dst_prime)
-    component s256s[ELL];
-    std::size_t S256S_0_INPUT_BYTE_LEN = B_IN_BYTES + 1 + DST_LEN + 1;
-    s256s[0] = Sha256Bytes(S256S_0_INPUT_BYTE_LEN);
-    for (int i = 0; i < S256S_0_INPUT_BYTE_LEN; i++) {
-        if (i < B_IN_BYTES) {
-            s256s[0].in[i] = sha0.out[i];
-        } else if (i < B_IN_BYTES + 1) {
-            s256s[0].in[i] = 1;
-        } else {
-            s256s[0].in[i] = dstPrime[i - B_IN_BYTES - 1];
-        }
+    std::array<std::size_t, 32> sha0 = Sha256BytesFolded<R_IN_BYTES / 64, MSG_LEN, 2 + 1 + DST_LEN + 1>(
+        SHA256_ZERO_BLOCK_MIDSTATE, msg, sha0Tail);
+
+    // b[i] = sha256(b_0 XOR b[i - 1] || i2osp(i + 1, 1) || dst_prime), b[0] = sha256(b_0 || i2osp(1, 1) || dst_prime)
+    std::array<std::array<std::size_t, 32>, ELL> s256s;
+    std::array<std::size_t, 32> s256sIn;
+    std::array<std::size_t, 1 + DST_LEN + 1> s256sTail;
+    for (int i = 0; i < DST_LEN + 1; i++) {
+        s256sTail[1 + i] = dstPrime[i];
     }
-
-    // sha256(b[0] XOR b[i-1] || i2osp(i+1, 1) || dst_prime)
-    component arrayXOR[ELL - 1];
-    component i2ospIndex[ELL - 1];
-    for (std::size_t i = 1; i < ELL; i++) {
-        arrayXOR[i - 1] = ByteArrayXOR(B_IN_BYTES);
-        for (std::size_t j = 0; j < B_IN_BYTES; j++) {
-            arrayXOR[i - 1].a[j] = sha0.out[j];
-            arrayXOR[i - 1].b[j] = s256s[i - 1].out[j];
-        }
-
-        i2ospIndex[i - 1] = I2OSP(1);
-        i2ospIndex[i - 1].in = i + 1;
-
-        std::size_t S256S_INPUT_BYTE_LEN = S256S_0_INPUT_BYTE_LEN;
-        s256s[i] = Sha256Bytes(S256S_INPUT_BYTE_LEN);
-        for (std::size_t j = 0; j < S256S_INPUT_BYTE_LEN; j++) {
-            if (j < B_IN_BYTES) {
-                s256s[i].in[j] = arrayXOR[i - 1].out[j];
-            } else if (j < B_IN_BYTES + 1) {
-                s256s[i].in[j] = i2ospIndex[i - 1].out[j - B_IN_BYTES];
-            } else {
-                s256s[i].in[j] = dstPrime[j - B_IN_BYTES - 1];
-            }
+    for (std::size_t i = 0; i < ELL; i++) {
+        if (i == 0) {
+            s256sIn = sha0;
+        } else {
+            s256sIn = ByteArrayXOR<B_IN_BYTES>(sha0, s256s[i - 1]);
         }
+        s256sTail[0] = i + 1;
+        s256s[i] = Sha256BytesFolded<0, B_IN_BYTES, 1 + DST_LEN + 1>(SHA256_IV, s256sIn, s256sTail);
     }
 
     for (int i = 0; i < EXPANDED_LEN; i++) {
-        out[i] = s256s[i / B_IN_BYTES].out[i % B_IN_BYTES];
+        out[i] = s256s[i / B_IN_BYTES][i % B_IN_BYTES];
     }
 }
 
@@ -263,4 +310,6 @@ std::array<std::size_t, n> ByteArrayXOR(const std::array<std::size_t, n> &a, con
     }
 
     return out;
-}
\ No newline at end of file
+}
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_HASH_TO_FIELD_HPP
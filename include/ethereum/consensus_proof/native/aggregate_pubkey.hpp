@@ -0,0 +1,282 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_AGGREGATE_PUBKEY_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_AGGREGATE_PUBKEY_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/bls.hpp>
+#include <ethereum/consensus_proof/native/lru_cache.hpp>
+#include <ethereum/consensus_proof/native/thread_pool.hpp>
+
+/*
+ * Per sync committee precomputation for the aggregate public key. The
+ * G1AddMany tree is evaluated once with every bit set; that full tree is a
+ * segment tree of partial sums in exactly the circuit's semantics. For a
+ * given aggregationBits only the ancestors of the cleared bits differ from
+ * it, so with high participation an update recomputes a few dozen nodes
+ * instead of 511, and the resulting trace is still the exact G1AddMany
+ * witness. When only the aggregate is needed, it is the precomputed total
+ * minus the sum of the missing keys.
+ *
+ * incremental_aggregate carries the result from one slot to the next for
+ * the "follow head" mode: consecutive Step updates of a period differ in a
+ * handful of bits, so only the flipped keys are added or subtracted.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    // Sum of points in the group law (points flagged as infinity are skipped),
+    // reduced as a padded binary tree so it costs one inversion per level
+    inline g1_point g1_sum(const std::vector<g1_point> &points, thread_pool *pool = nullptr) {
+        std::size_t size = 2;
+        while (size < points.size()) {
+            size *= 2;
+        }
+        std::vector<g1_point> level(size, g1_point::point_at_infinity());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            level[i] = points[i];
+        }
+        while (level.size() > 1) {
+            level = g1_reduce_batched(level, pool);
+        }
+        return level[0].infinity ? g1_point::point_at_infinity() : level[0];
+    }
+
+    class committee_aggregate {
+    public:
+        explicit committee_aggregate(const std::vector<g1_point> &pubkeys, thread_pool *pool = nullptr) :
+            pubkeys(pubkeys) {
+            g1_add_many_batched(pubkeys, std::vector<bool>(pubkeys.size(), true), pool, &full);
+        }
+
+        // Restores a precomputation saved from full_trace(), e.g. by committee_index; only the
+        // shape of the tree and its leaves are checked, the inner nodes are taken as given
+        committee_aggregate(const std::vector<g1_point> &pubkeys, g1_add_many_trace full_trace) :
+            pubkeys(pubkeys), full(std::move(full_trace)) {
+            std::size_t width = pubkeys.size();
+            bool valid = !full.levels.empty() && full.levels[0].size() == width;
+            for (std::size_t level = 0; valid && level < full.levels.size(); level++, width /= 2) {
+                valid = full.levels[level].size() == width && width > 0;
+            }
+            valid = valid && width == 0 && full.levels.back().size() == 1;
+            for (std::size_t i = 0; valid && i < pubkeys.size(); i++) {
+                valid = full.levels[0][i].x == pubkeys[i].x && full.levels[0][i].y == pubkeys[i].y &&
+                        !full.levels[0][i].infinity;
+            }
+            if (!valid) {
+                throw std::invalid_argument("committee_aggregate: saved tree does not match the pubkeys");
+            }
+        }
+
+        std::size_t size() const {
+            return pubkeys.size();
+        }
+
+        const std::vector<g1_point> &keys() const {
+            return pubkeys;
+        }
+
+        // aggregate of the whole committee (the root of the all-ones tree)
+        const g1_point &total() const {
+            return full.levels.back()[0];
+        }
+
+        // G1AddMany tree with every bit set
+        const g1_add_many_trace &full_trace() const {
+            return full;
+        }
+
+        // Aggregate of the keys whose bit is set: the total minus the missing keys, or
+        // the direct sum when fewer than half of the bits are set
+        g1_point aggregate(const std::vector<bool> &bits, thread_pool *pool = nullptr) const {
+            check_bits(bits);
+            std::vector<g1_point> present, missing;
+            for (std::size_t i = 0; i < bits.size(); i++) {
+                (bits[i] ? present : missing).push_back(pubkeys[i]);
+            }
+            if (missing.size() > present.size()) {
+                return g1_sum(present, pool);
+            }
+            return sub(total(), g1_sum(missing, pool), fp::zero());
+        }
+
+        // Exact G1AddMany result and trace for bits, recomputing only the ancestors of cleared bits
+        g1_point aggregate(const std::vector<bool> &bits, g1_add_many_trace &trace,
+                           thread_pool *pool = nullptr) const {
+            check_bits(bits);
+            std::vector<std::size_t> dirty;
+            for (std::size_t i = 0; i < bits.size(); i++) {
+                if (!bits[i]) {
+                    dirty.push_back(i);
+                }
+            }
+            if (2 * dirty.size() > bits.size()) {
+                return g1_add_many_batched(pubkeys, bits, pool, &trace);
+            }
+            return update_trace(full, bits, dirty, trace, pool);
+        }
+
+        // Recomputes the nodes of base above the leaves in changed, whose bits now read bits
+        static g1_point update_trace(const g1_add_many_trace &base, const std::vector<bool> &bits,
+                                     std::vector<std::size_t> changed, g1_add_many_trace &trace,
+                                     thread_pool *pool = nullptr) {
+            if (&trace != &base) {
+                trace = base;
+            }
+            for (std::size_t i : changed) {
+                trace.levels[0][i].infinity = !bits[i];
+            }
+            for (std::size_t level = 1; level < trace.levels.size(); level++) {
+                std::vector<std::size_t> parents;
+                for (std::size_t i : changed) {
+                    if (parents.empty() || parents.back() != i / 2) {
+                        parents.push_back(i / 2);
+                    }
+                }
+                g1_add_pairs_batched(trace.levels[level - 1], parents, trace.levels[level], pool);
+                changed.swap(parents);
+            }
+            return trace.levels.back()[0];
+        }
+
+    private:
+        void check_bits(const std::vector<bool> &bits) const {
+            if (bits.size() != pubkeys.size()) {
+                throw std::invalid_argument("committee_aggregate: bitfield size does not match the committee");
+            }
+        }
+
+        std::vector<g1_point> pubkeys;
+        g1_add_many_trace full;
+    };
+
+    // Aggregate pubkey that follows a sequence of bitfields over one committee. With
+    // keep_trace the G1AddMany trace is maintained as well (the ancestors of every flipped
+    // bit are recomputed), otherwise only the group-law aggregate is, by adding the newly
+    // set keys and subtracting the newly cleared ones. More than max_delta flips, or the
+    // first update, start over from the committee precomputation.
+    class incremental_aggregate {
+    public:
+        explicit incremental_aggregate(std::shared_ptr<const committee_aggregate> committee,
+                                       std::size_t max_delta = 32, bool keep_trace = true) :
+            committee(std::move(committee)),
+            max_delta(max_delta), keep_trace(keep_trace), valid(false) {
+            if (this->committee == nullptr) {
+                throw std::invalid_argument("incremental_aggregate: committee must not be null");
+            }
+        }
+
+        const committee_aggregate &base() const {
+            return *committee;
+        }
+
+        std::size_t threshold() const {
+            return max_delta;
+        }
+
+        void set_threshold(std::size_t value) {
+            max_delta = value;
+        }
+
+        // forgets the previous bitfield, the next update is a full recomputation
+        void reset() {
+            valid = false;
+        }
+
+        bool has_state() const {
+            return valid;
+        }
+
+        // bitfield, aggregate and (with keep_trace) trace of the last update
+        const std::vector<bool> &bits() const {
+            return last_bits;
+        }
+
+        const g1_point &aggregate() const {
+            return last;
+        }
+
+        const g1_add_many_trace &trace() const {
+            if (!keep_trace) {
+                throw std::logic_error("incremental_aggregate: trace is not kept");
+            }
+            return last_trace;
+        }
+
+        // Moves to bits and returns the new aggregate. Without keep_trace the point at
+        // infinity is returned with the infinity flag set and zero coordinates.
+        const g1_point &update(const std::vector<bool> &bits, thread_pool *pool = nullptr) {
+            if (bits.size() != committee->size()) {
+                throw std::invalid_argument("incremental_aggregate: bitfield size does not match the committee");
+            }
+
+            std::vector<std::size_t> flipped;
+            if (valid) {
+                for (std::size_t i = 0; i < bits.size() && flipped.size() <= max_delta; i++) {
+                    if (bits[i] != last_bits[i]) {
+                        flipped.push_back(i);
+                    }
+                }
+            }
+
+            if (!valid || flipped.size() > max_delta) {
+                if (keep_trace) {
+                    last = committee->aggregate(bits, last_trace, pool);
+                } else {
+                    last = committee->aggregate(bits, pool);
+                }
+            } else if (keep_trace) {
+                last = committee_aggregate::update_trace(last_trace, bits, flipped, last_trace, pool);
+            } else if (!flipped.empty()) {
+                std::vector<g1_point> delta;
+                delta.reserve(flipped.size() + 1);
+                delta.push_back(last);
+                for (std::size_t i : flipped) {
+                    delta.push_back(bits[i] ? committee->keys()[i] : negate(committee->keys()[i]));
+                }
+                last = g1_sum(delta, pool);
+            }
+
+            last_bits = bits;
+            valid = true;
+            return last;
+        }
+
+    private:
+        std::shared_ptr<const committee_aggregate> committee;
+        std::size_t max_delta;
+        bool keep_trace;
+        bool valid;
+
+        std::vector<bool> last_bits;
+        g1_point last;
+        g1_add_many_trace last_trace;
+    };
+
+    // committee_aggregate instances keyed by syncCommitteePoseidon, shared between the
+    // Step updates of a period. Only the most recent capacity committees are kept.
+    class committee_aggregate_cache {
+    public:
+        explicit committee_aggregate_cache(std::size_t capacity = 2) : cache(capacity) {
+        }
+
+        std::shared_ptr<const committee_aggregate> get(const bytes32 &sync_committee_poseidon,
+                                                       const std::vector<g1_point> &pubkeys,
+                                                       thread_pool *pool = nullptr) {
+            return cache.get(sync_committee_poseidon,
+                             [&] { return std::make_shared<const committee_aggregate>(pubkeys, pool); });
+        }
+
+    private:
+        lru_cache<bytes32, committee_aggregate, bytes32_hash> cache;
+    };
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_AGGREGATE_PUBKEY_HPP
@@ -0,0 +1,177 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_BATCH_VERIFY_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_BATCH_VERIFY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/fp12.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/pairing.hpp>
+#include <ethereum/consensus_proof/native/thread_pool.hpp>
+
+/*
+ * Batch form of core_verify_pubkey_g1 for catching up on many light client
+ * updates. With random 64-bit scalars r_i the N checks
+ *     e(g1, sig_i) * e(pk_i, -H_i) == 1
+ * are folded into the single one
+ *     e(g1, -sum r_i sig_i) * prod e(r_i pk_i, H_i) == 1,
+ * i.e. N + 1 Miller loops sharing their squarings and one final
+ * exponentiation. Every pubkey and signature is first checked to lie in
+ * G1 / G2, as the circuit does: the folding argument only holds in the
+ * prime order subgroups, and there an invalid item passes with probability
+ * at most 1 / (2^64 - 1) over the choice of its non-zero r_i.
+ * When the batch fails, bisection finds the failing items.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    struct bls_verify_item {
+        g1_point pubkey;
+        g2_point signature;
+        g2_point hm;
+    };
+
+    // Source of the batching scalars, seeded from std::random_device so the scalars cannot
+    // be anticipated by whoever produced the signatures
+    using batch_scalar_generator = std::mt19937_64;
+
+    inline batch_scalar_generator make_batch_scalar_generator() {
+        std::random_device device;
+        std::seed_seq seed {device(), device(), device(), device(), device(), device(), device(), device()};
+        return batch_scalar_generator(seed);
+    }
+
+    // The folded check over items[indices[0]], items[indices[1]], ... An item whose pubkey is not
+    // in G1 or whose signature is not in G2 fails the batch, as SubgroupCheckG1 / SubgroupCheckG2
+    // fail CoreVerifyPubkeyG1.
+    inline bool batch_verify_pubkey_g1(const std::vector<bls_verify_item> &items,
+                                       const std::vector<std::size_t> &indices, batch_scalar_generator &rng,
+                                       thread_pool *pool = nullptr) {
+        std::size_t n = indices.size();
+        if (n == 0) {
+            return true;
+        }
+
+        std::vector<std::uint64_t> scalars(n);
+        for (std::uint64_t &r : scalars) {
+            do {
+                r = rng();
+            } while (r == 0);
+        }
+
+        std::vector<jacobian_point<fp>> pubkeys(n);
+        std::vector<jacobian_point<fp2>> signatures(n);
+        std::vector<std::uint8_t> in_subgroup(n);
+        auto scale = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; j++) {
+                const bls_verify_item &item = items[indices[j]];
+                in_subgroup[j] = g1_in_subgroup(item.pubkey) && g2_in_subgroup(item.signature);
+                pubkeys[j] = scalar_mul_jacobian(item.pubkey, scalars[j]);
+                signatures[j] = scalar_mul_jacobian(item.signature, scalars[j]);
+            }
+        };
+        if (pool != nullptr) {
+            pool->parallel_for(n, 1, scale);
+        } else {
+            scale(0, n);
+        }
+        if (std::find(in_subgroup.begin(), in_subgroup.end(), 0) != in_subgroup.end()) {
+            return false;
+        }
+
+        jacobian_point<fp2> signature_sum = jacobian_point<fp2>::point_at_infinity();
+        for (const jacobian_point<fp2> &s : signatures) {
+            signature_sum = add(signature_sum, s);
+        }
+
+        // pairs with a point at infinity contribute 1 and are left out
+        std::vector<g2_point> p;
+        std::vector<g1_line_point> q;
+        std::vector<g1_point> scaled = batch_to_affine(pubkeys);
+        for (std::size_t j = 0; j < n; j++) {
+            const g2_point &hm = items[indices[j]].hm;
+            if (!scaled[j].infinity && !hm.infinity) {
+                p.push_back(hm);
+                q.push_back(prepare_line_point(scaled[j]));
+            }
+        }
+        if (!signature_sum.is_infinity()) {
+            p.push_back(negate(to_affine(signature_sum)));
+            q.push_back(g1_generator_line_point());
+        }
+        if (p.empty()) {
+            return true;
+        }
+
+        std::size_t chunks = 1;
+        if (pool != nullptr) {
+            chunks = std::min(pool->size(), p.size());
+        }
+        std::size_t chunk_size = (p.size() + chunks - 1) / chunks;
+        std::vector<fp12> partial(chunks, fp12::one());
+        auto miller = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; c++) {
+                std::size_t first = std::min(p.size(), c * chunk_size);
+                std::size_t last = std::min(p.size(), first + chunk_size);
+                partial[c] = miller_loop_product({p.begin() + first, p.begin() + last},
+                                                 {q.begin() + first, q.begin() + last});
+            }
+        };
+        if (pool != nullptr && chunks > 1) {
+            pool->parallel_for(chunks, 1, miller);
+        } else {
+            miller(0, chunks);
+        }
+
+        fp12 f = fp12::one();
+        for (const fp12 &g : partial) {
+            f *= g;
+        }
+        return final_exponentiate(f).is_one();
+    }
+
+    inline bool batch_verify_pubkey_g1(const std::vector<bls_verify_item> &items, thread_pool *pool = nullptr) {
+        std::vector<std::size_t> indices(items.size());
+        for (std::size_t i = 0; i < indices.size(); i++) {
+            indices[i] = i;
+        }
+        batch_scalar_generator rng = make_batch_scalar_generator();
+        return batch_verify_pubkey_g1(items, indices, rng, pool);
+    }
+
+    // Indices of the items that do not verify, in increasing order. A failing batch is
+    // split in halves, each checked again with fresh scalars, down to single items.
+    inline std::vector<std::size_t> batch_find_invalid(const std::vector<bls_verify_item> &items,
+                                                       thread_pool *pool = nullptr) {
+        std::vector<std::size_t> invalid;
+        batch_scalar_generator rng = make_batch_scalar_generator();
+
+        std::vector<std::vector<std::size_t>> pending(1, std::vector<std::size_t>(items.size()));
+        for (std::size_t i = 0; i < items.size(); i++) {
+            pending[0][i] = i;
+        }
+        while (!pending.empty()) {
+            std::vector<std::size_t> indices = std::move(pending.back());
+            pending.pop_back();
+            if (batch_verify_pubkey_g1(items, indices, rng, pool)) {
+                continue;
+            }
+            if (indices.size() == 1) {
+                invalid.push_back(indices[0]);
+                continue;
+            }
+            std::size_t half = indices.size() / 2;
+            // right half first so the left one is popped next and indices come out sorted
+            pending.emplace_back(indices.begin() + half, indices.end());
+            pending.emplace_back(indices.begin(), indices.begin() + half);
+        }
+        return invalid;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_BATCH_VERIFY_HPP
@@ -0,0 +1,202 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_BLS_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_BLS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/thread_pool.hpp>
+
+/*
+ * Native G1AddMany: the same binary reduction tree as bls.hpp, level by
+ * level, reproducing EllipticCurveAdd exactly, including the dummy
+ * coordinates it outputs next to an infinity flag. Those coordinates are
+ * part of the witness, so a plain group-law aggregate is not enough.
+ *
+ * g1_add_many is the reference implementation with one inversion per
+ * addition; g1_add_many_batched computes the same tree with a single shared
+ * inversion per level (Montgomery's trick) and splits every level across a
+ * thread_pool.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    // EllipticCurveAdd with aIsInfinity / bIsInfinity carried in the infinity flags:
+    //  both infinite         -> (a, infinity)
+    //  only a infinite       -> b
+    //  only b infinite       -> a
+    //  a == -b               -> (a, infinity)
+    //  a == b                -> 2a
+    //  otherwise             -> a + b
+    inline g1_point g1_add_circuit(const g1_point &a, const g1_point &b) {
+        if (a.infinity && b.infinity) {
+            return {a.x, a.y, true};
+        }
+        if (a.infinity) {
+            return b;
+        }
+        if (b.infinity) {
+            return a;
+        }
+        if (a.x == b.x) {
+            if (a.y != b.y) {
+                return {a.x, a.y, true};
+            }
+            return dbl(a, fp::zero());
+        }
+        return add(a, b, fp::zero());
+    }
+
+    // levels[0] are the inputs (infinity = 1 - bit), levels[i] the output of reducers[i - 1]
+    struct g1_add_many_trace {
+        std::vector<std::vector<g1_point>> levels;
+    };
+
+    // G1AddMany over pubkeys.size() (a power of two) points; the result carries isPointAtInfinity
+    inline g1_point g1_add_many(const std::vector<g1_point> &pubkeys, const std::vector<bool> &bits,
+                                g1_add_many_trace *trace = nullptr) {
+        if (pubkeys.size() != bits.size() || pubkeys.size() < 2 || (pubkeys.size() & (pubkeys.size() - 1)) != 0) {
+            throw std::invalid_argument("g1_add_many: expected a power of two number of points and bits");
+        }
+        std::vector<g1_point> level(pubkeys.size());
+        for (std::size_t i = 0; i < pubkeys.size(); i++) {
+            level[i] = {pubkeys[i].x, pubkeys[i].y, !bits[i]};
+        }
+        if (trace != nullptr) {
+            trace->levels.assign(1, level);
+        }
+        while (level.size() > 1) {
+            std::vector<g1_point> next(level.size() / 2);
+            for (std::size_t i = 0; i < next.size(); i++) {
+                next[i] = g1_add_circuit(level[2 * i], level[2 * i + 1]);
+            }
+            level.swap(next);
+            if (trace != nullptr) {
+                trace->levels.push_back(level);
+            }
+        }
+        return level[0];
+    }
+
+    // Splitting of one tree level into chunks for g1_reduce_batched
+    constexpr static const std::size_t G1_REDUCE_GRAIN = 32;
+
+    // out[j] = g1_add_circuit(in[2j], in[2j + 1]) for every j in targets, with one field
+    // inversion overall. Chunks first record their running products of the slope
+    // denominators, the chunk totals are inverted together, then every chunk walks
+    // back over its prefix products to recover the individual inverses.
+    inline void g1_add_pairs_batched(const std::vector<g1_point> &in, const std::vector<std::size_t> &targets,
+                                     std::vector<g1_point> &out, thread_pool *pool = nullptr) {
+        enum class pair_kind : std::uint8_t { done, chord, tangent };
+
+        std::size_t n = targets.size();
+        std::vector<pair_kind> kind(n);
+        std::vector<fp> num(n), den(n), prefix(n);
+
+        std::size_t chunks = 1;
+        if (pool != nullptr) {
+            chunks = std::max<std::size_t>(1, std::min(pool->size(), n / G1_REDUCE_GRAIN));
+        }
+        std::size_t chunk_size = (n + chunks - 1) / chunks;
+        std::vector<fp> chunk_total(chunks);
+
+        auto for_each_chunk = [&](auto &&body) {
+            if (pool != nullptr && chunks > 1) {
+                pool->parallel_for(chunks, 1, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t c = begin; c < end; c++) {
+                        body(c, c * chunk_size, std::min(n, (c + 1) * chunk_size));
+                    }
+                });
+            } else {
+                for (std::size_t c = 0; c < chunks; c++) {
+                    body(c, c * chunk_size, std::min(n, (c + 1) * chunk_size));
+                }
+            }
+        };
+
+        for_each_chunk([&](std::size_t c, std::size_t begin, std::size_t end) {
+            fp acc = fp::one();
+            for (std::size_t i = begin; i < end; i++) {
+                const g1_point &a = in[2 * targets[i]];
+                const g1_point &b = in[2 * targets[i] + 1];
+                kind[i] = pair_kind::done;
+                if (a.infinity || b.infinity) {
+                    out[targets[i]] = g1_add_circuit(a, b);
+                } else if (a.x != b.x) {
+                    kind[i] = pair_kind::chord;
+                    num[i] = b.y - a.y;
+                    den[i] = b.x - a.x;
+                } else if (a.y != b.y || a.y.is_zero()) {
+                    out[targets[i]] = g1_add_circuit(a, b);
+                } else {
+                    kind[i] = pair_kind::tangent;
+                    fp x_sq = square(a.x);
+                    num[i] = dbl(x_sq) + x_sq;
+                    den[i] = dbl(a.y);
+                }
+                prefix[i] = acc;
+                if (kind[i] != pair_kind::done) {
+                    acc *= den[i];
+                }
+            }
+            chunk_total[c] = acc;
+        });
+
+        batch_inverse(chunk_total.data(), chunks);
+
+        for_each_chunk([&](std::size_t c, std::size_t begin, std::size_t end) {
+            fp acc_inv = chunk_total[c];
+            for (std::size_t i = end; i-- > begin;) {
+                if (kind[i] == pair_kind::done) {
+                    continue;
+                }
+                fp lambda = num[i] * acc_inv * prefix[i];
+                acc_inv *= den[i];
+                const g1_point &a = in[2 * targets[i]];
+                const g1_point &b = in[2 * targets[i] + 1];
+                fp x3 = square(lambda) - a.x - b.x;
+                out[targets[i]] = {x3, lambda * (a.x - x3) - a.y, false};
+            }
+        });
+    }
+
+    // One G1Reduce level: out[i] = g1_add_circuit(in[2i], in[2i + 1]) with one field inversion
+    inline std::vector<g1_point> g1_reduce_batched(const std::vector<g1_point> &in, thread_pool *pool = nullptr) {
+        std::vector<g1_point> out(in.size() / 2);
+        std::vector<std::size_t> targets(out.size());
+        for (std::size_t i = 0; i < targets.size(); i++) {
+            targets[i] = i;
+        }
+        g1_add_pairs_batched(in, targets, out, pool);
+        return out;
+    }
+
+    // Same result and trace as g1_add_many, one inversion per tree level
+    inline g1_point g1_add_many_batched(const std::vector<g1_point> &pubkeys, const std::vector<bool> &bits,
+                                        thread_pool *pool = nullptr, g1_add_many_trace *trace = nullptr) {
+        if (pubkeys.size() != bits.size() || pubkeys.size() < 2 || (pubkeys.size() & (pubkeys.size() - 1)) != 0) {
+            throw std::invalid_argument("g1_add_many_batched: expected a power of two number of points and bits");
+        }
+        std::vector<g1_point> level(pubkeys.size());
+        for (std::size_t i = 0; i < pubkeys.size(); i++) {
+            level[i] = {pubkeys[i].x, pubkeys[i].y, !bits[i]};
+        }
+        if (trace != nullptr) {
+            trace->levels.assign(1, level);
+        }
+        while (level.size() > 1) {
+            level = g1_reduce_batched(level, pool);
+            if (trace != nullptr) {
+                trace->levels.push_back(level);
+            }
+        }
+        return level[0];
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_BLS_HPP
@@ -0,0 +1,388 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_COMMITTEE_INDEX_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_COMMITTEE_INDEX_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fr.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/ssz.hpp>
+#include <ethereum/consensus_proof/native/pubkeys.hpp>
+#include <ethereum/consensus_proof/native/bls.hpp>
+#include <ethereum/consensus_proof/native/aggregate_pubkey.hpp>
+#include <ethereum/consensus_proof/native/poseidon.hpp>
+#include <ethereum/consensus_proof/native/thread_pool.hpp>
+
+/*
+ * Persistent index of the sync committees seen by Rotate: syncCommitteeSSZ
+ * -> syncCommitteePoseidon, the decompressed pubkeys and the all-ones
+ * G1AddMany tree of committee_aggregate (whose root is the aggregate). A
+ * restarted prover reads these back instead of redoing 512 decompressions,
+ * the Poseidon commitment and 511 additions per committee.
+ *
+ * The file is a 64-byte header followed by append-only records, each
+ * written with a single write and fsync'ed before it is indexed. A record
+ * carries its payload size and SHA-256, so a write torn by a crash is
+ * recognised on the next open and cut off; earlier records are never
+ * rewritten. The file is memory-mapped read-only and entries are decoded
+ * from the mapping. Field elements are stored as their Montgomery limbs,
+ * little-endian, which the header pins so a file is only read back by a
+ * build with the same representation. One process owns the file at a time
+ * (flock).
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    struct committee_index_entry {
+        bytes32 ssz_root;
+        // little-endian syncCommitteePoseidon, as carried by step_input
+        bytes32 poseidon_root;
+        std::vector<g1_point> pubkeys;
+        // committee_aggregate::full_trace()
+        g1_add_many_trace aggregate_tree;
+
+        const g1_point &aggregate_pubkey() const {
+            return aggregate_tree.levels.back()[0];
+        }
+
+        std::shared_ptr<const committee_aggregate> aggregate() const {
+            return std::make_shared<const committee_aggregate>(pubkeys, aggregate_tree);
+        }
+    };
+
+    // Everything an index entry holds, derived from the SSZ form of a committee
+    inline committee_index_entry make_committee_index_entry(const std::vector<g1_bytes_type> &pubkeys,
+                                                            const g1_bytes_type &aggregate_pubkey,
+                                                            thread_pool *pool = nullptr) {
+        committee_index_entry out;
+        out.ssz_root = ssz_sync_committee_root(pubkeys, aggregate_pubkey);
+        out.pubkeys = g1_decompress_many(pubkeys);
+        out.poseidon_root = sync_committee_poseidon(out.pubkeys, pool);
+        out.aggregate_tree = committee_aggregate(out.pubkeys, pool).full_trace();
+        return out;
+    }
+
+    class committee_index {
+    public:
+        // "CPCIDX" 0x00 0x01
+        constexpr static const std::uint64_t FILE_MAGIC = 0x0100584449435043;
+        // "CPCIREC" 0x01
+        constexpr static const std::uint64_t RECORD_MAGIC = 0x0143455249435043;
+        constexpr static const std::size_t HEADER_SIZE = 64;
+        // magic, payload size, SHA-256 of the payload, reserved
+        constexpr static const std::size_t RECORD_HEADER_SIZE = 64;
+        // x and y limbs and the infinity flag
+        constexpr static const std::size_t POINT_SIZE = 13 * 8;
+
+        // Opens path, creating it if needed, and drops a torn record left at its end
+        explicit committee_index(const std::string &path) {
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "committee_index: open " + path);
+            }
+            try {
+                if (::flock(fd, LOCK_EX | LOCK_NB) != 0) {
+                    throw std::system_error(errno, std::generic_category(), "committee_index: " + path + " is in use");
+                }
+                recover();
+            } catch (...) {
+                close();
+                throw;
+            }
+        }
+
+        committee_index(const committee_index &) = delete;
+        committee_index &operator=(const committee_index &) = delete;
+
+        ~committee_index() {
+            close();
+        }
+
+        std::size_t size() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return by_ssz_root.size();
+        }
+
+        bool contains(const bytes32 &ssz_root) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return by_ssz_root.count(ssz_root) != 0;
+        }
+
+        std::optional<committee_index_entry> find(const bytes32 &ssz_root) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = by_ssz_root.find(ssz_root);
+            if (it == by_ssz_root.end()) {
+                return std::nullopt;
+            }
+            return decode(it->second);
+        }
+
+        // the committee Step refers to by syncCommitteePoseidon
+        std::optional<committee_index_entry> find_by_poseidon(const bytes32 &poseidon_root) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = by_poseidon_root.find(poseidon_root);
+            if (it == by_poseidon_root.end()) {
+                return std::nullopt;
+            }
+            return decode(it->second);
+        }
+
+        // Appends entry unless its SSZ root is already indexed; the record is on disk when this returns
+        void append(const committee_index_entry &entry) {
+            std::size_t n = entry.pubkeys.size();
+            // same checks a reader applies through committee_aggregate
+            committee_aggregate(entry.pubkeys, entry.aggregate_tree);
+            std::vector<std::uint8_t> payload;
+            put_bytes(payload, entry.ssz_root);
+            put_bytes(payload, entry.poseidon_root);
+            put_u64(payload, n);
+            put_u64(payload, entry.aggregate_tree.levels.size());
+            for (const g1_point &p : entry.pubkeys) {
+                put_point(payload, p);
+            }
+            for (const std::vector<g1_point> &level : entry.aggregate_tree.levels) {
+                for (const g1_point &p : level) {
+                    put_point(payload, p);
+                }
+            }
+
+            std::vector<std::uint8_t> record;
+            record.reserve(RECORD_HEADER_SIZE + payload.size());
+            put_u64(record, RECORD_MAGIC);
+            put_u64(record, payload.size());
+            put_bytes(record, sha256(payload.data(), payload.size()));
+            record.resize(RECORD_HEADER_SIZE, 0);
+            record.insert(record.end(), payload.begin(), payload.end());
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (by_ssz_root.count(entry.ssz_root) != 0) {
+                return;
+            }
+            std::size_t offset = file_size;
+            write_all(record.data(), record.size(), offset);
+            sync();
+            file_size += record.size();
+            remap();
+            by_ssz_root[entry.ssz_root] = offset;
+            by_poseidon_root[entry.poseidon_root] = offset;
+        }
+
+    private:
+        static void put_u64(std::vector<std::uint8_t> &out, std::uint64_t v) {
+            for (std::size_t i = 0; i < 8; i++) {
+                out.push_back(std::uint8_t(v >> (8 * i)));
+            }
+        }
+
+        static void put_bytes(std::vector<std::uint8_t> &out, const bytes32 &v) {
+            out.insert(out.end(), v.begin(), v.end());
+        }
+
+        static void put_point(std::vector<std::uint8_t> &out, const g1_point &p) {
+            for (std::uint64_t limb : p.x.limbs) {
+                put_u64(out, limb);
+            }
+            for (std::uint64_t limb : p.y.limbs) {
+                put_u64(out, limb);
+            }
+            put_u64(out, p.infinity ? 1 : 0);
+        }
+
+        static std::uint64_t get_u64(const std::uint8_t *in) {
+            std::uint64_t v = 0;
+            for (std::size_t i = 0; i < 8; i++) {
+                v |= std::uint64_t(in[i]) << (8 * i);
+            }
+            return v;
+        }
+
+        static g1_point get_point(const std::uint8_t *in) {
+            g1_point p;
+            for (std::size_t i = 0; i < 6; i++) {
+                p.x.limbs[i] = get_u64(in + 8 * i);
+                p.y.limbs[i] = get_u64(in + 48 + 8 * i);
+            }
+            p.infinity = get_u64(in + 96) != 0;
+            return p;
+        }
+
+        std::vector<std::uint8_t> file_header() const {
+            std::vector<std::uint8_t> out;
+            put_u64(out, FILE_MAGIC);
+            // format version, then one in Montgomery form of both fields
+            put_u64(out, 1);
+            put_u64(out, FP_R[0]);
+            put_u64(out, FR_R[0]);
+            out.resize(HEADER_SIZE, 0);
+            return out;
+        }
+
+        // Validates the records from the start, truncating the file after the last complete one
+        void recover() {
+            struct stat st;
+            if (::fstat(fd, &st) != 0) {
+                throw std::system_error(errno, std::generic_category(), "committee_index: fstat");
+            }
+            file_size = std::size_t(st.st_size);
+            std::vector<std::uint8_t> header = file_header();
+            if (file_size < HEADER_SIZE) {
+                truncate(0);
+                write_all(header.data(), header.size(), 0);
+                sync();
+                file_size = HEADER_SIZE;
+            }
+            remap();
+            if (!std::equal(header.begin(), header.end(), data)) {
+                throw std::invalid_argument("committee_index: not an index file of this format");
+            }
+
+            std::size_t offset = HEADER_SIZE;
+            while (offset + RECORD_HEADER_SIZE <= file_size) {
+                const std::uint8_t *record = data + offset;
+                std::uint64_t payload_size = get_u64(record + 8);
+                if (get_u64(record) != RECORD_MAGIC || payload_size > file_size - offset - RECORD_HEADER_SIZE) {
+                    break;
+                }
+                const std::uint8_t *payload = record + RECORD_HEADER_SIZE;
+                if (!std::equal(record + 16, record + 48, sha256(payload, payload_size).begin()) ||
+                    !well_formed(payload, payload_size)) {
+                    break;
+                }
+                bytes32 ssz_root, poseidon_root;
+                std::copy(payload, payload + 32, ssz_root.begin());
+                std::copy(payload + 32, payload + 64, poseidon_root.begin());
+                by_ssz_root.emplace(ssz_root, offset);
+                by_poseidon_root.emplace(poseidon_root, offset);
+                offset += RECORD_HEADER_SIZE + payload_size;
+            }
+            if (offset != file_size) {
+                truncate(offset);
+                sync();
+                file_size = offset;
+                remap();
+            }
+        }
+
+        // the sizes a payload declares add up to its length
+        static bool well_formed(const std::uint8_t *payload, std::uint64_t size) {
+            if (size < 80) {
+                return false;
+            }
+            std::uint64_t n = get_u64(payload + 64), levels = get_u64(payload + 72);
+            if (n < 2 || (n & (n - 1)) != 0 || levels != std::uint64_t(std::countr_zero(n)) + 1) {
+                return false;
+            }
+            std::uint64_t points = n, width = n;
+            for (std::uint64_t level = 0; level < levels; level++, width /= 2) {
+                points += width;
+            }
+            return size == 80 + points * POINT_SIZE;
+        }
+
+        committee_index_entry decode(std::size_t offset) const {
+            const std::uint8_t *payload = data + offset + RECORD_HEADER_SIZE;
+            committee_index_entry out;
+            std::copy(payload, payload + 32, out.ssz_root.begin());
+            std::copy(payload + 32, payload + 64, out.poseidon_root.begin());
+            std::size_t n = get_u64(payload + 64), levels = get_u64(payload + 72);
+            const std::uint8_t *point = payload + 80;
+            out.pubkeys.resize(n);
+            for (g1_point &p : out.pubkeys) {
+                p = get_point(point);
+                point += POINT_SIZE;
+            }
+            out.aggregate_tree.levels.resize(levels);
+            for (std::size_t level = 0, width = n; level < levels; level++, width /= 2) {
+                out.aggregate_tree.levels[level].resize(width);
+                for (g1_point &p : out.aggregate_tree.levels[level]) {
+                    p = get_point(point);
+                    point += POINT_SIZE;
+                }
+            }
+            return out;
+        }
+
+        void write_all(const std::uint8_t *buffer, std::size_t size, std::size_t offset) {
+            while (size > 0) {
+                ssize_t written = ::pwrite(fd, buffer, size, off_t(offset));
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(), "committee_index: write");
+                }
+                buffer += written;
+                size -= std::size_t(written);
+                offset += std::size_t(written);
+            }
+        }
+
+        void sync() {
+            if (::fsync(fd) != 0) {
+                throw std::system_error(errno, std::generic_category(), "committee_index: fsync");
+            }
+        }
+
+        void truncate(std::size_t size) {
+            if (::ftruncate(fd, off_t(size)) != 0) {
+                throw std::system_error(errno, std::generic_category(), "committee_index: ftruncate");
+            }
+        }
+
+        void remap() {
+            if (data != nullptr) {
+                ::munmap(const_cast<std::uint8_t *>(data), mapped);
+                data = nullptr;
+            }
+            void *p = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                throw std::system_error(errno, std::generic_category(), "committee_index: mmap");
+            }
+            data = static_cast<const std::uint8_t *>(p);
+            mapped = file_size;
+        }
+
+        void close() {
+            if (data != nullptr) {
+                ::munmap(const_cast<std::uint8_t *>(data), mapped);
+                data = nullptr;
+            }
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+
+        int fd = -1;
+        const std::uint8_t *data = nullptr;
+        std::size_t mapped = 0;
+        std::size_t file_size = 0;
+        // record offsets
+        std::map<bytes32, std::size_t> by_ssz_root;
+        std::map<bytes32, std::size_t> by_poseidon_root;
+        mutable std::mutex mutex;
+    };
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_COMMITTEE_INDEX_HPP
@@ -0,0 +1,393 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_CURVE_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_CURVE_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/register_tables.hpp>
+
+/*
+ * Affine short Weierstrass points y^2 = x^3 + a x + b over Fp (G1) and Fp2
+ * (G2 and the isogenous curve E2' used by MapToG2). The point at infinity is
+ * an explicit flag, matching the aIsInfinity / isInfinity signals of
+ * EllipticCurveAdd in pairing/curve.hpp.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    template<typename Field>
+    struct affine_point {
+        Field x;
+        Field y;
+        bool infinity;
+
+        static affine_point point_at_infinity() {
+            return {Field::zero(), Field::zero(), true};
+        }
+
+        bool operator==(const affine_point &other) const {
+            if (infinity || other.infinity) {
+                return infinity == other.infinity;
+            }
+            return x == other.x && y == other.y;
+        }
+
+        bool operator!=(const affine_point &other) const {
+            return !(*this == other);
+        }
+    };
+
+    using g1_point = affine_point<fp>;
+    using g2_point = affine_point<fp2>;
+
+    template<typename Field>
+    affine_point<Field> negate(const affine_point<Field> &a) {
+        return {a.x, -a.y, a.infinity};
+    }
+
+    // y^2 == x^3 + a x + b
+    template<typename Field>
+    bool is_on_curve(const affine_point<Field> &p, const Field &a, const Field &b) {
+        if (p.infinity) {
+            return true;
+        }
+        return square(p.y) == (square(p.x) + a) * p.x + b;
+    }
+
+    // 2p with the tangent slope (3 x^2 + a) / 2y, EllipticCurveDouble
+    template<typename Field>
+    affine_point<Field> dbl(const affine_point<Field> &p, const Field &a) {
+        if (p.infinity || p.y.is_zero()) {
+            return affine_point<Field>::point_at_infinity();
+        }
+        Field x2 = square(p.x);
+        Field lambda = (dbl(x2) + x2 + a) * inverse(dbl(p.y));
+        Field x3 = square(lambda) - dbl(p.x);
+        return {x3, lambda * (p.x - x3) - p.y, false};
+    }
+
+    // Full group law, handling every degenerate case
+    template<typename Field>
+    affine_point<Field> add(const affine_point<Field> &p, const affine_point<Field> &q, const Field &a) {
+        if (p.infinity) {
+            return q;
+        }
+        if (q.infinity) {
+            return p;
+        }
+        if (p.x == q.x) {
+            return (p.y == q.y) ? dbl(p, a) : affine_point<Field>::point_at_infinity();
+        }
+        Field lambda = (q.y - p.y) * inverse(q.x - p.x);
+        Field x3 = square(lambda) - p.x - q.x;
+        return {x3, lambda * (p.x - x3) - p.y, false};
+    }
+
+    template<typename Field>
+    affine_point<Field> sub(const affine_point<Field> &p, const affine_point<Field> &q, const Field &a) {
+        return add(p, negate(q), a);
+    }
+
+    // [e] p by double and add, e a little-endian multi-limb scalar
+    template<typename Field, std::size_t L>
+    affine_point<Field> scalar_mul(const affine_point<Field> &p, const std::array<std::uint64_t, L> &e,
+                                   const Field &a) {
+        affine_point<Field> out = affine_point<Field>::point_at_infinity();
+        for (std::size_t i = L; i-- > 0;) {
+            for (std::size_t j = 64; j-- > 0;) {
+                out = dbl(out, a);
+                if ((e[i] >> j) & 1) {
+                    out = add(out, p, a);
+                }
+            }
+        }
+        return out;
+    }
+
+    template<typename Field>
+    affine_point<Field> scalar_mul(const affine_point<Field> &p, std::uint64_t e, const Field &a) {
+        return scalar_mul(p, std::array<std::uint64_t, 1> {e}, a);
+    }
+
+    // (X, Y, Z) standing for (X / Z^2, Y / Z^3), Z = 0 at infinity. Only used off-circuit
+    // where no intermediate point is part of a witness, to avoid an inversion per step.
+    template<typename Field>
+    struct jacobian_point {
+        Field x;
+        Field y;
+        Field z;
+
+        static jacobian_point point_at_infinity() {
+            return {Field::one(), Field::one(), Field::zero()};
+        }
+
+        static jacobian_point from_affine(const affine_point<Field> &p) {
+            return p.infinity ? point_at_infinity() : jacobian_point {p.x, p.y, Field::one()};
+        }
+
+        bool is_infinity() const {
+            return z.is_zero();
+        }
+    };
+
+    // 2p on a curve with a = 0 (dbl-2009-l)
+    template<typename Field>
+    jacobian_point<Field> dbl(const jacobian_point<Field> &p) {
+        if (p.is_infinity() || p.y.is_zero()) {
+            return jacobian_point<Field>::point_at_infinity();
+        }
+        Field a = square(p.x);
+        Field b = square(p.y);
+        Field c = square(b);
+        Field d = dbl(square(p.x + b) - a - c);
+        Field e = dbl(a) + a;
+        Field x3 = square(e) - dbl(d);
+        return {x3, e * (d - x3) - dbl(dbl(dbl(c))), dbl(p.y * p.z)};
+    }
+
+    // p + q on a curve with a = 0 (add-2007-bl)
+    template<typename Field>
+    jacobian_point<Field> add(const jacobian_point<Field> &p, const jacobian_point<Field> &q) {
+        if (p.is_infinity()) {
+            return q;
+        }
+        if (q.is_infinity()) {
+            return p;
+        }
+        Field z1z1 = square(p.z);
+        Field z2z2 = square(q.z);
+        Field u1 = p.x * z2z2;
+        Field u2 = q.x * z1z1;
+        Field s1 = p.y * q.z * z2z2;
+        Field s2 = q.y * p.z * z1z1;
+        Field h = u2 - u1;
+        Field r = dbl(s2 - s1);
+        if (h.is_zero()) {
+            return r.is_zero() ? dbl(p) : jacobian_point<Field>::point_at_infinity();
+        }
+        Field i = square(dbl(h));
+        Field j = h * i;
+        Field v = u1 * i;
+        Field x3 = square(r) - j - dbl(v);
+        return {x3, r * (v - x3) - dbl(s1 * j), (square(p.z + q.z) - z1z1 - z2z2) * h};
+    }
+
+    // 2p on a curve with any a (dbl-2007-bl)
+    template<typename Field>
+    jacobian_point<Field> dbl(const jacobian_point<Field> &p, const Field &a) {
+        if (p.is_infinity() || p.y.is_zero()) {
+            return jacobian_point<Field>::point_at_infinity();
+        }
+        Field xx = square(p.x);
+        Field yy = square(p.y);
+        Field yyyy = square(yy);
+        Field zz = square(p.z);
+        Field s = dbl(square(p.x + yy) - xx - yyyy);
+        Field m = dbl(xx) + xx + a * square(zz);
+        Field x3 = square(m) - dbl(s);
+        return {x3, m * (s - x3) - dbl(dbl(dbl(yyyy))), square(p.y + p.z) - yy - zz};
+    }
+
+    // p + q on a curve with any a; only doubling depends on a
+    template<typename Field>
+    jacobian_point<Field> add(const jacobian_point<Field> &p, const jacobian_point<Field> &q, const Field &a) {
+        if (!p.is_infinity() && !q.is_infinity()) {
+            Field z1z1 = square(p.z);
+            Field z2z2 = square(q.z);
+            if (p.x * z2z2 == q.x * z1z1 && p.y * q.z * z2z2 == q.y * p.z * z1z1) {
+                return dbl(p, a);
+            }
+        }
+        return add(p, q);
+    }
+
+    // affine form of p given z_inv = 1 / p.z
+    template<typename Field>
+    affine_point<Field> to_affine(const jacobian_point<Field> &p, const Field &z_inv) {
+        if (p.is_infinity()) {
+            return affine_point<Field>::point_at_infinity();
+        }
+        Field z_inv2 = square(z_inv);
+        return {p.x * z_inv2, p.y * z_inv2 * z_inv, false};
+    }
+
+    template<typename Field>
+    affine_point<Field> to_affine(const jacobian_point<Field> &p) {
+        return to_affine(p, p.is_infinity() ? p.z : inverse(p.z));
+    }
+
+    // to_affine of every point with one shared inversion
+    template<typename Field>
+    std::vector<affine_point<Field>> batch_to_affine(const std::vector<jacobian_point<Field>> &points) {
+        std::vector<Field> z_inv(points.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            z_inv[i] = points[i].z;
+        }
+        batch_inverse(z_inv.data(), z_inv.size());
+        std::vector<affine_point<Field>> out(points.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            out[i] = to_affine(points[i], z_inv[i]);
+        }
+        return out;
+    }
+
+    // [e] p on a curve with a = 0, with a single inversion at the end
+    template<typename Field>
+    jacobian_point<Field> scalar_mul_jacobian(const affine_point<Field> &p, std::uint64_t e) {
+        jacobian_point<Field> base = jacobian_point<Field>::from_affine(p);
+        jacobian_point<Field> out = jacobian_point<Field>::point_at_infinity();
+        for (std::size_t j = 64; j-- > 0;) {
+            out = dbl(out);
+            if ((e >> j) & 1) {
+                out = add(out, base);
+            }
+        }
+        return out;
+    }
+
+    // [e] p in the order of EllipticCurveScalarMultiplyFp2: starting from p at the top bit of e,
+    // every lower bit doubles and, if set, adds p. doubled and partial, if given, receive the
+    // doublings (Pdouble[i].out) and the running results (R[i]) from the top bit down.
+    template<typename Field>
+    jacobian_point<Field> scalar_mul_jacobian(const jacobian_point<Field> &p, std::uint64_t e,
+                                              std::vector<jacobian_point<Field>> *doubled,
+                                              std::vector<jacobian_point<Field>> *partial) {
+        if (e == 0) {
+            return jacobian_point<Field>::point_at_infinity();
+        }
+        std::size_t bit_length = std::bit_width(e);
+        jacobian_point<Field> out = p;
+        if (partial != nullptr) {
+            partial->push_back(out);
+        }
+        for (std::size_t i = bit_length - 1; i-- > 0;) {
+            out = dbl(out);
+            if (doubled != nullptr) {
+                doubled->push_back(out);
+            }
+            if ((e >> i) & 1) {
+                out = add(out, p);
+            }
+            if (partial != nullptr) {
+                partial->push_back(out);
+            }
+        }
+        return out;
+    }
+
+    // Curve constants of G1 (b = 4) and G2 (b = 4 (1 + u)), both with a = 0
+    inline fp g1_curve_b() {
+        return fp_from_u64(4);
+    }
+
+    inline fp2 g2_curve_b() {
+        return {fp_from_u64(4), fp_from_u64(4)};
+    }
+
+    // The generator of G1, get_generator_G1 in bls12_381_func.hpp
+    inline g1_point g1_generator() {
+        return {from_registers<64, 6>(bls12_381_limbs::generator_g1[0]),
+                from_registers<64, 6>(bls12_381_limbs::generator_g1[1]), false};
+    }
+
+    // (x, y) as the [2][K] / [2][2][K] register arrays of the circuits
+    template<std::size_t N, std::size_t K>
+    std::array<std::array<std::size_t, K>, 2> to_registers(const g1_point &p) {
+        return {to_registers<N, K>(p.x), to_registers<N, K>(p.y)};
+    }
+
+    template<std::size_t N, std::size_t K>
+    std::array<std::array<std::array<std::size_t, K>, 2>, 2> to_registers(const g2_point &p) {
+        return {to_registers<N, K>(p.x), to_registers<N, K>(p.y)};
+    }
+
+    // |x| = 0xd201000000010000, the BLS12-381 parameter (x itself is negative)
+    constexpr static const std::uint64_t BLS12_381_X_ABS = 0xd201000000010000;
+
+    // psi(x, y) = (c0 * conj(x), c1 * conj(y)), c0 = 1 / (1 + u)^{(p - 1) / 3},
+    // c1 = 1 / (1 + u)^{(p - 1) / 2}; EndomorphismPsi in bls12_381_hash_to_G2.hpp
+    inline const std::array<fp2, 2> &psi_coefficients() {
+        static const std::array<fp2, 2> c = [] {
+            constexpr std::array<std::uint64_t, 6> e3 = {0x9354ffffffffe38e, 0x0a395554e5c6aaaa, 0xcd104635a790520c,
+                                                         0xcc27c3d6fbd7063f, 0x190937e76bc3e447, 0x08ab05f8bdd54cde};
+            constexpr std::array<std::uint64_t, 6> e2 = {0xdcff7fffffffd555, 0x0f55ffff58a9ffff, 0xb39869507b587b12,
+                                                         0xb23ba5c279c2895f, 0x258dd3db21a5d66b, 0x0d0088f51cbff34d};
+            fp2 xi = mul_by_xi(fp2::one());
+            return std::array<fp2, 2> {inverse(pow(xi, e3)), inverse(pow(xi, e2))};
+        }();
+        return c;
+    }
+
+    inline g2_point psi(const g2_point &p) {
+        if (p.infinity) {
+            return p;
+        }
+        const std::array<fp2, 2> &c = psi_coefficients();
+        return {c[0] * conjugate(p.x), c[1] * conjugate(p.y), false};
+    }
+
+    // conjugation is a field automorphism, so it maps Z along with X and Y
+    inline jacobian_point<fp2> psi(const jacobian_point<fp2> &p) {
+        const std::array<fp2, 2> &c = psi_coefficients();
+        return {c[0] * conjugate(p.x), c[1] * conjugate(p.y), conjugate(p.z)};
+    }
+
+    // psi^2(x, y) = (c x, -y), c = 1 / 2^{(p - 1) / 3}; EndomorphismPsi2
+    inline const fp &psi2_coefficient() {
+        static const fp c = [] {
+            constexpr std::array<std::uint64_t, 6> e3 = {0x9354ffffffffe38e, 0x0a395554e5c6aaaa, 0xcd104635a790520c,
+                                                         0xcc27c3d6fbd7063f, 0x190937e76bc3e447, 0x08ab05f8bdd54cde};
+            return inverse(pow(fp_from_u64(2), e3));
+        }();
+        return c;
+    }
+
+    inline g2_point psi2(const g2_point &p) {
+        if (p.infinity) {
+            return p;
+        }
+        return {p.x * psi2_coefficient(), -p.y, false};
+    }
+
+    inline jacobian_point<fp2> psi2(const jacobian_point<fp2> &p) {
+        return {p.x * psi2_coefficient(), -p.y, p.z};
+    }
+
+    // Whether jacobian p and affine q are the same point, without an inversion
+    template<typename Field>
+    bool equals(const jacobian_point<Field> &p, const affine_point<Field> &q) {
+        if (p.is_infinity() || q.infinity) {
+            return p.is_infinity() == q.infinity;
+        }
+        Field zz = square(p.z);
+        return p.x == q.x * zz && p.y == q.y * zz * p.z;
+    }
+
+    // SubgroupCheckG1 of bls12_381_hash_to_G2.hpp: p is on E and phi(p) = [-x^2] p, where
+    // phi(x, y) = (omega x, y) and omega = 2^{(p - 1) / 3} = 1 / psi2_coefficient()^2
+    inline bool g1_in_subgroup(const g1_point &p) {
+        if (!is_on_curve(p, fp::zero(), g1_curve_b())) {
+            return false;
+        }
+        static const fp omega = square(psi2_coefficient());
+        jacobian_point<fp> xp = scalar_mul_jacobian(p, BLS12_381_X_ABS);
+        jacobian_point<fp> x2p = scalar_mul_jacobian<fp>(xp, BLS12_381_X_ABS, nullptr, nullptr);
+        return equals(x2p, p.infinity ? p : g1_point {omega * p.x, -p.y, false});
+    }
+
+    // SubgroupCheckG2: p is on E2 and psi(p) = [x] p = [|x|] (-p)
+    inline bool g2_in_subgroup(const g2_point &p) {
+        if (!is_on_curve(p, fp2::zero(), g2_curve_b())) {
+            return false;
+        }
+        return equals(scalar_mul_jacobian(negate(p), BLS12_381_X_ABS), psi(p));
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_CURVE_HPP
@@ -0,0 +1,135 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_FIELD_REGISTERS_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_FIELD_REGISTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/fp12.hpp>
+
+/*
+ * Drop-in counterparts of the witness helpers of bigint_func.hpp,
+ * field_elements_func.hpp and fp12_func.hpp for p = the BLS12-381 prime.
+ * They take and return the same N x K register arrays, but convert once to
+ * the 6 x 64-bit Montgomery form of fp.hpp and compute there instead of
+ * going through prod / long_div on 55-bit registers. Results are always
+ * reduced into [0, p), as the originals return them.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    template<std::size_t K>
+    using fp_registers = std::array<std::size_t, K>;
+
+    template<std::size_t K>
+    using fp2_registers = std::array<fp_registers<K>, 2>;
+
+    template<std::size_t K>
+    using fp12_registers = std::array<fp2_registers<K>, 6>;
+
+    // exponent given as L registers of N bits, as taken by mod_exp / find_Fp2_exp
+    template<std::size_t N, std::size_t L>
+    std::array<std::uint64_t, (N * L + 63) / 64> exponent_from_registers(const std::array<std::size_t, L> &in) {
+        std::array<std::uint64_t, (N * L + 63) / 64> out {};
+        for (std::size_t i = 0; i < L; i++) {
+            std::size_t bit = i * N;
+            std::uint64_t v = in[i];
+            out[bit / 64] |= v << (bit % 64);
+            if (bit % 64 != 0 && bit / 64 + 1 < out.size()) {
+                out[bit / 64 + 1] |= v >> (64 - bit % 64);
+            }
+        }
+        return out;
+    }
+
+    // long_add_mod, long_sub_mod, prod_mod, mod_exp, mod_inv of bigint_func.hpp
+    template<std::size_t N, std::size_t K>
+    fp_registers<K> long_add_mod(const fp_registers<K> &a, const fp_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) + from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp_registers<K> long_sub_mod(const fp_registers<K> &a, const fp_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) - from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp_registers<K> prod_mod(const fp_registers<K> &a, const fp_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) * from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K, std::size_t L>
+    fp_registers<K> mod_exp(const fp_registers<K> &a, const std::array<std::size_t, L> &e) {
+        return to_registers<N, K>(pow(from_registers<N, K>(a), exponent_from_registers<N>(e)));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp_registers<K> mod_inv(const fp_registers<K> &a) {
+        return to_registers<N, K>(inverse(from_registers<N, K>(a)));
+    }
+
+    // find_Fp_inverse of field_elements_func.hpp
+    template<std::size_t N, std::size_t K>
+    fp_registers<K> find_Fp_inverse(const fp_registers<K> &num) {
+        return mod_inv<N, K>(num);
+    }
+
+    // find_Fp2_* of field_elements_func.hpp
+    template<std::size_t N, std::size_t K>
+    fp2_registers<K> find_Fp2_product(const fp2_registers<K> &a, const fp2_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) * from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp2_registers<K> find_Fp2_sum(const fp2_registers<K> &a, const fp2_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) + from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp2_registers<K> find_Fp2_diff(const fp2_registers<K> &a, const fp2_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) - from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K, std::size_t L>
+    fp2_registers<K> find_Fp2_exp(const fp2_registers<K> &a, const std::array<std::size_t, L> &e) {
+        return to_registers<N, K>(pow(from_registers<N, K>(a), exponent_from_registers<N>(e)));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp2_registers<K> find_Fp2_inverse(const fp2_registers<K> &a) {
+        return to_registers<N, K>(inverse(from_registers<N, K>(a)));
+    }
+
+    // find_Fp12_* and find_Fp6_inverse of fp12_func.hpp
+    template<std::size_t N, std::size_t K>
+    fp12_registers<K> find_Fp12_sum(const fp12_registers<K> &a, const fp12_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) + from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp12_registers<K> find_Fp12_diff(const fp12_registers<K> &a, const fp12_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) - from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp12_registers<K> find_Fp12_product(const fp12_registers<K> &a, const fp12_registers<K> &b) {
+        return to_registers<N, K>(from_registers<N, K>(a) * from_registers<N, K>(b));
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp12_registers<K> find_Fp12_inverse(const fp12_registers<K> &a) {
+        return to_registers<N, K>(inverse(from_registers<N, K>(a)));
+    }
+
+    template<std::size_t N, std::size_t K>
+    std::array<fp2_registers<K>, 3> find_Fp6_inverse(const fp2_registers<K> &a0, const fp2_registers<K> &a1,
+                                                     const fp2_registers<K> &a2) {
+        fp6 inv = inverse(fp6 {from_registers<N, K>(a0), from_registers<N, K>(a1), from_registers<N, K>(a2)});
+        return {to_registers<N, K>(inv.c0), to_registers<N, K>(inv.c1), to_registers<N, K>(inv.c2)};
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_FIELD_REGISTERS_HPP
@@ -0,0 +1,485 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/addition_chain.hpp>
+
+/*
+ * Native arithmetic over the BLS12-381 base field. The circuits in pairing/
+ * carry field elements as K registers of N bits (NUM_REGISTERS x
+ * NUM_BITS_PER_REGISTER); out of circuit we use six 64-bit limbs in
+ * Montgomery form (R = 2^384) and only re-encode into registers at the
+ * boundary via to_registers/from_registers.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    using limbs_type = std::array<std::uint64_t, 6>;
+    using wide_limbs_type = std::array<std::uint64_t, 12>;
+
+    // p = 0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab
+    constexpr static const limbs_type FP_MODULUS = {0xb9feffffffffaaab, 0x1eabfffeb153ffff, 0x6730d2a0f6b0f624,
+                                                    0x64774b84f38512bf, 0x4b1ba7b6434bacd7, 0x1a0111ea397fe69a};
+    // -p^{-1} mod 2^64
+    constexpr static const std::uint64_t FP_INV = 0x89f3fffcfffcfffd;
+    // R mod p, i.e. one in Montgomery form
+    constexpr static const limbs_type FP_R = {0x760900000002fffd, 0xebf4000bc40c0002, 0x5f48985753c758ba,
+                                              0x77ce585370525745, 0x5c071a97a256ec6d, 0x15f65ec3fa80e493};
+    // R^2 mod p, used to move canonical integers into Montgomery form
+    constexpr static const limbs_type FP_R2 = {0xf4df1f341c341746, 0x0a76e6a609d104f1, 0x8de5476c4c95b6d5,
+                                               0x67eb88a9939d83c0, 0x9a793e85b519952d, 0x11988fe592cae3aa};
+
+    using uint128_t = unsigned __int128;
+
+    // a >= b as 384-bit integers
+    constexpr bool limbs_geq(const limbs_type &a, const limbs_type &b) {
+        for (std::size_t i = 6; i-- > 0;) {
+            if (a[i] != b[i]) {
+                return a[i] > b[i];
+            }
+        }
+        return true;
+    }
+
+    // out = a - b, returns the borrow
+    constexpr std::uint64_t limbs_sub(limbs_type &out, const limbs_type &a, const limbs_type &b) {
+        std::uint64_t borrow = 0;
+        for (std::size_t i = 0; i < 6; i++) {
+            uint128_t d = uint128_t(a[i]) - b[i] - borrow;
+            out[i] = std::uint64_t(d);
+            borrow = std::uint64_t(d >> 64) & 1;
+        }
+        return borrow;
+    }
+
+    // out = a + b, returns the carry
+    constexpr std::uint64_t limbs_add(limbs_type &out, const limbs_type &a, const limbs_type &b) {
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < 6; i++) {
+            uint128_t s = uint128_t(a[i]) + b[i] + carry;
+            out[i] = std::uint64_t(s);
+            carry = std::uint64_t(s >> 64);
+        }
+        return carry;
+    }
+
+    // Element of Fp in Montgomery form, limbs are little-endian and always < p
+    struct fp {
+        limbs_type limbs;
+
+        static constexpr fp zero() {
+            return fp {{0, 0, 0, 0, 0, 0}};
+        }
+
+        static constexpr fp one() {
+            return fp {FP_R};
+        }
+
+        bool is_zero() const {
+            return (limbs[0] | limbs[1] | limbs[2] | limbs[3] | limbs[4] | limbs[5]) == 0;
+        }
+
+        bool operator==(const fp &other) const {
+            return limbs == other.limbs;
+        }
+
+        bool operator!=(const fp &other) const {
+            return limbs != other.limbs;
+        }
+    };
+
+    // full 768-bit product a * b
+    inline void mul_wide(wide_limbs_type &t, const limbs_type &a, const limbs_type &b) {
+        t.fill(0);
+        for (std::size_t i = 0; i < 6; i++) {
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; j < 6; j++) {
+                uint128_t s = uint128_t(a[i]) * b[j] + t[i + j] + carry;
+                t[i + j] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            t[i + 6] = carry;
+        }
+    }
+
+    // full 768-bit square of a: the 15 cross products are computed once and doubled,
+    // 21 limb multiplications instead of 36
+    inline void sqr_wide(wide_limbs_type &t, const limbs_type &a) {
+        t.fill(0);
+        for (std::size_t i = 0; i < 5; i++) {
+            std::uint64_t carry = 0;
+            for (std::size_t j = i + 1; j < 6; j++) {
+                uint128_t s = uint128_t(a[i]) * a[j] + t[i + j] + carry;
+                t[i + j] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            t[i + 6] = carry;
+        }
+        t[11] = t[10] >> 63;
+        for (std::size_t i = 10; i > 0; i--) {
+            t[i] = (t[i] << 1) | (t[i - 1] >> 63);
+        }
+        t[0] <<= 1;
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < 6; i++) {
+            uint128_t sq = uint128_t(a[i]) * a[i];
+            uint128_t lo = uint128_t(t[2 * i]) + std::uint64_t(sq) + carry;
+            t[2 * i] = std::uint64_t(lo);
+            uint128_t hi = uint128_t(t[2 * i + 1]) + std::uint64_t(sq >> 64) + std::uint64_t(lo >> 64);
+            t[2 * i + 1] = std::uint64_t(hi);
+            carry = std::uint64_t(hi >> 64);
+        }
+    }
+
+    // Montgomery reduction t * R^{-1} mod p, requires t < p * R
+    inline fp montgomery_reduce(wide_limbs_type t) {
+        std::uint64_t carry_hi = 0;
+        for (std::size_t i = 0; i < 6; i++) {
+            std::uint64_t m = t[i] * FP_INV;
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; j < 6; j++) {
+                uint128_t s = uint128_t(m) * FP_MODULUS[j] + t[i + j] + carry;
+                t[i + j] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            uint128_t s = uint128_t(t[i + 6]) + carry + carry_hi;
+            t[i + 6] = std::uint64_t(s);
+            carry_hi = std::uint64_t(s >> 64);
+        }
+        fp out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out.limbs[i] = t[i + 6];
+        }
+        if (carry_hi != 0 || limbs_geq(out.limbs, FP_MODULUS)) {
+            limbs_sub(out.limbs, out.limbs, FP_MODULUS);
+        }
+        return out;
+    }
+
+    inline fp operator+(const fp &a, const fp &b) {
+        fp out;
+        limbs_add(out.limbs, a.limbs, b.limbs);
+        if (limbs_geq(out.limbs, FP_MODULUS)) {
+            limbs_sub(out.limbs, out.limbs, FP_MODULUS);
+        }
+        return out;
+    }
+
+    inline fp operator-(const fp &a, const fp &b) {
+        fp out;
+        if (limbs_sub(out.limbs, a.limbs, b.limbs) != 0) {
+            limbs_add(out.limbs, out.limbs, FP_MODULUS);
+        }
+        return out;
+    }
+
+    inline fp operator-(const fp &a) {
+        if (a.is_zero()) {
+            return a;
+        }
+        fp out;
+        limbs_sub(out.limbs, FP_MODULUS, a.limbs);
+        return out;
+    }
+
+    inline fp operator*(const fp &a, const fp &b) {
+        wide_limbs_type t;
+        mul_wide(t, a.limbs, b.limbs);
+        return montgomery_reduce(t);
+    }
+
+    inline fp &operator+=(fp &a, const fp &b) {
+        return a = a + b;
+    }
+
+    inline fp &operator-=(fp &a, const fp &b) {
+        return a = a - b;
+    }
+
+    inline fp &operator*=(fp &a, const fp &b) {
+        return a = a * b;
+    }
+
+    inline fp square(const fp &a) {
+        wide_limbs_type t;
+        sqr_wide(t, a.limbs);
+        return montgomery_reduce(t);
+    }
+
+    inline fp dbl(const fp &a) {
+        return a + a;
+    }
+
+    // Signed sum of double-width products, 13 limbs in two's complement, the native
+    // counterpart of the NoCarry signals: products are added and subtracted unreduced
+    // and reduce() performs the single Montgomery reduction of the whole sum
+    struct fp_wide {
+        std::array<std::uint64_t, 13> limbs;
+
+        static constexpr fp_wide zero() {
+            return fp_wide {{}};
+        }
+
+        bool is_negative() const {
+            return (limbs[12] >> 63) != 0;
+        }
+    };
+
+    // acc += t, or acc -= t with negate
+    inline void wide_accumulate(fp_wide &acc, const wide_limbs_type &t, bool negate = false) {
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < 12; i++) {
+            if (negate) {
+                uint128_t d = uint128_t(acc.limbs[i]) - t[i] - carry;
+                acc.limbs[i] = std::uint64_t(d);
+                carry = std::uint64_t(d >> 64) & 1;
+            } else {
+                uint128_t s = uint128_t(acc.limbs[i]) + t[i] + carry;
+                acc.limbs[i] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+        }
+        acc.limbs[12] = negate ? acc.limbs[12] - carry : acc.limbs[12] + carry;
+    }
+
+    inline fp_wide operator+(fp_wide a, const fp_wide &b) {
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < 13; i++) {
+            uint128_t s = uint128_t(a.limbs[i]) + b.limbs[i] + carry;
+            a.limbs[i] = std::uint64_t(s);
+            carry = std::uint64_t(s >> 64);
+        }
+        return a;
+    }
+
+    inline fp_wide operator-(fp_wide a, const fp_wide &b) {
+        std::uint64_t borrow = 0;
+        for (std::size_t i = 0; i < 13; i++) {
+            uint128_t d = uint128_t(a.limbs[i]) - b.limbs[i] - borrow;
+            a.limbs[i] = std::uint64_t(d);
+            borrow = std::uint64_t(d >> 64) & 1;
+        }
+        return a;
+    }
+
+    // acc += a * b (acc -= a * b with negate); a and b only need to be below 2^383, so
+    // unreduced sums of two field elements are valid operands
+    inline void mul_accumulate(fp_wide &acc, const limbs_type &a, const limbs_type &b, bool negate = false) {
+        wide_limbs_type t;
+        mul_wide(t, a, b);
+        wide_accumulate(acc, t, negate);
+    }
+
+    // 2^766, the bound on one product of mul_accumulate, is below FP_WIDE_TERM_BOUND * p R
+    constexpr static const std::uint64_t FP_WIDE_TERM_BOUND = 3;
+
+    // acc R^{-1} mod p where |acc| is below terms products of mul_accumulate. Adding
+    // terms * FP_WIDE_TERM_BOUND * p R makes acc non-negative, subtracting the quotient by p R
+    // estimated from the top limbs leaves it in [0, 2 p R) and one conditional subtraction in
+    // [0, p R), so the number of passes does not depend on acc.
+    inline fp reduce(fp_wide acc, std::size_t terms) {
+        // acc += m p R, or acc -= m p R with negate
+        auto add_multiple = [&acc](std::uint64_t m, bool negate) {
+            std::array<std::uint64_t, 7> mp;
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < 6; i++) {
+                uint128_t s = uint128_t(m) * FP_MODULUS[i] + carry;
+                mp[i] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            mp[6] = carry;
+            carry = 0;
+            for (std::size_t i = 0; i < 7; i++) {
+                if (negate) {
+                    uint128_t d = uint128_t(acc.limbs[i + 6]) - mp[i] - carry;
+                    acc.limbs[i + 6] = std::uint64_t(d);
+                    carry = std::uint64_t(d >> 64) & 1;
+                } else {
+                    uint128_t s = uint128_t(acc.limbs[i + 6]) + mp[i] + carry;
+                    acc.limbs[i + 6] = std::uint64_t(s);
+                    carry = std::uint64_t(s >> 64);
+                }
+            }
+        };
+        add_multiple(terms * FP_WIDE_TERM_BOUND, false);
+        // acc / 2^704 over p / 2^320 rounded up falls short of acc / (p R) by less than one
+        uint128_t top = (uint128_t(acc.limbs[12]) << 64) | acc.limbs[11];
+        add_multiple(std::uint64_t(top / (uint128_t(FP_MODULUS[5]) + 1)), true);
+        limbs_type high = {acc.limbs[6], acc.limbs[7], acc.limbs[8], acc.limbs[9], acc.limbs[10], acc.limbs[11]};
+        add_multiple(acc.limbs[12] != 0 || limbs_geq(high, FP_MODULUS), true);
+        wide_limbs_type t;
+        for (std::size_t i = 0; i < 12; i++) {
+            t[i] = acc.limbs[i];
+        }
+        return montgomery_reduce(t);
+    }
+
+    // a^e where e is a little-endian multi-limb exponent
+    template<std::size_t L>
+    fp pow(const fp &a, const std::array<std::uint64_t, L> &e) {
+        fp out = fp::one();
+        for (std::size_t i = L; i-- > 0;) {
+            for (std::size_t j = 64; j-- > 0;) {
+                out = square(out);
+                if ((e[i] >> j) & 1) {
+                    out *= a;
+                }
+            }
+        }
+        return out;
+    }
+
+    inline fp pow(const fp &a, std::uint64_t e) {
+        return pow(a, std::array<std::uint64_t, 1> {e});
+    }
+
+    // p - 2
+    constexpr static const auto FP_INVERSE_CHAIN = make_addition_chain<5>(limbs_type {
+        0xb9feffffffffaaa9, 0x1eabfffeb153ffff, 0x6730d2a0f6b0f624, 0x64774b84f38512bf, 0x4b1ba7b6434bacd7,
+        0x1a0111ea397fe69a});
+
+    // a^{-1} = a^{p-2}, returns 0 for a = 0 like mod_inv in bigint_func.hpp
+    inline fp inverse(const fp &a) {
+        return pow(a, FP_INVERSE_CHAIN);
+    }
+
+    // (p - 3) / 4: a^{(p - 3) / 4} is 1 / sqrt(a) and a^{(p + 1) / 4} = a a^{(p - 3) / 4} is sqrt(a), p = 3 mod 4
+    constexpr static const auto FP_SQRT_CHAIN = make_addition_chain<5>(limbs_type {
+        0xee7fbfffffffeaaa, 0x07aaffffac54ffff, 0xd9cc34a83dac3d89, 0xd91dd2e13ce144af, 0x92c6e9ed90d2eb35,
+        0x0680447a8e5ff9a6});
+
+    // Montgomery's simultaneous inversion: replaces values[0 .. n) by their inverses
+    // with a single call to inverse(); zeros are skipped and stay zero
+    template<typename Field>
+    void batch_inverse(Field *values, std::size_t n) {
+        if (n == 0) {
+            return;
+        }
+        std::vector<Field> prefix(n);
+        Field acc = Field::one();
+        for (std::size_t i = 0; i < n; i++) {
+            prefix[i] = acc;
+            if (!values[i].is_zero()) {
+                acc *= values[i];
+            }
+        }
+        Field acc_inv = inverse(acc);
+        for (std::size_t i = n; i-- > 0;) {
+            if (!values[i].is_zero()) {
+                Field value_inv = acc_inv * prefix[i];
+                acc_inv *= values[i];
+                values[i] = value_inv;
+            }
+        }
+    }
+
+    // Montgomery form of a canonical (or merely < 2^384) integer
+    inline fp fp_from_limbs(const limbs_type &canonical) {
+        wide_limbs_type t;
+        mul_wide(t, canonical, FP_R2);
+        return montgomery_reduce(t);
+    }
+
+    inline fp fp_from_u64(std::uint64_t v) {
+        return fp_from_limbs({v, 0, 0, 0, 0, 0});
+    }
+
+    // canonical integer in [0, p)
+    inline limbs_type fp_to_limbs(const fp &a) {
+        wide_limbs_type t {};
+        for (std::size_t i = 0; i < 6; i++) {
+            t[i] = a.limbs[i];
+        }
+        return montgomery_reduce(t).limbs;
+    }
+
+    // 48-byte big-endian encoding, as used by the G1/G2 serialization
+    inline fp fp_from_bytes_be(const std::uint8_t *in) {
+        limbs_type l {};
+        for (std::size_t i = 0; i < 48; i++) {
+            l[5 - i / 8] |= std::uint64_t(in[i]) << (8 * (7 - i % 8));
+        }
+        return fp_from_limbs(l);
+    }
+
+    inline void fp_to_bytes_be(const fp &a, std::uint8_t *out) {
+        limbs_type l = fp_to_limbs(a);
+        for (std::size_t i = 0; i < 48; i++) {
+            out[i] = std::uint8_t(l[5 - i / 8] >> (8 * (7 - i % 8)));
+        }
+    }
+
+    // 64-byte big-endian string reduced mod p, the OS2IP(tv) mod p step of hash_to_field
+    inline fp fp_from_bytes_be_wide(const std::uint8_t *in) {
+        limbs_type hi {}, lo {};
+        for (std::size_t i = 0; i < 16; i++) {
+            hi[1 - i / 8] |= std::uint64_t(in[i]) << (8 * (7 - i % 8));
+        }
+        for (std::size_t i = 0; i < 48; i++) {
+            lo[5 - i / 8] |= std::uint64_t(in[16 + i]) << (8 * (7 - i % 8));
+        }
+        // hi * 2^384 + lo, where 2^384 = R has Montgomery form R^2
+        return fp_from_limbs(hi) * fp {FP_R2} + fp_from_limbs(lo);
+    }
+
+    // b if choose_b is set, a otherwise, without branching on choose_b
+    inline fp select(const fp &a, const fp &b, bool choose_b) {
+        std::uint64_t mask = std::uint64_t(0) - std::uint64_t(choose_b);
+        fp out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out.limbs[i] = a.limbs[i] ^ (mask & (a.limbs[i] ^ b.limbs[i]));
+        }
+        return out;
+    }
+
+    // least significant bit of the canonical representative, get_fp_sgn0 in field_elements_func.hpp
+    inline std::size_t sgn0(const fp &a) {
+        return fp_to_limbs(a)[0] & 1;
+    }
+
+    // Re-encodes a into the circuit layout: K registers of N bits, little-endian
+    template<std::size_t N, std::size_t K>
+    std::array<std::size_t, K> to_registers(const fp &a) {
+        static_assert(N <= 64 && N * K >= 381);
+        limbs_type l = fp_to_limbs(a);
+        std::array<std::size_t, K> out {};
+        for (std::size_t i = 0; i < K; i++) {
+            std::size_t bit = i * N;
+            std::uint64_t v = 0;
+            if (bit < 384) {
+                v = l[bit / 64] >> (bit % 64);
+                if (bit % 64 != 0 && bit / 64 + 1 < 6) {
+                    v |= l[bit / 64 + 1] << (64 - bit % 64);
+                }
+            }
+            out[i] = std::size_t(N == 64 ? v : v & ((std::uint64_t(1) << N) - 1));
+        }
+        return out;
+    }
+
+    // Inverse of to_registers; registers are assumed to be in [0, 2^N) and to encode a value < 2^384
+    template<std::size_t N, std::size_t K>
+    fp from_registers(const std::array<std::size_t, K> &in) {
+        static_assert(N <= 64 && N * K >= 381);
+        limbs_type l {};
+        for (std::size_t i = 0; i < K; i++) {
+            std::size_t bit = i * N;
+            if (bit >= 384) {
+                break;
+            }
+            std::uint64_t v = in[i];
+            l[bit / 64] |= v << (bit % 64);
+            if (bit % 64 != 0 && bit / 64 + 1 < 6) {
+                l[bit / 64 + 1] |= v >> (64 - bit % 64);
+            }
+        }
+        return fp_from_limbs(l);
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_HPP
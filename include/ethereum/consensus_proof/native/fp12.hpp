@@ -0,0 +1,299 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_FP12_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_FP12_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/register_tables.hpp>
+
+/*
+ * Native Fp12 = Fp2[w] / (w^6 - (1 + u)) in the same flat basis as the
+ * circuits: an element is c[0] + c[1] w + ... + c[5] w^5 with c[i] in Fp2,
+ * i.e. the [6][2][k] arrays of fp12.hpp. Grouping the even and odd
+ * coefficients gives the usual Fp6 = Fp2[v] / (v^3 - (1 + u)), v = w^2,
+ * sub-field, which is only used where it makes the formulas simpler.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    // a0 + a1 v + a2 v^2 with v^3 = 1 + u
+    struct fp6 {
+        fp2 c0;
+        fp2 c1;
+        fp2 c2;
+    };
+
+    inline fp6 operator+(const fp6 &a, const fp6 &b) {
+        return {a.c0 + b.c0, a.c1 + b.c1, a.c2 + b.c2};
+    }
+
+    inline fp6 operator-(const fp6 &a, const fp6 &b) {
+        return {a.c0 - b.c0, a.c1 - b.c1, a.c2 - b.c2};
+    }
+
+    // Bounds on the number of products summed into one coefficient before it is reduced, see
+    // reduce(fp_wide, terms). An Fp2 product has 2 per coefficient, an Fp2 square 1, and
+    // mul_by_xi adds the counts of both coefficients.
+    constexpr static const std::size_t FP6_MUL_TERMS = 14;
+    constexpr static const std::size_t FP12_SPARSE_MUL_TERMS = 18;
+    constexpr static const std::size_t FP12_MUL_TERMS = 42;
+    constexpr static const std::size_t FP12_SQR_TERMS = 21;
+
+    // Unreduced fp6, see fp_wide
+    struct fp6_wide {
+        fp2_wide c0;
+        fp2_wide c1;
+        fp2_wide c2;
+    };
+
+    inline fp6_wide operator+(const fp6_wide &a, const fp6_wide &b) {
+        return {a.c0 + b.c0, a.c1 + b.c1, a.c2 + b.c2};
+    }
+
+    inline fp6_wide operator-(const fp6_wide &a, const fp6_wide &b) {
+        return {a.c0 - b.c0, a.c1 - b.c1, a.c2 - b.c2};
+    }
+
+    inline fp6_wide mul_by_v(const fp6_wide &a) {
+        return {mul_by_xi(a.c2), a.c0, a.c1};
+    }
+
+    inline fp6 reduce(const fp6_wide &a, std::size_t terms) {
+        return {reduce(a.c0, terms), reduce(a.c1, terms), reduce(a.c2, terms)};
+    }
+
+    inline fp2_wide mul_wide(const fp2 &a, const fp2 &b) {
+        fp2_wide out = fp2_wide::zero();
+        mul_accumulate(out, a, b);
+        return out;
+    }
+
+    inline fp2_wide sqr_wide(const fp2 &a) {
+        fp2_wide out = fp2_wide::zero();
+        sqr_accumulate(out, a);
+        return out;
+    }
+
+    // Karatsuba over v: 6 Fp2 products instead of 9
+    inline fp6_wide mul_wide(const fp6 &a, const fp6 &b) {
+        fp2_wide t0 = mul_wide(a.c0, b.c0);
+        fp2_wide t1 = mul_wide(a.c1, b.c1);
+        fp2_wide t2 = mul_wide(a.c2, b.c2);
+        return {t0 + mul_by_xi(mul_wide(a.c1 + a.c2, b.c1 + b.c2) - t1 - t2),
+                mul_wide(a.c0 + a.c1, b.c0 + b.c1) - t0 - t1 + mul_by_xi(t2),
+                mul_wide(a.c0 + a.c2, b.c0 + b.c2) - t0 - t2 + t1};
+    }
+
+    // Chung-Hasan SQR3: 2 Fp2 products and 3 Fp2 squares
+    inline fp6_wide sqr_wide(const fp6 &a) {
+        fp2_wide s0 = sqr_wide(a.c0);
+        fp2_wide s1 = mul_wide(dbl(a.c0), a.c1);
+        fp2_wide s2 = sqr_wide(a.c0 - a.c1 + a.c2);
+        fp2_wide s3 = mul_wide(dbl(a.c1), a.c2);
+        fp2_wide s4 = sqr_wide(a.c2);
+        return {s0 + mul_by_xi(s3), s1 + mul_by_xi(s4), s1 + s2 + s3 - s0 - s4};
+    }
+
+    inline fp6 operator*(const fp6 &a, const fp6 &b) {
+        return reduce(mul_wide(a, b), FP6_MUL_TERMS);
+    }
+
+    // a * v
+    inline fp6 mul_by_v(const fp6 &a) {
+        return {mul_by_xi(a.c2), a.c0, a.c1};
+    }
+
+    // same formulas as find_Fp6_inverse in field_elements_func.hpp
+    inline fp6 inverse(const fp6 &a) {
+        fp2 t0 = square(a.c0) - mul_by_xi(a.c1 * a.c2);
+        fp2 t1 = mul_by_xi(square(a.c2)) - a.c0 * a.c1;
+        fp2 t2 = square(a.c1) - a.c0 * a.c2;
+        fp2 denom_inv = inverse(a.c0 * t0 + mul_by_xi(a.c2 * t1 + a.c1 * t2));
+        return {t0 * denom_inv, t1 * denom_inv, t2 * denom_inv};
+    }
+
+    struct fp12 {
+        std::array<fp2, 6> c;
+
+        static fp12 zero() {
+            fp12 out;
+            out.c.fill(fp2::zero());
+            return out;
+        }
+
+        static fp12 one() {
+            fp12 out = zero();
+            out.c[0] = fp2::one();
+            return out;
+        }
+
+        bool is_one() const {
+            return *this == one();
+        }
+
+        bool operator==(const fp12 &other) const {
+            return c == other.c;
+        }
+
+        bool operator!=(const fp12 &other) const {
+            return !(*this == other);
+        }
+
+        // even and odd halves, x = even + odd * w
+        fp6 even() const {
+            return {c[0], c[2], c[4]};
+        }
+
+        fp6 odd() const {
+            return {c[1], c[3], c[5]};
+        }
+
+        static fp12 from_halves(const fp6 &even, const fp6 &odd) {
+            return fp12 {{even.c0, odd.c0, even.c1, odd.c1, even.c2, odd.c2}};
+        }
+    };
+
+    inline fp12 operator+(const fp12 &a, const fp12 &b) {
+        fp12 out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out.c[i] = a.c[i] + b.c[i];
+        }
+        return out;
+    }
+
+    inline fp12 operator-(const fp12 &a, const fp12 &b) {
+        fp12 out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out.c[i] = a.c[i] - b.c[i];
+        }
+        return out;
+    }
+
+    // coefficients t[0 .. 10] of a product in w, reduced by w^6 = 1 + u with one
+    // Montgomery reduction per output coefficient
+    inline fp12 reduce(const std::array<fp2_wide, 11> &t, std::size_t terms) {
+        fp12 out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out.c[i] = reduce((i < 5) ? t[i] + mul_by_xi(t[i + 6]) : t[i], terms);
+        }
+        return out;
+    }
+
+    // Karatsuba over the tower, x = A0 + A1 w with A0, A1 in Fp6 and w^2 = v:
+    //     ab = (A0 B0 + A1 B1 v) + ((A0 + A1)(B0 + B1) - A0 B0 - A1 B1) w
+    // 18 Fp2 products instead of the 36 of find_Fp12_product, summed unreduced like
+    // SignedFp12MultiplyNoCarry and reduced once per output coefficient
+    inline fp12 operator*(const fp12 &a, const fp12 &b) {
+        fp6 a0 = a.even(), a1 = a.odd(), b0 = b.even(), b1 = b.odd();
+        fp6_wide t0 = mul_wide(a0, b0);
+        fp6_wide t1 = mul_wide(a1, b1);
+        fp6_wide t2 = mul_wide(a0 + a1, b0 + b1);
+        return fp12::from_halves(reduce(t0 + mul_by_v(t1), FP12_MUL_TERMS), reduce(t2 - t0 - t1, FP12_MUL_TERMS));
+    }
+
+    // a * b where only the coefficients I0, I1, I2 of b can be non-zero (the line
+    // functions of the Miller loop): 18 Fp2 products instead of 36
+    template<std::size_t I0, std::size_t I1, std::size_t I2>
+    fp12 mul_by_sparse(const fp12 &a, const std::array<fp2, 3> &b) {
+        constexpr std::array<std::size_t, 3> index = {I0, I1, I2};
+        std::array<fp2_wide, 11> t;
+        t.fill(fp2_wide::zero());
+        for (std::size_t i = 0; i < 6; i++) {
+            for (std::size_t j = 0; j < 3; j++) {
+                mul_accumulate(t[i + index[j]], a.c[i], b[j]);
+            }
+        }
+        return reduce(t, FP12_SPARSE_MUL_TERMS);
+    }
+
+    inline fp12 &operator*=(fp12 &a, const fp12 &b) {
+        return a = a * b;
+    }
+
+    // (A0 + A1 w)^2 = (A0^2 + A1^2 v) + ((A0 + A1)^2 - A0^2 - A1^2) w with the three Fp6
+    // squares done by SQR3
+    inline fp12 square(const fp12 &a) {
+        fp6 a0 = a.even(), a1 = a.odd();
+        fp6_wide s0 = sqr_wide(a0);
+        fp6_wide s1 = sqr_wide(a1);
+        fp6_wide s2 = sqr_wide(a0 + a1);
+        return fp12::from_halves(reduce(s0 + mul_by_v(s1), FP12_SQR_TERMS), reduce(s2 - s0 - s1, FP12_SQR_TERMS));
+    }
+
+    // x^{p^6}, which is the inverse for elements of the cyclotomic subgroup
+    inline fp12 conjugate(const fp12 &a) {
+        fp12 out = a;
+        for (std::size_t i = 1; i < 6; i += 2) {
+            out.c[i] = -out.c[i];
+        }
+        return out;
+    }
+
+    // (A + B w)^{-1} = (A - B w) / (A^2 - B^2 v), see find_Fp12_inverse
+    inline fp12 inverse(const fp12 &a) {
+        fp6 even = a.even();
+        fp6 odd = a.odd();
+        fp6 denom_inv = inverse(even * even - mul_by_v(odd * odd));
+        fp6 zero6 = {fp2::zero(), fp2::zero(), fp2::zero()};
+        return fp12::from_halves(even * denom_inv, zero6 - odd * denom_inv);
+    }
+
+    // coeff[j][i] with (w^i)^{p^j} = coeff[j][i] * w^i, get_Fp12_frobenius
+    inline const std::array<std::array<fp2, 6>, 12> &fp12_frobenius_coefficients() {
+        static const std::array<std::array<fp2, 6>, 12> coeff = [] {
+            std::array<std::array<fp2, 6>, 12> out;
+            for (std::size_t j = 0; j < 12; j++) {
+                out[j] = fp2_from_limbs_table(bls12_381_limbs::fp12_frobenius[j]);
+            }
+            return out;
+        }();
+        return coeff;
+    }
+
+    // x^{p^power}, Fp12FrobeniusMap in fp12.hpp
+    inline fp12 frobenius_map(const fp12 &a, std::size_t power) {
+        const std::array<std::array<fp2, 6>, 12> &coeff = fp12_frobenius_coefficients();
+        std::size_t pw = power % 12;
+        fp12 out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out.c[i] = frobenius_map(a.c[i], pw) * coeff[pw][i];
+        }
+        return out;
+    }
+
+    // a^e by square and multiply, Fp12Exp / Fp12CyclotomicExp in the circuits
+    inline fp12 pow(const fp12 &a, std::uint64_t e) {
+        fp12 out = fp12::one();
+        for (std::size_t j = 64; j-- > 0;) {
+            out = square(out);
+            if ((e >> j) & 1) {
+                out *= a;
+            }
+        }
+        return out;
+    }
+
+    template<std::size_t N, std::size_t K>
+    std::array<std::array<std::array<std::size_t, K>, 2>, 6> to_registers(const fp12 &a) {
+        std::array<std::array<std::array<std::size_t, K>, 2>, 6> out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out[i] = to_registers<N, K>(a.c[i]);
+        }
+        return out;
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp12 from_registers(const std::array<std::array<std::array<std::size_t, K>, 2>, 6> &in) {
+        fp12 out;
+        for (std::size_t i = 0; i < 6; i++) {
+            out.c[i] = from_registers<N, K>(in[i]);
+        }
+        return out;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_FP12_HPP
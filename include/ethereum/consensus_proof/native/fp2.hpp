@@ -0,0 +1,196 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_FP2_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_FP2_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+
+/*
+ * Native Fp2 = Fp[u] / (u^2 + 1). Mirrors the [2][k] representation of the
+ * circuits: c0 is the real part, c1 the coefficient of u.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    struct fp2 {
+        fp c0;
+        fp c1;
+
+        static constexpr fp2 zero() {
+            return fp2 {fp::zero(), fp::zero()};
+        }
+
+        static constexpr fp2 one() {
+            return fp2 {fp::one(), fp::zero()};
+        }
+
+        bool is_zero() const {
+            return c0.is_zero() && c1.is_zero();
+        }
+
+        bool operator==(const fp2 &other) const {
+            return c0 == other.c0 && c1 == other.c1;
+        }
+
+        bool operator!=(const fp2 &other) const {
+            return !(*this == other);
+        }
+    };
+
+    inline fp2 operator+(const fp2 &a, const fp2 &b) {
+        return {a.c0 + b.c0, a.c1 + b.c1};
+    }
+
+    inline fp2 operator-(const fp2 &a, const fp2 &b) {
+        return {a.c0 - b.c0, a.c1 - b.c1};
+    }
+
+    inline fp2 operator-(const fp2 &a) {
+        return {-a.c0, -a.c1};
+    }
+
+    // (a0 + a1 u)(b0 + b1 u) = (a0 b0 - a1 b1) + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) u
+    inline fp2 operator*(const fp2 &a, const fp2 &b) {
+        fp t0 = a.c0 * b.c0;
+        fp t1 = a.c1 * b.c1;
+        return {t0 - t1, (a.c0 + a.c1) * (b.c0 + b.c1) - t0 - t1};
+    }
+
+    inline fp2 operator*(const fp2 &a, const fp &b) {
+        return {a.c0 * b, a.c1 * b};
+    }
+
+    inline fp2 &operator+=(fp2 &a, const fp2 &b) {
+        return a = a + b;
+    }
+
+    inline fp2 &operator-=(fp2 &a, const fp2 &b) {
+        return a = a - b;
+    }
+
+    inline fp2 &operator*=(fp2 &a, const fp2 &b) {
+        return a = a * b;
+    }
+
+    // (a0 + a1 u)^2 = (a0 + a1)(a0 - a1) + 2 a0 a1 u
+    inline fp2 square(const fp2 &a) {
+        return {(a.c0 + a.c1) * (a.c0 - a.c1), dbl(a.c0 * a.c1)};
+    }
+
+    inline fp2 dbl(const fp2 &a) {
+        return {dbl(a.c0), dbl(a.c1)};
+    }
+
+    inline fp2 conjugate(const fp2 &a) {
+        return {a.c0, -a.c1};
+    }
+
+    // a * (1 + u), the non-residue w^6 of the Fp12 tower (XI0 = 1 in the circuits)
+    inline fp2 mul_by_xi(const fp2 &a) {
+        return {a.c0 - a.c1, a.c0 + a.c1};
+    }
+
+    // Unreduced Fp2 sum of products, see fp_wide
+    struct fp2_wide {
+        fp_wide c0;
+        fp_wide c1;
+
+        static constexpr fp2_wide zero() {
+            return fp2_wide {fp_wide::zero(), fp_wide::zero()};
+        }
+    };
+
+    inline fp2_wide operator+(const fp2_wide &a, const fp2_wide &b) {
+        return {a.c0 + b.c0, a.c1 + b.c1};
+    }
+
+    inline fp2_wide operator-(const fp2_wide &a, const fp2_wide &b) {
+        return {a.c0 - b.c0, a.c1 - b.c1};
+    }
+
+    // acc += a * b (acc -= a * b with negate), Karatsuba on the unreduced sums a0 + a1, b0 + b1
+    inline void mul_accumulate(fp2_wide &acc, const fp2 &a, const fp2 &b, bool negate = false) {
+        wide_limbs_type t0, t1, t2;
+        limbs_type a_sum, b_sum;
+        mul_wide(t0, a.c0.limbs, b.c0.limbs);
+        mul_wide(t1, a.c1.limbs, b.c1.limbs);
+        limbs_add(a_sum, a.c0.limbs, a.c1.limbs);
+        limbs_add(b_sum, b.c0.limbs, b.c1.limbs);
+        mul_wide(t2, a_sum, b_sum);
+        wide_accumulate(acc.c0, t0, negate);
+        wide_accumulate(acc.c0, t1, !negate);
+        wide_accumulate(acc.c1, t2, negate);
+        wide_accumulate(acc.c1, t0, !negate);
+        wide_accumulate(acc.c1, t1, !negate);
+    }
+
+    // acc += a^2 with two products: (a0 + a1)(a0 + p - a1) differs from a0^2 - a1^2 by a
+    // multiple of p, which the reduction absorbs
+    inline void sqr_accumulate(fp2_wide &acc, const fp2 &a) {
+        limbs_type a_sum, a_diff;
+        limbs_add(a_sum, a.c0.limbs, a.c1.limbs);
+        limbs_sub(a_diff, FP_MODULUS, a.c1.limbs);
+        limbs_add(a_diff, a_diff, a.c0.limbs);
+        mul_accumulate(acc.c0, a_sum, a_diff);
+        mul_accumulate(acc.c1, dbl(a.c0).limbs, a.c1.limbs);
+    }
+
+    inline fp2_wide mul_by_xi(const fp2_wide &a) {
+        return {a.c0 - a.c1, a.c0 + a.c1};
+    }
+
+    inline fp2 reduce(const fp2_wide &a, std::size_t terms) {
+        return {reduce(a.c0, terms), reduce(a.c1, terms)};
+    }
+
+    // (a0 - a1 u) / (a0^2 + a1^2), see find_Fp2_inverse in field_elements_func.hpp
+    inline fp2 inverse(const fp2 &a) {
+        fp lambda = inverse(square(a.c0) + square(a.c1));
+        return {a.c0 * lambda, -(a.c1 * lambda)};
+    }
+
+    // a^{p^power}; Frobenius on Fp2 is conjugation for odd powers
+    inline fp2 frobenius_map(const fp2 &a, std::size_t power) {
+        return (power % 2 == 1) ? conjugate(a) : a;
+    }
+
+    template<std::size_t L>
+    fp2 pow(const fp2 &a, const std::array<std::uint64_t, L> &e) {
+        fp2 out = fp2::one();
+        for (std::size_t i = L; i-- > 0;) {
+            for (std::size_t j = 64; j-- > 0;) {
+                out = square(out);
+                if ((e[i] >> j) & 1) {
+                    out *= a;
+                }
+            }
+        }
+        return out;
+    }
+
+    inline fp2 select(const fp2 &a, const fp2 &b, bool choose_b) {
+        return {select(a.c0, b.c0, choose_b), select(a.c1, b.c1, choose_b)};
+    }
+
+    // sgn0 of the hash-to-curve draft, get_fp2_sgn0 in field_elements_func.hpp. sign_0 is 0
+    // when c0 is, so sign_0 | (zero_0 & sign_1) is the sign of c0 or, if c0 = 0, of c1; one
+    // Montgomery reduction instead of two
+    inline std::size_t sgn0(const fp2 &a) {
+        return sgn0(select(a.c0, a.c1, a.c0.is_zero()));
+    }
+
+    template<std::size_t N, std::size_t K>
+    std::array<std::array<std::size_t, K>, 2> to_registers(const fp2 &a) {
+        return {to_registers<N, K>(a.c0), to_registers<N, K>(a.c1)};
+    }
+
+    template<std::size_t N, std::size_t K>
+    fp2 from_registers(const std::array<std::array<std::size_t, K>, 2> &in) {
+        return {from_registers<N, K>(in[0]), from_registers<N, K>(in[1])};
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_FP2_HPP
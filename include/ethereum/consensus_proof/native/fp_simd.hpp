@@ -0,0 +1,374 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_SIMD_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_SIMD_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_SIMD_X86 1
+#endif
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+
+/*
+ * SIMD Montgomery multiplication over many independent Fp elements, for
+ * the per-key work (on-curve checks, decompression square roots, batch
+ * pairing inputs) that is the same computation 512 times.
+ *
+ * Lanes hold one element each, limbs are spread over vectors ([limb][lane]):
+ *  - AVX-512 IFMA: 8 lanes, 8 limbs of 52 bits, R' = 2^416
+ *  - AVX2: 4 lanes, 15 limbs of 26 bits (vpmuludq is 32 x 32 bits), R' = 2^390
+ * Values stay below 2p in between operations, which R' >= 16p allows, and
+ * are made canonical when converted back to fp. The backend is chosen once
+ * from CPUID, the scalar fp.hpp code being the last resort.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    enum class fp_simd_backend { scalar, avx2, avx512_ifma };
+
+    // Montgomery multiplication of one block: out = a * b / R' for every lane, limbs in [limb][lane] order
+    using fp_simd_kernel = void (*)(std::uint64_t *out, const std::uint64_t *a, const std::uint64_t *b);
+
+    // Radix 2^limb_bits form of p and the derived constants of one backend
+    struct fp_simd_parameters {
+        std::size_t lanes;
+        std::size_t limbs;
+        std::size_t limb_bits;
+        fp_simd_kernel mont_mul;
+
+        std::vector<std::uint64_t> modulus;
+        std::uint64_t inv;
+        // 2^{2 log R' - 384}: x * to_domain / R' moves from R = 2^384 to R', and fixes
+        // the 2^{384 - log R'} factor left by multiplying two values in the R form
+        std::vector<std::uint64_t> to_domain;
+        // 2^384: x * from_domain / R' moves back from R' to R
+        std::vector<std::uint64_t> from_domain;
+    };
+
+    // limbs of limb_bits bits of a 384-bit integer
+    inline std::vector<std::uint64_t> fp_simd_split(const limbs_type &in, std::size_t limbs, std::size_t limb_bits) {
+        std::vector<std::uint64_t> out(limbs, 0);
+        std::uint64_t mask = (std::uint64_t(1) << limb_bits) - 1;
+        for (std::size_t j = 0; j < limbs; j++) {
+            std::size_t bit = j * limb_bits;
+            if (bit >= 384) {
+                break;
+            }
+            std::uint64_t v = in[bit / 64] >> (bit % 64);
+            if (bit % 64 + limb_bits > 64 && bit / 64 + 1 < 6) {
+                v |= in[bit / 64 + 1] << (64 - bit % 64);
+            }
+            out[j] = v & mask;
+        }
+        return out;
+    }
+
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_SIMD_X86
+
+    inline const fp_simd_parameters &fp_simd_ifma_parameters();
+    inline const fp_simd_parameters &fp_simd_avx2_parameters();
+
+    __attribute__((target("avx512f,avx512ifma"))) inline void
+        fp_simd_ifma_mont_mul(std::uint64_t *out, const std::uint64_t *a, const std::uint64_t *b) {
+        const fp_simd_parameters &params = fp_simd_ifma_parameters();
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i mask = _mm512_set1_epi64((std::int64_t(1) << 52) - 1);
+        const __m512i inv = _mm512_set1_epi64(std::int64_t(params.inv));
+        __m512i p[8], av[8], t[9];
+        for (std::size_t j = 0; j < 8; j++) {
+            p[j] = _mm512_set1_epi64(std::int64_t(params.modulus[j]));
+            av[j] = _mm512_loadu_si512(a + 8 * j);
+            t[j] = zero;
+        }
+        t[8] = zero;
+        for (std::size_t i = 0; i < 8; i++) {
+            __m512i bi = _mm512_loadu_si512(b + 8 * i);
+            for (std::size_t j = 0; j < 8; j++) {
+                t[j] = _mm512_madd52lo_epu64(t[j], av[j], bi);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], av[j], bi);
+            }
+            __m512i m = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t[0], inv), mask);
+            for (std::size_t j = 0; j < 8; j++) {
+                t[j] = _mm512_madd52lo_epu64(t[j], m, p[j]);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, p[j]);
+            }
+            // the low 52 bits of t[0] are now zero, shift by one limb
+            __m512i carry = _mm512_maskz_srli_epi64(0xff, t[0], 52);
+            for (std::size_t j = 0; j < 8; j++) {
+                t[j] = t[j + 1];
+            }
+            t[0] = _mm512_add_epi64(t[0], carry);
+            t[8] = zero;
+        }
+        for (std::size_t j = 0; j < 7; j++) {
+            t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_maskz_srli_epi64(0xff, t[j], 52));
+            t[j] = _mm512_and_si512(t[j], mask);
+        }
+        for (std::size_t j = 0; j < 8; j++) {
+            _mm512_storeu_si512(out + 8 * j, t[j]);
+        }
+    }
+
+    __attribute__((target("avx2"))) inline void fp_simd_avx2_mont_mul(std::uint64_t *out, const std::uint64_t *a,
+                                                                      const std::uint64_t *b) {
+        const fp_simd_parameters &params = fp_simd_avx2_parameters();
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i mask = _mm256_set1_epi64x((std::int64_t(1) << 26) - 1);
+        const __m256i inv = _mm256_set1_epi64x(std::int64_t(params.inv));
+        __m256i p[15], av[15], t[16];
+        for (std::size_t j = 0; j < 15; j++) {
+            p[j] = _mm256_set1_epi64x(std::int64_t(params.modulus[j]));
+            av[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + 4 * j));
+            t[j] = zero;
+        }
+        t[15] = zero;
+        for (std::size_t i = 0; i < 15; i++) {
+            __m256i bi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + 4 * i));
+            for (std::size_t j = 0; j < 15; j++) {
+                t[j] = _mm256_add_epi64(t[j], _mm256_mul_epu32(av[j], bi));
+            }
+            __m256i m = _mm256_and_si256(_mm256_mul_epu32(t[0], inv), mask);
+            for (std::size_t j = 0; j < 15; j++) {
+                t[j] = _mm256_add_epi64(t[j], _mm256_mul_epu32(m, p[j]));
+            }
+            __m256i carry = _mm256_srli_epi64(t[0], 26);
+            for (std::size_t j = 0; j < 15; j++) {
+                t[j] = t[j + 1];
+            }
+            t[0] = _mm256_add_epi64(t[0], carry);
+            t[15] = zero;
+        }
+        for (std::size_t j = 0; j < 14; j++) {
+            t[j + 1] = _mm256_add_epi64(t[j + 1], _mm256_srli_epi64(t[j], 26));
+            t[j] = _mm256_and_si256(t[j], mask);
+        }
+        for (std::size_t j = 0; j < 15; j++) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 4 * j), t[j]);
+        }
+    }
+
+    inline fp_simd_parameters fp_simd_make_parameters(std::size_t lanes, std::size_t limbs, std::size_t limb_bits,
+                                                      fp_simd_kernel mont_mul) {
+        fp_simd_parameters params {lanes, limbs, limb_bits, mont_mul, {}, 0, {}, {}};
+        params.modulus = fp_simd_split(FP_MODULUS, limbs, limb_bits);
+        params.inv = FP_INV & ((std::uint64_t(1) << limb_bits) - 1);
+        params.to_domain = fp_simd_split(fp_to_limbs(pow(fp_from_u64(2), 2 * limbs * limb_bits - 384)), limbs,
+                                         limb_bits);
+        params.from_domain = fp_simd_split(FP_R, limbs, limb_bits);
+        return params;
+    }
+
+    inline const fp_simd_parameters &fp_simd_ifma_parameters() {
+        static const fp_simd_parameters params = fp_simd_make_parameters(8, 8, 52, fp_simd_ifma_mont_mul);
+        return params;
+    }
+
+    inline const fp_simd_parameters &fp_simd_avx2_parameters() {
+        static const fp_simd_parameters params = fp_simd_make_parameters(4, 15, 26, fp_simd_avx2_mont_mul);
+        return params;
+    }
+
+#endif
+
+    // Widest backend supported by the CPU we run on
+    inline fp_simd_backend fp_simd_detect() {
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma")) {
+            return fp_simd_backend::avx512_ifma;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return fp_simd_backend::avx2;
+        }
+#endif
+        return fp_simd_backend::scalar;
+    }
+
+    inline fp_simd_backend fp_simd_default_backend() {
+        static const fp_simd_backend backend = fp_simd_detect();
+        return backend;
+    }
+
+    // parameters of a vector backend, nullptr for the scalar one
+    inline const fp_simd_parameters *fp_simd_parameters_of(fp_simd_backend backend) {
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_SIMD_X86
+        if (backend == fp_simd_backend::avx512_ifma) {
+            return &fp_simd_ifma_parameters();
+        }
+        if (backend == fp_simd_backend::avx2) {
+            return &fp_simd_avx2_parameters();
+        }
+#endif
+        return nullptr;
+    }
+
+    // A vector of Fp elements held in the layout of one backend, so that chains of
+    // multiplications (exponentiations in particular) stay in that layout
+    class fp_batch {
+    public:
+        explicit fp_batch(const std::vector<fp> &values, fp_simd_backend backend = fp_simd_default_backend()) :
+            params(fp_simd_parameters_of(backend)), count(values.size()) {
+            if (params == nullptr) {
+                scalar = values;
+                return;
+            }
+            blocks = (count + params->lanes - 1) / params->lanes;
+            data.assign(blocks * block_size(), 0);
+            for (std::size_t e = 0; e < count; e++) {
+                std::vector<std::uint64_t> limbs = fp_simd_split(values[e].limbs, params->limbs, params->limb_bits);
+                for (std::size_t j = 0; j < params->limbs; j++) {
+                    data[(e / params->lanes) * block_size() + j * params->lanes + e % params->lanes] = limbs[j];
+                }
+            }
+            // R -> R'
+            mul_by_constant(params->to_domain);
+        }
+
+        std::size_t size() const {
+            return count;
+        }
+
+        std::vector<fp> values() const {
+            if (params == nullptr) {
+                return scalar;
+            }
+            fp_batch tmp = *this;
+            // R' -> R
+            tmp.mul_by_constant(params->from_domain);
+            std::vector<fp> out(count);
+            for (std::size_t e = 0; e < count; e++) {
+                // carry out the limbs into a 448-bit integer, then reduce from [0, 2p)
+                std::array<std::uint64_t, 7> acc {};
+                for (std::size_t j = 0; j < params->limbs; j++) {
+                    std::uint64_t v = tmp.data[(e / params->lanes) * block_size() + j * params->lanes +
+                                               e % params->lanes];
+                    std::size_t bit = j * params->limb_bits;
+                    uint128_t s = uint128_t(acc[bit / 64]) + (v << (bit % 64));
+                    acc[bit / 64] = std::uint64_t(s);
+                    std::uint64_t carry = std::uint64_t(s >> 64) + (bit % 64 == 0 ? 0 : v >> (64 - bit % 64));
+                    for (std::size_t k = bit / 64 + 1; carry != 0 && k < acc.size(); k++) {
+                        uint128_t c = uint128_t(acc[k]) + carry;
+                        acc[k] = std::uint64_t(c);
+                        carry = std::uint64_t(c >> 64);
+                    }
+                }
+                limbs_type l;
+                for (std::size_t k = 0; k < 6; k++) {
+                    l[k] = acc[k];
+                }
+                if (acc[6] != 0 || limbs_geq(l, FP_MODULUS)) {
+                    limbs_sub(l, l, FP_MODULUS);
+                }
+                out[e].limbs = l;
+            }
+            return out;
+        }
+
+        fp_batch &operator*=(const fp_batch &other) {
+            if (params == nullptr) {
+                for (std::size_t e = 0; e < count; e++) {
+                    scalar[e] *= other.scalar[e];
+                }
+                return *this;
+            }
+            for (std::size_t blk = 0; blk < blocks; blk++) {
+                std::uint64_t *x = data.data() + blk * block_size();
+                params->mont_mul(x, x, other.data.data() + blk * block_size());
+            }
+            return *this;
+        }
+
+        friend fp_batch operator*(fp_batch a, const fp_batch &b) {
+            return a *= b;
+        }
+
+        friend fp_batch square(fp_batch a) {
+            a.square_in_place();
+            return a;
+        }
+
+        // every element raised to e (little-endian limbs)
+        template<std::size_t L>
+        friend fp_batch pow(const fp_batch &a, const std::array<std::uint64_t, L> &e) {
+            fp_batch out = a;
+            out.fill_one();
+            for (std::size_t i = L; i-- > 0;) {
+                for (std::size_t j = 64; j-- > 0;) {
+                    out.square_in_place();
+                    if ((e[i] >> j) & 1) {
+                        out *= a;
+                    }
+                }
+            }
+            return out;
+        }
+
+    private:
+        std::size_t block_size() const {
+            return params->lanes * params->limbs;
+        }
+
+        void mul_by_constant(const std::vector<std::uint64_t> &c) {
+            std::vector<std::uint64_t> b(block_size());
+            for (std::size_t j = 0; j < params->limbs; j++) {
+                for (std::size_t l = 0; l < params->lanes; l++) {
+                    b[j * params->lanes + l] = c[j];
+                }
+            }
+            for (std::size_t blk = 0; blk < blocks; blk++) {
+                std::uint64_t *x = data.data() + blk * block_size();
+                params->mont_mul(x, x, b.data());
+            }
+        }
+
+        void square_in_place() {
+            if (params == nullptr) {
+                for (fp &x : scalar) {
+                    x = native::square(x);
+                }
+                return;
+            }
+            // the kernels read all of their inputs before writing out
+            for (std::size_t blk = 0; blk < blocks; blk++) {
+                std::uint64_t *x = data.data() + blk * block_size();
+                params->mont_mul(x, x, x);
+            }
+        }
+
+        void fill_one() {
+            if (params == nullptr) {
+                scalar.assign(count, fp::one());
+                return;
+            }
+            // one in the R' form is 2^{log R'} mod p, which is how fp stores 2^{log R' - 384}
+            fp one = pow(fp_from_u64(2), params->limbs * params->limb_bits - 384);
+            std::vector<std::uint64_t> limbs = fp_simd_split(one.limbs, params->limbs, params->limb_bits);
+            for (std::size_t blk = 0; blk < blocks; blk++) {
+                for (std::size_t j = 0; j < params->limbs; j++) {
+                    for (std::size_t l = 0; l < params->lanes; l++) {
+                        data[blk * block_size() + j * params->lanes + l] = limbs[j];
+                    }
+                }
+            }
+        }
+
+        const fp_simd_parameters *params;
+        std::size_t count;
+        std::size_t blocks = 0;
+        std::vector<std::uint64_t> data;
+        std::vector<fp> scalar;
+    };
+
+    // out[i] = a[i] * b[i] on the widest available backend
+    inline std::vector<fp> fp_mul_many(const std::vector<fp> &a, const std::vector<fp> &b,
+                                       fp_simd_backend backend = fp_simd_default_backend()) {
+        return (fp_batch(a, backend) * fp_batch(b, backend)).values();
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_FP_SIMD_HPP
@@ -0,0 +1,308 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_FR_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_FR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+
+/*
+ * Native arithmetic over the scalar field of BN254, the native field of the
+ * circuits (every signal, and so every Poseidon input and output, is an
+ * element of it). Four 64-bit limbs in Montgomery form (R = 2^256); the
+ * operations are constexpr so constant tables can be written as canonical
+ * hex and converted at compile time, as in register_tables.hpp.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    using fr_limbs_type = std::array<std::uint64_t, 4>;
+
+    // r = 0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001
+    constexpr static const fr_limbs_type FR_MODULUS = {0x43e1f593f0000001, 0x2833e84879b97091, 0xb85045b68181585d,
+                                                       0x30644e72e131a029};
+    // -r^{-1} mod 2^64
+    constexpr static const std::uint64_t FR_INV = 0xc2e1f593efffffff;
+    // R mod r, i.e. one in Montgomery form
+    constexpr static const fr_limbs_type FR_R = {0xac96341c4ffffffb, 0x36fc76959f60cd29, 0x666ea36f7879462e,
+                                                 0x0e0a77c19a07df2f};
+    // R^2 mod r, used to move canonical integers into Montgomery form
+    constexpr static const fr_limbs_type FR_R2 = {0x1bb8e645ae216da7, 0x53fe3ab1e35c59e3, 0x8c49833d53bb8085,
+                                                  0x0216d0b17f4e44a5};
+
+    // a >= b as 256-bit integers
+    constexpr bool fr_limbs_geq(const fr_limbs_type &a, const fr_limbs_type &b) {
+        for (std::size_t i = 4; i-- > 0;) {
+            if (a[i] != b[i]) {
+                return a[i] > b[i];
+            }
+        }
+        return true;
+    }
+
+    // out = a - b, returns the borrow
+    constexpr std::uint64_t fr_limbs_sub(fr_limbs_type &out, const fr_limbs_type &a, const fr_limbs_type &b) {
+        std::uint64_t borrow = 0;
+        for (std::size_t i = 0; i < 4; i++) {
+            uint128_t d = uint128_t(a[i]) - b[i] - borrow;
+            out[i] = std::uint64_t(d);
+            borrow = std::uint64_t(d >> 64) & 1;
+        }
+        return borrow;
+    }
+
+    // out = a + b; r < 2^254, so the sum of two reduced values never carries out
+    constexpr void fr_limbs_add(fr_limbs_type &out, const fr_limbs_type &a, const fr_limbs_type &b) {
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < 4; i++) {
+            uint128_t s = uint128_t(a[i]) + b[i] + carry;
+            out[i] = std::uint64_t(s);
+            carry = std::uint64_t(s >> 64);
+        }
+    }
+
+    // Element of Fr in Montgomery form, limbs are little-endian and always < r
+    struct fr {
+        fr_limbs_type limbs;
+
+        static constexpr fr zero() {
+            return fr {{0, 0, 0, 0}};
+        }
+
+        static constexpr fr one() {
+            return fr {FR_R};
+        }
+
+        constexpr bool is_zero() const {
+            return (limbs[0] | limbs[1] | limbs[2] | limbs[3]) == 0;
+        }
+
+        constexpr bool operator==(const fr &other) const {
+            return limbs == other.limbs;
+        }
+
+        constexpr bool operator!=(const fr &other) const {
+            return limbs != other.limbs;
+        }
+    };
+
+    // a * b * R^{-1} mod r, interleaved (CIOS) Montgomery multiplication
+    constexpr fr_limbs_type fr_montgomery_mul(const fr_limbs_type &a, const fr_limbs_type &b) {
+        std::array<std::uint64_t, 6> t {};
+        for (std::size_t i = 0; i < 4; i++) {
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; j < 4; j++) {
+                uint128_t s = uint128_t(a[j]) * b[i] + t[j] + carry;
+                t[j] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            uint128_t s = uint128_t(t[4]) + carry;
+            t[4] = std::uint64_t(s);
+            t[5] = std::uint64_t(s >> 64);
+
+            std::uint64_t m = t[0] * FR_INV;
+            s = uint128_t(m) * FR_MODULUS[0] + t[0];
+            carry = std::uint64_t(s >> 64);
+            for (std::size_t j = 1; j < 4; j++) {
+                s = uint128_t(m) * FR_MODULUS[j] + t[j] + carry;
+                t[j - 1] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            s = uint128_t(t[4]) + carry;
+            t[3] = std::uint64_t(s);
+            t[4] = t[5] + std::uint64_t(s >> 64);
+        }
+        fr_limbs_type out = {t[0], t[1], t[2], t[3]};
+        if (t[4] != 0 || fr_limbs_geq(out, FR_MODULUS)) {
+            fr_limbs_sub(out, out, FR_MODULUS);
+        }
+        return out;
+    }
+
+    constexpr fr operator+(const fr &a, const fr &b) {
+        fr out {};
+        fr_limbs_add(out.limbs, a.limbs, b.limbs);
+        if (fr_limbs_geq(out.limbs, FR_MODULUS)) {
+            fr_limbs_sub(out.limbs, out.limbs, FR_MODULUS);
+        }
+        return out;
+    }
+
+    constexpr fr operator-(const fr &a, const fr &b) {
+        fr out {};
+        if (fr_limbs_sub(out.limbs, a.limbs, b.limbs) != 0) {
+            fr_limbs_add(out.limbs, out.limbs, FR_MODULUS);
+        }
+        return out;
+    }
+
+    constexpr fr operator-(const fr &a) {
+        return fr::zero() - a;
+    }
+
+    constexpr fr operator*(const fr &a, const fr &b) {
+        return fr {fr_montgomery_mul(a.limbs, b.limbs)};
+    }
+
+    constexpr fr &operator+=(fr &a, const fr &b) {
+        return a = a + b;
+    }
+
+    constexpr fr &operator-=(fr &a, const fr &b) {
+        return a = a - b;
+    }
+
+    constexpr fr &operator*=(fr &a, const fr &b) {
+        return a = a * b;
+    }
+
+    constexpr fr square(const fr &a) {
+        return a * a;
+    }
+
+    // Unreduced sum of double-width products, 9 limbs; fr_reduce performs the single Montgomery
+    // reduction of the whole sum, as fp_wide does for Fp
+    struct fr_wide {
+        std::array<std::uint64_t, 9> limbs;
+
+        static constexpr fr_wide zero() {
+            return fr_wide {{}};
+        }
+    };
+
+    // acc += a * b
+    inline void fr_mul_accumulate(fr_wide &acc, const fr &a, const fr &b) {
+        std::array<std::uint64_t, 8> t {};
+        for (std::size_t i = 0; i < 4; i++) {
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; j < 4; j++) {
+                uint128_t s = uint128_t(a.limbs[i]) * b.limbs[j] + t[i + j] + carry;
+                t[i + j] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            t[i + 4] = carry;
+        }
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < 8; i++) {
+            uint128_t s = uint128_t(acc.limbs[i]) + t[i] + carry;
+            acc.limbs[i] = std::uint64_t(s);
+            carry = std::uint64_t(s >> 64);
+        }
+        acc.limbs[8] += carry;
+    }
+
+    // acc R^{-1} mod r. acc is first moved below r R by multiples of r R, which do not
+    // change the result, then reduced once.
+    inline fr fr_reduce(fr_wide acc) {
+        for (;;) {
+            fr_limbs_type high = {acc.limbs[4], acc.limbs[5], acc.limbs[6], acc.limbs[7]};
+            if (acc.limbs[8] == 0 && !fr_limbs_geq(high, FR_MODULUS)) {
+                break;
+            }
+            std::uint64_t borrow = fr_limbs_sub(high, high, FR_MODULUS);
+            for (std::size_t i = 0; i < 4; i++) {
+                acc.limbs[i + 4] = high[i];
+            }
+            acc.limbs[8] -= borrow;
+        }
+        std::uint64_t carry_hi = 0;
+        for (std::size_t i = 0; i < 4; i++) {
+            std::uint64_t m = acc.limbs[i] * FR_INV;
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; j < 4; j++) {
+                uint128_t s = uint128_t(m) * FR_MODULUS[j] + acc.limbs[i + j] + carry;
+                acc.limbs[i + j] = std::uint64_t(s);
+                carry = std::uint64_t(s >> 64);
+            }
+            uint128_t s = uint128_t(acc.limbs[i + 4]) + carry + carry_hi;
+            acc.limbs[i + 4] = std::uint64_t(s);
+            carry_hi = std::uint64_t(s >> 64);
+        }
+        fr out {{acc.limbs[4], acc.limbs[5], acc.limbs[6], acc.limbs[7]}};
+        if (carry_hi != 0 || fr_limbs_geq(out.limbs, FR_MODULUS)) {
+            fr_limbs_sub(out.limbs, out.limbs, FR_MODULUS);
+        }
+        return out;
+    }
+
+    // a^e for an exponent given as little-endian limbs
+    template<std::size_t L>
+    constexpr fr pow(const fr &a, const std::array<std::uint64_t, L> &e) {
+        fr out = fr::one();
+        for (std::size_t i = L * 64; i-- > 0;) {
+            out = square(out);
+            if ((e[i / 64] >> (i % 64)) & 1) {
+                out *= a;
+            }
+        }
+        return out;
+    }
+
+    // a^{r - 2}; zero maps to zero
+    constexpr fr inverse(const fr &a) {
+        fr_limbs_type e {};
+        fr_limbs_sub(e, FR_MODULUS, {2, 0, 0, 0});
+        return pow(a, e);
+    }
+
+    // Montgomery form of a canonical integer in [0, r)
+    constexpr fr fr_from_limbs(const fr_limbs_type &canonical) {
+        return fr {fr_montgomery_mul(canonical, FR_R2)};
+    }
+
+    constexpr fr fr_from_u64(std::uint64_t v) {
+        return fr_from_limbs({v, 0, 0, 0});
+    }
+
+    // canonical integer in [0, r)
+    constexpr fr_limbs_type fr_to_limbs(const fr &a) {
+        return fr_montgomery_mul(a.limbs, {1, 0, 0, 0});
+    }
+
+    // canonical element from big-endian hex digits with an 0x prefix
+    constexpr fr fr_from_hex(std::string_view hex) {
+        if (hex.size() < 3 || hex.size() > 66 || hex[0] != '0' || hex[1] != 'x') {
+            throw std::invalid_argument("fr_from_hex: expected 0x followed by at most 64 digits");
+        }
+        hex.remove_prefix(2);
+        fr_limbs_type out {};
+        for (std::size_t i = 0; i < hex.size(); i++) {
+            char c = hex[hex.size() - 1 - i];
+            if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
+                throw std::invalid_argument("fr_from_hex: not a hex digit");
+            }
+            std::uint64_t digit = (c <= '9') ? c - '0' : c - 'a' + 10;
+            out[i / 16] |= digit << (4 * (i % 16));
+        }
+        if (fr_limbs_geq(out, FR_MODULUS)) {
+            throw std::invalid_argument("fr_from_hex: value is not reduced");
+        }
+        return fr_from_limbs(out);
+    }
+
+    // 32-byte little-endian encoding, the byte order of the Num2Bits / Bits2Num packing
+    inline void fr_to_bytes_le(const fr &a, std::uint8_t *out) {
+        fr_limbs_type l = fr_to_limbs(a);
+        for (std::size_t i = 0; i < 32; i++) {
+            out[i] = std::uint8_t(l[i / 8] >> (8 * (i % 8)));
+        }
+    }
+
+    // a 32-byte little-endian encoding of an element in [0, r)
+    inline fr fr_from_bytes_le(const std::uint8_t *in) {
+        fr_limbs_type l {};
+        for (std::size_t i = 0; i < 32; i++) {
+            l[i / 8] |= std::uint64_t(in[i]) << (8 * (i % 8));
+        }
+        if (fr_limbs_geq(l, FR_MODULUS)) {
+            throw std::invalid_argument("fr_from_bytes_le: value is not reduced");
+        }
+        return fr_from_limbs(l);
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_FR_HPP
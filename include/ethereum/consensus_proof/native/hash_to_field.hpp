@@ -0,0 +1,103 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_FIELD_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_FIELD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/sha256.hpp>
+
+/*
+ * Native hash_to_field for BLS12-381 G2 with expand_message_xmd(SHA-256),
+ * the out-of-circuit twin of HashToField / ExpandMessageXMD in
+ * hash_to_field.hpp. The domain separation tag is the one in constants.hpp.
+ * The constant parts of the expand_message_xmd hashes are not recompressed:
+ * b_0 starts from the midstate of its zero block Z_pad, and the DST_prime
+ * blocks shared by all b_i have their message schedules computed once.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    // "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_", DOMAIN_SEPERATOR_TAG
+    constexpr static const std::array<std::uint8_t, 43> HASH_TO_G2_DST = {
+        66, 76, 83, 95, 83, 73, 71, 95, 66, 76, 83, 49, 50, 51, 56, 49, 71, 50, 95, 88, 77, 68,
+        58, 83, 72, 65, 45, 50, 53, 54, 95, 83, 83, 87, 85, 95, 82, 79, 95, 80, 79, 80, 95};
+
+    inline std::vector<std::uint8_t> expand_message_xmd(const std::uint8_t *msg, std::size_t msg_len,
+                                                        const std::uint8_t *dst, std::size_t dst_len,
+                                                        std::size_t len_in_bytes) {
+        constexpr std::size_t b_in_bytes = 32;
+        constexpr std::size_t r_in_bytes = 64;
+        std::size_t ell = (len_in_bytes + b_in_bytes - 1) / b_in_bytes;
+        if (ell > 255 || dst_len > 255 || len_in_bytes > 65535) {
+            throw std::invalid_argument("expand_message_xmd: invalid xmd length");
+        }
+        std::uint8_t dst_len_byte = std::uint8_t(dst_len);
+
+        // b_0 = sha256(Z_pad || msg || l_i_b_str || i2osp(0, 1) || DST_prime); Z_pad is one zero
+        // block, so the hash resumes from its midstate instead of compressing it
+        sha256_hasher h0(SHA256_ZERO_BLOCK_MIDSTATE, r_in_bytes);
+        h0.update(msg, msg_len);
+        std::array<std::uint8_t, 3> l_i_b_str = {std::uint8_t(len_in_bytes >> 8), std::uint8_t(len_in_bytes), 0};
+        h0.update(l_i_b_str);
+        h0.update(dst, dst_len);
+        h0.update(&dst_len_byte, 1);
+        bytes32 b0 = h0.finalize();
+
+        // b_i = sha256((b_0 XOR b_{i-1}) || i2osp(i, 1) || DST_prime), b_{0} XOR b_{-1} := b_0.
+        // Only the first 33 bytes depend on i and they sit in the first block, so the padded
+        // DST_prime tail blocks are the same for every b_i and their schedules are computed once.
+        std::size_t bi_len = b_in_bytes + 1 + dst_len + 1;
+        std::vector<std::uint8_t> bi_message((bi_len + 9 + 63) / 64 * 64, 0);
+        std::copy(dst, dst + dst_len, bi_message.begin() + b_in_bytes + 1);
+        bi_message[bi_len - 1] = dst_len_byte;
+        bi_message[bi_len] = 0x80;
+        for (std::size_t j = 0; j < 8; j++) {
+            bi_message[bi_message.size() - 1 - j] = std::uint8_t((std::uint64_t(bi_len) * 8) >> (8 * j));
+        }
+        std::vector<sha256_schedule_type> bi_tail;
+        for (std::size_t block = 64; block < bi_message.size(); block += 64) {
+            bi_tail.push_back(sha256_schedule(bi_message.data() + block));
+        }
+
+        std::vector<std::uint8_t> out;
+        out.reserve(ell * b_in_bytes);
+        bytes32 prev {};
+        for (std::size_t i = 1; i <= ell; i++) {
+            for (std::size_t j = 0; j < b_in_bytes; j++) {
+                bi_message[j] = (i == 1) ? b0[j] : std::uint8_t(b0[j] ^ prev[j]);
+            }
+            bi_message[b_in_bytes] = std::uint8_t(i);
+            sha256_state_type state = SHA256_IV;
+            sha256_compress(state, bi_message.data());
+            for (const sha256_schedule_type &kw : bi_tail) {
+                sha256_compress_schedule(state, kw);
+            }
+            prev = sha256_digest(state);
+            out.insert(out.end(), prev.begin(), prev.end());
+        }
+        out.resize(len_in_bytes);
+        return out;
+    }
+
+    // hash_to_field(msg, 2) over Fp2 with L = 64, i.e. u[0], u[1] of HashToField
+    inline std::array<fp2, 2> hash_to_field(const std::uint8_t *msg, std::size_t msg_len) {
+        const std::size_t count = 2, m = 2, l = 64;
+        std::vector<std::uint8_t> bytes =
+            expand_message_xmd(msg, msg_len, HASH_TO_G2_DST.data(), HASH_TO_G2_DST.size(), count * m * l);
+        std::array<fp2, 2> out;
+        for (std::size_t i = 0; i < count; i++) {
+            out[i].c0 = fp_from_bytes_be_wide(bytes.data() + (i * m + 0) * l);
+            out[i].c1 = fp_from_bytes_be_wide(bytes.data() + (i * m + 1) * l);
+        }
+        return out;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_FIELD_HPP
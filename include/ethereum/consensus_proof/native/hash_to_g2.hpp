@@ -0,0 +1,333 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_G2_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_G2_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/addition_chain.hpp>
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/register_tables.hpp>
+
+/*
+ * Native MapToG2 following pairing/bls12_381_hash_to_G2.hpp step by step:
+ * optimized simplified SWU onto the 3-isogenous curve
+ * E2': y^2 = x^3 + 240 u x + 1012 (1 + u), point addition on E2', the
+ * 3-isogeny to E2 and cofactor clearing with psi / psi2. Constants are the
+ * ones of get_roots_of_unity, get_etas and get_iso3_coeffs, read from the
+ * tables of register_tables.hpp.
+ *
+ * The points are kept in Jacobian coordinates throughout, SWU included, so
+ * H(m) costs one inversion; the SWU candidate selection, its exceptional
+ * case and the sign fix are branch-free. The circuit computes the same
+ * points in affine coordinates, and map_to_g2_trace recovers all of them
+ * with one batched inversion.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    inline fp2 e2_prime_a() {
+        return {fp::zero(), fp_from_u64(240)};
+    }
+
+    inline fp2 e2_prime_b() {
+        return {fp_from_u64(1012), fp_from_u64(1012)};
+    }
+
+    // distinguished non-square xi = -2 - u of the SWU map
+    inline fp2 swu_xi() {
+        return {-fp_from_u64(2), -fp::one()};
+    }
+
+    // 1, u, (rv, rv), (rv, -rv) with rv = 1 / sqrt(2): the 8th roots of unity checked by OptSimpleSWU2
+    inline const std::array<fp2, 4> &swu_roots_of_unity() {
+        static const std::array<fp2, 4> roots = fp2_from_limbs_table(bls12_381_limbs::roots_of_unity);
+        return roots;
+    }
+
+    // eta with eta^2 = xi^3 * (-1)^{-1/4}, get_etas
+    inline const std::array<fp2, 4> &swu_etas() {
+        static const std::array<fp2, 4> etas = fp2_from_limbs_table(bls12_381_limbs::etas);
+        return etas;
+    }
+
+    // coeffs[0] = x_num, coeffs[1] = x_den, coeffs[2] = y_num, coeffs[3] = y_den, lowest degree first;
+    // taken from E.3 of the hash-to-curve draft, as get_iso3_coeffs
+    inline const std::array<std::array<fp2, 4>, 4> &iso3_coefficients() {
+        static const std::array<std::array<fp2, 4>, 4> coeffs = [] {
+            std::array<std::array<fp2, 4>, 4> out;
+            for (std::size_t i = 0; i < 4; i++) {
+                out[i] = fp2_from_limbs_table(bls12_381_limbs::iso3_coeffs[i]);
+            }
+            return out;
+        }();
+        return coeffs;
+    }
+
+    // (p^2 - 9) / 16
+    constexpr static const auto SWU_SQRT_RATIO_CHAIN = make_addition_chain<5>(std::array<std::uint64_t, 12> {
+        0xb26aa00001c718e3, 0xd7ced6b1d76382ea, 0x3162c338362113cf, 0x966bf91ed3e71b74, 0xb292e85a87091a04,
+        0x11d68619c86185c7, 0xef53149330978ef0, 0x050a62cfd16ddca6, 0x466e59e49349e8bd, 0x9e2dc90e50e7046b,
+        0x74bd278eaa22f25e, 0x002a437a4b8c35fc});
+
+    // OptSimpleSWU2 before its single division: X0 = x0_num / x0_den, X1 = xi t^2 X0 and Y
+    struct swu_point {
+        fp2 x0_num;
+        fp2 x0_den;
+        fp2 xi_t_sq;
+        fp2 y;
+        // isSquare: g(X0) is a square and the point is (X0, Y), otherwise it is (X1, Y)
+        bool is_square;
+
+        // (x_num / x_den, y) as (x_num x_den, y x_den^3, x_den)
+        jacobian_point<fp2> to_jacobian() const {
+            fp2 x_num = select(xi_t_sq * x0_num, x0_num, is_square);
+            fp2 x_den_sq = square(x0_den);
+            return {x_num * x0_den, y * x_den_sq * x0_den, x0_den};
+        }
+    };
+
+    // OptSimpleSWU2 without inversions and without branches on t. g(X0) = u / v is kept as a
+    // fraction and its square root candidate is (u / v)^{(p^2 + 7) / 16} = u v^7 (u v^15)^{(p^2 - 9) / 16}
+    // (the p^2 = 9 mod 16 case of sqrt_ratio in the hash-to-curve draft). Every root of unity and
+    // eta is tried and the results are combined with select, as are the exceptional denominator
+    // and the sign of Y.
+    inline swu_point opt_simple_swu2_projective(const fp2 &t) {
+        // no short-circuit, so a comparison costs the same whatever the operands
+        auto is_zero = [](const fp2 &x) {
+            std::uint64_t acc = 0;
+            for (std::size_t i = 0; i < 6; i++) {
+                acc |= x.c0.limbs[i] | x.c1.limbs[i];
+            }
+            return acc == 0;
+        };
+        fp2 a = e2_prime_a();
+        fp2 b = e2_prime_b();
+        fp2 xi = swu_xi();
+
+        swu_point out;
+        fp2 t_sq = square(t);
+        out.xi_t_sq = xi * t_sq;
+        fp2 num_den_common = square(out.xi_t_sq) + out.xi_t_sq;
+
+        // X0(t) = b (xi^2 t^4 + xi t^2 + 1) / (-a (xi^2 t^4 + xi t^2)); exceptional denominator -> a * xi
+        out.x0_num = b * (num_den_common + fp2::one());
+        out.x0_den = -(a * num_den_common);
+        out.x0_den = select(out.x0_den, a * xi, is_zero(out.x0_den));
+
+        // g(X0) = u / v, u = x0_num^3 + a x0_num x0_den^2 + b x0_den^3, v = x0_den^3
+        fp2 den_sq = square(out.x0_den);
+        fp2 v = den_sq * out.x0_den;
+        fp2 u = (square(out.x0_num) + a * den_sq) * out.x0_num + b * v;
+        fp2 v_sq = square(v);
+        fp2 v_7 = square(v_sq) * v_sq * v;
+        fp2 v_15 = v_7 * v_7 * v;
+        fp2 sqrt_candidate = u * v_7 * pow(u * v_15, SWU_SQRT_RATIO_CHAIN);
+
+        // Y^2 v == u for g(X0), Y^2 v == xi^3 t^6 u for g(X1) = xi^3 t^6 g(X0)
+        fp2 y0 = fp2::zero();
+        bool is_square = false;
+        for (const fp2 &root : swu_roots_of_unity()) {
+            fp2 candidate = sqrt_candidate * root;
+            bool ok = is_zero(square(candidate) * v - u);
+            y0 = select(y0, candidate, ok);
+            is_square |= ok;
+        }
+        fp2 y1 = fp2::zero();
+        bool is_square1 = false;
+        fp2 sqrt_candidate1 = sqrt_candidate * t_sq * t;
+        fp2 u1 = square(out.xi_t_sq) * out.xi_t_sq * u;
+        for (const fp2 &eta : swu_etas()) {
+            fp2 candidate = sqrt_candidate1 * eta;
+            bool ok = is_zero(square(candidate) * v - u1);
+            y1 = select(y1, candidate, ok);
+            is_square1 |= ok;
+        }
+        if (!(is_square | is_square1)) {
+            throw std::logic_error("opt_simple_swu2: neither g(X0) nor g(X1) is a square");
+        }
+        out.is_square = is_square;
+        out.y = select(y1, y0, is_square);
+
+        // sgn0(Y) == sgn0(t)
+        out.y = select(out.y, -out.y, sgn0(out.y) != sgn0(t));
+        return out;
+    }
+
+    // OptSimpleSWU2: t -> point on E2'
+    inline g2_point opt_simple_swu2(const fp2 &t) {
+        return to_affine(opt_simple_swu2_projective(t).to_jacobian());
+    }
+
+    // Iso3Map on Jacobian coordinates. With x = X / Z^2 every polynomial is evaluated times
+    // Z^6, so x = x_num / x_den and y = Y y_num / (Z^3 y_den) need no inversion. A pole of the
+    // isogeny gives Z = 0, the point at infinity, as isInfinity of the circuit.
+    inline jacobian_point<fp2> iso3_map(const jacobian_point<fp2> &p) {
+        if (p.is_infinity()) {
+            return p;
+        }
+        const std::array<std::array<fp2, 4>, 4> &coeffs = iso3_coefficients();
+        // z_pow[j] = Z^{2 j}
+        std::array<fp2, 4> z_pow;
+        z_pow[0] = fp2::one();
+        z_pow[1] = square(p.z);
+        z_pow[2] = square(z_pow[1]);
+        z_pow[3] = z_pow[2] * z_pow[1];
+        std::array<fp2, 4> values;
+        for (std::size_t i = 0; i < 4; i++) {
+            values[i] = coeffs[i][3];
+            for (std::size_t j = 3; j-- > 0;) {
+                values[i] = values[i] * p.x + coeffs[i][j] * z_pow[3 - j];
+            }
+        }
+        fp2 x_den = values[1];
+        fp2 y_den = values[3] * z_pow[1] * p.z;
+        fp2 z = x_den * y_den;
+        fp2 x_den_y_den_sq = z * y_den;
+        return {values[0] * x_den_y_den_sq, p.y * values[2] * square(x_den) * x_den_y_den_sq, z};
+    }
+
+    // Iso3Map: E2' -> E2, (x, y) -> (x_num / x_den, y * y_num / y_den)
+    inline g2_point iso3_map(const g2_point &p) {
+        return to_affine(iso3_map(jacobian_point<fp2>::from_affine(p)));
+    }
+
+    // The affine signals of G2 points that MapToG2 (pairing/bls12_381_hash_to_G2.hpp) sets by
+    // witness computation, i.e. the outputs of its divisions, additions and doublings
+    struct swu_trace {
+        fp2 x0;
+        fp2 x1;
+        bool is_square;
+        g2_point out;
+    };
+
+    // EllipticCurveScalarMultiplyFp2 by |x| (64 bits): partial[j] = R[63 - j], doubled[j] = Pdouble[62 - j].out
+    struct g2_scalar_mul_trace {
+        std::vector<g2_point> doubled;
+        std::vector<g2_point> partial;
+    };
+
+    struct clear_cofactor_trace {
+        g2_scalar_mul_trace x_p;
+        g2_point psi_p;
+        g2_point dbl_p;
+        g2_point psi2_dbl_p;
+        // add[0 .. 5).out
+        std::array<g2_point, 5> add;
+        g2_scalar_mul_trace x_add1;
+    };
+
+    struct map_to_g2_trace {
+        std::array<swu_trace, 2> swu;
+        // Rp.out on E2' and R.out of Iso3Map
+        g2_point sum;
+        g2_point iso;
+        clear_cofactor_trace clear_cofactor;
+        g2_point out;
+    };
+
+    // ClearCofactorG2 on Jacobian coordinates: [|x|^2 + |x| - 1] P + [-|x| - 1] psi(P) + psi2(2 P).
+    // If steps is given, every point the circuit computes is appended to it, in the order
+    // x_p, psi_p, dbl_p, psi2_dbl_p, add[0], add[1], x_add1, add[2], add[3], add[4], where
+    // a scalar multiplication contributes its partial results and then its doublings.
+    inline jacobian_point<fp2> clear_cofactor_g2(const jacobian_point<fp2> &p,
+                                                 std::vector<jacobian_point<fp2>> *steps = nullptr) {
+        std::vector<jacobian_point<fp2>> doubled;
+        auto mul_by_x = [&](const jacobian_point<fp2> &q) {
+            doubled.clear();
+            jacobian_point<fp2> out =
+                scalar_mul_jacobian(q, BLS12_381_X_ABS, steps != nullptr ? &doubled : nullptr, steps);
+            if (steps != nullptr) {
+                steps->insert(steps->end(), doubled.begin(), doubled.end());
+            }
+            return out;
+        };
+        auto step = [&](const jacobian_point<fp2> &q) {
+            if (steps != nullptr) {
+                steps->push_back(q);
+            }
+            return q;
+        };
+        jacobian_point<fp2> neg_p = {p.x, -p.y, p.z};
+        jacobian_point<fp2> x_p = mul_by_x(p);
+        jacobian_point<fp2> psi_p = step(psi(p));
+        jacobian_point<fp2> neg_psi_p = {psi_p.x, -psi_p.y, psi_p.z};
+        jacobian_point<fp2> psi2_dbl_p = psi2(step(dbl(p)));
+        step(psi2_dbl_p);
+        jacobian_point<fp2> add1 = step(add(step(add(x_p, p)), neg_psi_p));
+        jacobian_point<fp2> x_add1 = mul_by_x(add1);
+        jacobian_point<fp2> add3 = step(add(step(add(x_add1, neg_p)), neg_psi_p));
+        return step(add(add3, psi2_dbl_p));
+    }
+
+    // ClearCofactorG2: [|x|^2 + |x| - 1] P + [-|x| - 1] psi(P) + psi2(2 P)
+    inline g2_point clear_cofactor_g2(const g2_point &p) {
+        return to_affine(clear_cofactor_g2(jacobian_point<fp2>::from_affine(p)));
+    }
+
+    // MapToG2: u[0], u[1] from hash_to_field -> H(m) in G2. Everything up to the result stays in
+    // Jacobian coordinates, so there is one inversion. With trace, the affine intermediate points
+    // are recovered afterwards from one batched inversion; they are the same points the circuit
+    // computes in affine coordinates, hence exactly its witness.
+    inline g2_point map_to_g2(const std::array<fp2, 2> &u, map_to_g2_trace *trace = nullptr) {
+        std::array<swu_point, 2> q = {opt_simple_swu2_projective(u[0]), opt_simple_swu2_projective(u[1])};
+        jacobian_point<fp2> sum = add(q[0].to_jacobian(), q[1].to_jacobian(), e2_prime_a());
+        jacobian_point<fp2> iso = iso3_map(sum);
+        if (trace == nullptr) {
+            return to_affine(clear_cofactor_g2(iso));
+        }
+
+        // (X0, Y) of both SWU points, Rp, R, then the steps of ClearCofactorG2
+        std::vector<jacobian_point<fp2>> points;
+        for (const swu_point &qi : q) {
+            points.push_back({qi.x0_num * qi.x0_den, qi.y * square(qi.x0_den) * qi.x0_den, qi.x0_den});
+        }
+        points.push_back(sum);
+        points.push_back(iso);
+        clear_cofactor_g2(iso, &points);
+        std::vector<g2_point> affine = batch_to_affine(points);
+
+        for (std::size_t i = 0; i < 2; i++) {
+            swu_trace &out = trace->swu[i];
+            out.x0 = affine[i].x;
+            out.x1 = q[i].xi_t_sq * out.x0;
+            out.is_square = q[i].is_square;
+            out.out = {out.is_square ? out.x0 : out.x1, affine[i].y, false};
+        }
+        trace->sum = affine[2];
+        trace->iso = affine[3];
+
+        auto next = affine.begin() + 4;
+        auto take = [&next]() {
+            return *next++;
+        };
+        auto take_scalar_mul = [&next](g2_scalar_mul_trace &out) {
+            std::size_t bit_length = std::bit_width(BLS12_381_X_ABS);
+            out.partial.assign(next, next + bit_length);
+            next += bit_length;
+            out.doubled.assign(next, next + bit_length - 1);
+            next += bit_length - 1;
+        };
+        clear_cofactor_trace &cc = trace->clear_cofactor;
+        take_scalar_mul(cc.x_p);
+        cc.psi_p = take();
+        cc.dbl_p = take();
+        cc.psi2_dbl_p = take();
+        cc.add[0] = take();
+        cc.add[1] = take();
+        take_scalar_mul(cc.x_add1);
+        cc.add[2] = take();
+        cc.add[3] = take();
+        cc.add[4] = take();
+        trace->out = cc.add[4];
+        return trace->out;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_G2_HPP
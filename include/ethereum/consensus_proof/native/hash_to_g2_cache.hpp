@@ -0,0 +1,86 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_G2_CACHE_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_G2_CACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/hash_to_field.hpp>
+#include <ethereum/consensus_proof/native/hash_to_g2.hpp>
+#include <ethereum/consensus_proof/native/pairing.hpp>
+#include <ethereum/consensus_proof/native/lru_cache.hpp>
+
+/*
+ * Hash-to-G2 results keyed by signing root. Every sync committee member
+ * signs the same root for a slot, and the same update reaches a light client
+ * from several peers, so hash_to_field, MapToG2 and (optionally) the G2 half
+ * of the Miller loop lines are computed once per root. Lookups are a single
+ * hash table probe, eviction is least recently used and O(1) (lru_cache).
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    struct hash_to_g2_entry {
+        std::array<fp2, 2> hash_to_field;
+        g2_point hm;
+        // the MapToG2 witness for hm
+        map_to_g2_trace hm_trace;
+        // prepare_g2_lines(hm) when the cache prepares lines, nullptr otherwise
+        std::shared_ptr<const g2_line_table> hm_lines;
+    };
+
+    inline hash_to_g2_entry make_hash_to_g2_entry(const bytes32 &signing_root, bool prepare_lines) {
+        hash_to_g2_entry out;
+        out.hash_to_field = hash_to_field(signing_root.data(), signing_root.size());
+        out.hm = map_to_g2(out.hash_to_field, &out.hm_trace);
+        if (prepare_lines) {
+            out.hm_lines = std::make_shared<const g2_line_table>(prepare_g2_lines(out.hm));
+        }
+        return out;
+    }
+
+    class hash_to_g2_cache {
+    public:
+        explicit hash_to_g2_cache(std::size_t capacity = 64, bool prepare_lines = true) :
+            cache(capacity), prepare_lines(prepare_lines) {
+        }
+
+        // the entry of this signing root if it is cached, nullptr otherwise
+        std::shared_ptr<const hash_to_g2_entry> find(const bytes32 &signing_root) {
+            return cache.find(signing_root);
+        }
+
+        // The entry of this signing root, hashed to G2 outside the lock on a miss. Two threads
+        // missing on the same root both compute it and the first insert wins.
+        std::shared_ptr<const hash_to_g2_entry> get(const bytes32 &signing_root) {
+            return cache.get(signing_root, [&] {
+                return std::make_shared<const hash_to_g2_entry>(make_hash_to_g2_entry(signing_root, prepare_lines));
+            });
+        }
+
+        std::size_t size() {
+            return cache.size();
+        }
+
+    private:
+        lru_cache<bytes32, hash_to_g2_entry, bytes32_hash> cache;
+        bool prepare_lines;
+    };
+
+    // CoreVerify of a signature over signing_root with H(signing_root) taken from the cache
+    inline bool core_verify_pubkey_g1(const g1_point &pubkey, const g2_point &signature, const bytes32 &signing_root,
+                                      hash_to_g2_cache &cache) {
+        std::shared_ptr<const hash_to_g2_entry> hm = cache.get(signing_root);
+        if (hm->hm_lines != nullptr) {
+            return core_verify_pubkey_g1(pubkey, signature, *hm->hm_lines);
+        }
+        return core_verify_pubkey_g1(pubkey, signature, hm->hm);
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_HASH_TO_G2_CACHE_HPP
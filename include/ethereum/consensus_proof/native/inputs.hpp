@@ -0,0 +1,159 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_INPUTS_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_INPUTS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+
+/*
+ * Native CommitToPublicInputsForStep. The commitment is the SHA-256 chain of
+ * inputs.hpp truncated to its first TRUNCATED_SHA256_SIZE bits, where bit
+ * i * 8 + j is bit j of byte i; publicInputsRoot is that bit string read as
+ * a little-endian integer, returned here as 32 little-endian bytes.
+ * step_public_inputs_hasher computes it in one pass over the fields.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    struct step_public_inputs {
+        bytes32 attested_slot;
+        bytes32 finalized_slot;
+        bytes32 finalized_header_root;
+        std::uint64_t participation;
+        bytes32 execution_state_root;
+        // little-endian encoding of the Poseidon commitment to the sync committee
+        bytes32 sync_committee_poseidon;
+    };
+
+    // Single-pass CommitToPublicInputsForStep: the fields are absorbed in the order of the chain
+    // and each one is written straight into the right half of the 64-byte block whose left half
+    // holds the previous digest, so no field is copied into an intermediate array. Integers and
+    // field elements are packed little-endian as by Num2Bits / Bits2Num.
+    template<std::size_t TRUNCATED_SHA256_SIZE = 253>
+    class step_public_inputs_hasher {
+        static_assert(TRUNCATED_SHA256_SIZE <= 256);
+
+    public:
+        explicit step_public_inputs_hasher(sha256_backend backend = sha256_default_backend()) :
+            block {}, absorbed(0), backend(backend) {
+        }
+
+        step_public_inputs_hasher &attested_slot(const bytes32 &slot) {
+            return absorb(0, slot.data());
+        }
+
+        // slots are SSZ uint64, i.e. little-endian in a zero-padded chunk
+        step_public_inputs_hasher &attested_slot(std::uint64_t slot) {
+            return absorb_le(0, &slot, 1);
+        }
+
+        step_public_inputs_hasher &finalized_slot(const bytes32 &slot) {
+            return absorb(1, slot.data());
+        }
+
+        step_public_inputs_hasher &finalized_slot(std::uint64_t slot) {
+            return absorb_le(1, &slot, 1);
+        }
+
+        step_public_inputs_hasher &finalized_header_root(const bytes32 &root) {
+            return absorb(2, root.data());
+        }
+
+        step_public_inputs_hasher &participation(std::uint64_t participation) {
+            return absorb_le(3, &participation, 1);
+        }
+
+        step_public_inputs_hasher &execution_state_root(const bytes32 &root) {
+            return absorb(4, root.data());
+        }
+
+        // little-endian encoding of the Poseidon commitment to the sync committee
+        step_public_inputs_hasher &sync_committee_poseidon(const bytes32 &commitment_le) {
+            return absorb(5, commitment_le.data());
+        }
+
+        // the same commitment as a field element given by its four little-endian 64-bit limbs
+        step_public_inputs_hasher &sync_committee_poseidon(const std::array<std::uint64_t, 4> &limbs) {
+            return absorb_le(5, limbs.data(), limbs.size());
+        }
+
+        // publicInputsRoot as 32 little-endian bytes, once every field has been absorbed
+        bytes32 root() const {
+            if (absorbed != FIELDS) {
+                throw std::invalid_argument("step_public_inputs_hasher: not every public input was absorbed");
+            }
+            bytes32 out;
+            for (std::size_t i = 0; i < 32; i++) {
+                std::size_t bits = TRUNCATED_SHA256_SIZE > 8 * i ? TRUNCATED_SHA256_SIZE - 8 * i : 0;
+                out[i] = bits >= 8 ? block[i] : std::uint8_t(block[i] & ((1u << bits) - 1));
+            }
+            return out;
+        }
+
+    private:
+        static constexpr std::size_t FIELDS = 6;
+
+        // field index enters as the left half of the first block, every later one as the right half
+        std::uint8_t *slot_for(std::size_t index) {
+            if (index != absorbed) {
+                throw std::invalid_argument("step_public_inputs_hasher: public inputs absorbed out of order");
+            }
+            return block.data() + (index == 0 ? 0 : 32);
+        }
+
+        // h = sha256(h || field), the digest replacing h in the left half
+        step_public_inputs_hasher &chain() {
+            if (absorbed++ == 0) {
+                return *this;
+            }
+            sha256_state_type state = SHA256_IV;
+            sha256_compress(state, block.data(), 1, backend);
+            sha256_compress_schedule(state, SHA256_PADDING_KW, backend);
+            for (std::size_t j = 0; j < 8; j++) {
+                block[4 * j] = std::uint8_t(state[j] >> 24);
+                block[4 * j + 1] = std::uint8_t(state[j] >> 16);
+                block[4 * j + 2] = std::uint8_t(state[j] >> 8);
+                block[4 * j + 3] = std::uint8_t(state[j]);
+            }
+            return *this;
+        }
+
+        step_public_inputs_hasher &absorb(std::size_t index, const std::uint8_t *field) {
+            std::uint8_t *out = slot_for(index);
+            for (std::size_t i = 0; i < 32; i++) {
+                out[i] = field[i];
+            }
+            return chain();
+        }
+
+        step_public_inputs_hasher &absorb_le(std::size_t index, const std::uint64_t *limbs, std::size_t count) {
+            std::uint8_t *out = slot_for(index);
+            for (std::size_t i = 0; i < 32; i++) {
+                out[i] = i / 8 < count ? std::uint8_t(limbs[i / 8] >> (8 * (i % 8))) : 0;
+            }
+            return chain();
+        }
+
+        std::array<std::uint8_t, 64> block;
+        std::size_t absorbed;
+        sha256_backend backend;
+    };
+
+    template<std::size_t TRUNCATED_SHA256_SIZE = 253>
+    bytes32 commit_to_public_inputs_for_step(const step_public_inputs &in) {
+        return step_public_inputs_hasher<TRUNCATED_SHA256_SIZE>()
+            .attested_slot(in.attested_slot)
+            .finalized_slot(in.finalized_slot)
+            .finalized_header_root(in.finalized_header_root)
+            .participation(in.participation)
+            .execution_state_root(in.execution_state_root)
+            .sync_committee_poseidon(in.sync_committee_poseidon)
+            .root();
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_INPUTS_HPP
@@ -0,0 +1,104 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_LRU_CACHE_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_LRU_CACHE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+
+/*
+ * Thread-safe least recently used cache of shared immutable values, the
+ * common part of hash_to_g2_cache, committee_aggregate_cache and
+ * sync_committee_tree_cache. A lookup is a single hash table probe and
+ * moving an entry to the front or evicting the oldest one is O(1). Values
+ * are built outside the lock, so a miss never blocks other lookups.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    // The keys of the caches are hash outputs (signing roots, SSZ roots, Poseidon commitments),
+    // their first bytes already are a uniform hash
+    struct bytes32_hash {
+        std::size_t operator()(const bytes32 &value) const {
+            std::size_t out;
+            std::memcpy(&out, value.data(), sizeof(out));
+            return out;
+        }
+    };
+
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class lru_cache {
+    public:
+        explicit lru_cache(std::size_t capacity) : capacity(capacity) {
+            if (capacity == 0) {
+                throw std::invalid_argument("lru_cache: capacity must be non-zero");
+            }
+        }
+
+        // the value of this key if it is cached, nullptr otherwise
+        std::shared_ptr<const Value> find(const Key &key) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = entries.find(key);
+            if (it == entries.end()) {
+                return nullptr;
+            }
+            order.splice(order.begin(), order, it->second.position);
+            return it->second.value;
+        }
+
+        // Caches value under key unless the key is already cached, and returns the cached value
+        std::shared_ptr<const Value> insert(const Key &key, std::shared_ptr<const Value> value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto [it, inserted] = entries.try_emplace(key);
+            if (!inserted) {
+                order.splice(order.begin(), order, it->second.position);
+                return it->second.value;
+            }
+            order.push_front(key);
+            it->second = {std::move(value), order.begin()};
+            if (entries.size() > capacity) {
+                entries.erase(order.back());
+                order.pop_back();
+            }
+            return it->second.value;
+        }
+
+        // The value of this key, made by make() outside the lock on a miss. Two threads missing
+        // on the same key both make it and the first insert wins.
+        template<typename Make>
+        std::shared_ptr<const Value> get(const Key &key, Make &&make) {
+            std::shared_ptr<const Value> value = find(key);
+            if (value != nullptr) {
+                return value;
+            }
+            return insert(key, make());
+        }
+
+        std::size_t size() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return entries.size();
+        }
+
+    private:
+        struct entry {
+            std::shared_ptr<const Value> value;
+            typename std::list<Key>::iterator position;
+        };
+
+        std::size_t capacity;
+        // most recently used first
+        std::list<Key> order;
+        std::unordered_map<Key, entry, Hash> entries;
+        std::mutex mutex;
+    };
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_LRU_CACHE_HPP
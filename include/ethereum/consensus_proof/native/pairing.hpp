@@ -0,0 +1,328 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_PAIRING_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_PAIRING_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/fp12.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+
+/*
+ * Native optimal Ate pairing as computed by MillerLoopFp2Two and
+ * FinalExponentiate in pairing/: the G2 points are the ones being doubled,
+ * the G1 points are only evaluated in the line functions, and the loop runs
+ * over the bits of |x| without the final conjugation (the circuits only
+ * compare the final exponentiation against 1). Each step can be recorded so
+ * the witness of every intermediate signal is available.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    // A G1 argument of the Miller loop as the line functions read it. Only the
+    // G2 points are doubled, so a G1 point enters every line linearly through
+    // -X and Y; for the fixed generator these are computed once.
+    struct g1_line_point {
+        fp neg_x;
+        fp y;
+    };
+
+    inline g1_line_point prepare_line_point(const g1_point &q) {
+        return {-q.x, q.y};
+    }
+
+    // get_generator_G1, prepared once
+    inline const g1_line_point &g1_generator_line_point() {
+        static const g1_line_point prepared = prepare_line_point(g1_generator());
+        return prepared;
+    }
+
+    // coefficients of w^0, w^2, w^3 of LineFunctionEqualFp2
+    inline std::array<fp2, 3> line_equal_coefficients(const g2_point &p, const g1_line_point &q) {
+        fp2 x_sq3 = square(p.x) * fp_from_u64(3);
+        return {x_sq3 * p.x - dbl(square(p.y)), x_sq3 * q.neg_x, dbl(p.y) * q.y};
+    }
+
+    // coefficients of w^1, w^3, w^4 of LineFunctionUnequalFp2
+    inline std::array<fp2, 3> line_unequal_coefficients(const g2_point &p0, const g2_point &p1,
+                                                        const g1_line_point &q) {
+        return {p0.x * p1.y - p1.x * p0.y, (p1.y - p0.y) * q.neg_x, (p1.x - p0.x) * q.y};
+    }
+
+    // (3x^3 - 2y^2) + w^2 (-3 x^2 X) + w^3 (2 y Y), LineFunctionEqualFp2
+    inline fp12 line_function_equal(const g2_point &p, const g1_point &q) {
+        std::array<fp2, 3> l = line_equal_coefficients(p, prepare_line_point(q));
+        fp12 out = fp12::zero();
+        out.c[0] = l[0];
+        out.c[2] = l[1];
+        out.c[3] = l[2];
+        return out;
+    }
+
+    // w (x_1 y_2 - x_2 y_1) + w^3 (y_1 - y_2) X + w^4 (x_2 - x_1) Y, LineFunctionUnequalFp2
+    inline fp12 line_function_unequal(const g2_point &p0, const g2_point &p1, const g1_point &q) {
+        std::array<fp2, 3> l = line_unequal_coefficients(p0, p1, prepare_line_point(q));
+        fp12 out = fp12::zero();
+        out.c[1] = l[0];
+        out.c[3] = l[1];
+        out.c[4] = l[2];
+        return out;
+    }
+
+    // R_j <- 2 R_j for every j, with one inversion for all the tangent slopes. Points where
+    // the slope is undefined go through the generic dbl.
+    template<typename Points>
+    void dbl_all(Points &r) {
+        std::vector<fp2> den(r.size());
+        for (std::size_t j = 0; j < r.size(); j++) {
+            den[j] = r[j].infinity ? fp2::zero() : dbl(r[j].y);
+        }
+        batch_inverse(den.data(), den.size());
+        for (std::size_t j = 0; j < r.size(); j++) {
+            if (den[j].is_zero()) {
+                r[j] = dbl(r[j], fp2::zero());
+                continue;
+            }
+            fp2 x_sq = square(r[j].x);
+            fp2 lambda = (dbl(x_sq) + x_sq) * den[j];
+            fp2 x3 = square(lambda) - dbl(r[j].x);
+            r[j] = {x3, lambda * (r[j].x - x3) - r[j].y, false};
+        }
+    }
+
+    // R_j <- R_j + P_j for every j, with one inversion for all the chord slopes
+    template<typename Points>
+    void add_all(Points &r, const Points &p) {
+        std::vector<fp2> den(r.size());
+        for (std::size_t j = 0; j < r.size(); j++) {
+            den[j] = (r[j].infinity || p[j].infinity) ? fp2::zero() : p[j].x - r[j].x;
+        }
+        batch_inverse(den.data(), den.size());
+        for (std::size_t j = 0; j < r.size(); j++) {
+            if (den[j].is_zero()) {
+                r[j] = add(r[j], p[j], fp2::zero());
+                continue;
+            }
+            fp2 lambda = (p[j].y - r[j].y) * den[j];
+            fp2 x3 = square(lambda) - r[j].x - p[j].x;
+            r[j] = {x3, lambda * (r[j].x - x3) - r[j].y, false};
+        }
+    }
+
+    // number of bits of |x|, the Miller loop runs from the one below the top bit down to bit 0
+    inline std::size_t miller_loop_bit_length() {
+        std::size_t bit_length = 64;
+        while (((BLS12_381_X_ABS >> (bit_length - 1)) & 1) == 0) {
+            bit_length--;
+        }
+        return bit_length;
+    }
+
+    // Miller loop over the bits of |x| for any number of pairs (P_j in G2, Q_j in G1),
+    // with one squaring of f per iteration for all of them. Points and PreparedPoints are
+    // std::array or std::vector; step(i, f, r) is called after iteration i.
+    template<typename Points, typename PreparedPoints, typename Step>
+    fp12 multi_miller_loop(const Points &p, const PreparedPoints &q, Step &&step) {
+        if (p.size() != q.size()) {
+            throw std::invalid_argument("multi_miller_loop: expected as many G1 as G2 points");
+        }
+        std::size_t bit_length = miller_loop_bit_length();
+
+        fp12 f = fp12::one();
+        Points r = p;
+        for (std::size_t i = bit_length - 1; i-- > 0;) {
+            f = square(f);
+            for (std::size_t j = 0; j < p.size(); j++) {
+                f = mul_by_sparse<0, 2, 3>(f, line_equal_coefficients(r[j], q[j]));
+            }
+            dbl_all(r);
+            if ((BLS12_381_X_ABS >> i) & 1) {
+                for (std::size_t j = 0; j < p.size(); j++) {
+                    f = mul_by_sparse<1, 3, 4>(f, line_unequal_coefficients(r[j], p[j], q[j]));
+                }
+                add_all(r, p);
+            }
+            step(i, f, r);
+        }
+        return f;
+    }
+
+    // f and R of every iteration of MillerLoopFp2Two (M = 2) or MillerLoopFp2Many,
+    // index i matching the circuit's f[i], R[i]
+    template<std::size_t M>
+    struct multi_miller_loop_trace {
+        std::vector<fp12> f;
+        std::vector<std::array<g2_point, M>> r;
+    };
+
+    using miller_loop_trace = multi_miller_loop_trace<2>;
+
+    // prod_j f_{|x|}(P_j, Q_j) for a fixed number of pairs, MillerLoopFp2Many
+    template<std::size_t M>
+    fp12 multi_miller_loop(const std::array<g2_point, M> &p, const std::array<g1_line_point, M> &q,
+                           multi_miller_loop_trace<M> *trace = nullptr) {
+        if (trace != nullptr) {
+            trace->f.assign(miller_loop_bit_length(), fp12::one());
+            trace->r.assign(miller_loop_bit_length(), p);
+        }
+        return multi_miller_loop(p, q, [trace](std::size_t i, const fp12 &f, const std::array<g2_point, M> &r) {
+            if (trace != nullptr) {
+                trace->f[i] = f;
+                trace->r[i] = r;
+            }
+        });
+    }
+
+    // f_{|x|}(P_0, Q_0) * f_{|x|}(P_1, Q_1), MillerLoopFp2Two with prepared G1 arguments
+    inline fp12 miller_loop_two(const std::array<g2_point, 2> &p, const std::array<g1_line_point, 2> &q,
+                                miller_loop_trace *trace = nullptr) {
+        return multi_miller_loop<2>(p, q, trace);
+    }
+
+    inline fp12 miller_loop_two(const std::array<g2_point, 2> &p, const std::array<g1_point, 2> &q,
+                                miller_loop_trace *trace = nullptr) {
+        return miller_loop_two(p, {prepare_line_point(q[0]), prepare_line_point(q[1])}, trace);
+    }
+
+    // prod_j f_{|x|}(P_j, Q_j) over a runtime number of pairs
+    inline fp12 miller_loop_product(const std::vector<g2_point> &p, const std::vector<g1_line_point> &q) {
+        return multi_miller_loop(p, q, [](std::size_t, const fp12 &, const std::vector<g2_point> &) {});
+    }
+
+    // The G2 halves of the line coefficients of the Miller loop of one P: per iteration
+    // (3x^3 - 2y^2, 3x^2, 2y) of R before its doubling and, on the set bits of |x|,
+    // (x_R y_P - x_P y_R, y_P - y_R, x_P - x_R). A P given by its table needs no G2
+    // arithmetic in the loop, its lines are only scaled by -X and Y of the G1 point.
+    struct g2_line_table {
+        std::vector<std::array<fp2, 3>> equal;
+        std::vector<std::array<fp2, 3>> unequal;
+    };
+
+    inline g2_line_table prepare_g2_lines(const g2_point &p) {
+        const g1_line_point unit = {fp::one(), fp::one()};
+        std::array<g2_point, 1> r = {p}, points = {p};
+        g2_line_table out;
+        for (std::size_t i = miller_loop_bit_length() - 1; i-- > 0;) {
+            out.equal.push_back(line_equal_coefficients(r[0], unit));
+            dbl_all(r);
+            if ((BLS12_381_X_ABS >> i) & 1) {
+                out.unequal.push_back(line_unequal_coefficients(r[0], p, unit));
+                add_all(r, points);
+            }
+        }
+        return out;
+    }
+
+    inline std::array<fp2, 3> line_table_coefficients(const std::array<fp2, 3> &l, const g1_line_point &q) {
+        return {l[0], l[1] * q.neg_x, l[2] * q.y};
+    }
+
+    // prod_j f_{|x|}(P_j, Q_j) * prod_k f_{|x|}(T_k, S_k) with the T_k given by their line tables;
+    // the same value as miller_loop_product over all the pairs
+    inline fp12 miller_loop_product(const std::vector<g2_point> &p, const std::vector<g1_line_point> &q,
+                                    const std::vector<const g2_line_table *> &tables,
+                                    const std::vector<g1_line_point> &table_q) {
+        if (p.size() != q.size() || tables.size() != table_q.size()) {
+            throw std::invalid_argument("miller_loop_product: expected as many G1 as G2 points");
+        }
+        std::size_t bit_length = miller_loop_bit_length();
+        std::size_t adds = std::size_t(std::popcount(BLS12_381_X_ABS)) - 1;
+        for (const g2_line_table *table : tables) {
+            if (table == nullptr || table->equal.size() != bit_length - 1 || table->unequal.size() != adds) {
+                throw std::invalid_argument("miller_loop_product: malformed line table");
+            }
+        }
+
+        fp12 f = fp12::one();
+        std::vector<g2_point> r = p;
+        std::size_t step = 0, add_step = 0;
+        for (std::size_t i = bit_length - 1; i-- > 0; step++) {
+            f = square(f);
+            for (std::size_t j = 0; j < p.size(); j++) {
+                f = mul_by_sparse<0, 2, 3>(f, line_equal_coefficients(r[j], q[j]));
+            }
+            for (std::size_t k = 0; k < tables.size(); k++) {
+                f = mul_by_sparse<0, 2, 3>(f, line_table_coefficients(tables[k]->equal[step], table_q[k]));
+            }
+            dbl_all(r);
+            if ((BLS12_381_X_ABS >> i) & 1) {
+                for (std::size_t j = 0; j < p.size(); j++) {
+                    f = mul_by_sparse<1, 3, 4>(f, line_unequal_coefficients(r[j], p[j], q[j]));
+                }
+                for (std::size_t k = 0; k < tables.size(); k++) {
+                    f = mul_by_sparse<1, 3, 4>(f, line_table_coefficients(tables[k]->unequal[add_step], table_q[k]));
+                }
+                add_all(r, p);
+                add_step++;
+            }
+        }
+        return f;
+    }
+
+    // in^{(p^6 - 1)(p^2 + 1)}, FinalExpEasyPart
+    inline fp12 final_exp_easy_part(const fp12 &in) {
+        fp12 f = frobenius_map(in, 6) * inverse(in);
+        return frobenius_map(f, 2) * f;
+    }
+
+    // pow1 .. pow12 of FinalExpHardPart, pows[0] is the input
+    using final_exp_hard_trace = std::array<fp12, 13>;
+
+    // hard part following p.14 of https://eprint.iacr.org/2020/875.pdf, FinalExpHardPart
+    inline fp12 final_exp_hard_part(const fp12 &in, final_exp_hard_trace *trace = nullptr) {
+        final_exp_hard_trace pow;
+        pow[0] = in;
+        pow[1] = native::pow(in, (BLS12_381_X_ABS + 1) / 3);
+        pow[2] = native::pow(pow[1], BLS12_381_X_ABS + 1);
+        pow[3] = frobenius_map(pow[2], 6);
+        pow[4] = native::pow(pow[3], BLS12_381_X_ABS);
+        pow[5] = frobenius_map(pow[2], 1);
+        pow[6] = pow[4] * pow[5];
+        pow[7] = native::pow(pow[6], BLS12_381_X_ABS);
+        pow[8] = native::pow(pow[7], BLS12_381_X_ABS);
+        pow[9] = frobenius_map(pow[6], 2);
+        pow[10] = frobenius_map(pow[6], 6);
+        pow[11] = pow[8] * pow[9];
+        pow[12] = pow[10] * pow[11];
+        if (trace != nullptr) {
+            *trace = pow;
+        }
+        return pow[12] * in;
+    }
+
+    inline fp12 final_exponentiate(const fp12 &in) {
+        return final_exp_hard_part(final_exp_easy_part(in));
+    }
+
+    // prod_j e(Q_j, P_j): one Miller loop over all pairs and a single final exponentiation
+    inline fp12 pairing_product(const std::vector<g2_point> &p, const std::vector<g1_point> &q) {
+        std::vector<g1_line_point> prepared;
+        prepared.reserve(q.size());
+        for (const g1_point &point : q) {
+            prepared.push_back(prepare_line_point(point));
+        }
+        return final_exponentiate(miller_loop_product(p, prepared));
+    }
+
+    // e(g1, signature) * e(pubkey, -H(m)) == 1, arranged as in CoreVerifyPubkeyG1NoCheck
+    inline bool core_verify_pubkey_g1(const g1_point &pubkey, const g2_point &signature, const g2_point &hm) {
+        fp12 f = miller_loop_two({negate(signature), hm}, {g1_generator_line_point(), prepare_line_point(pubkey)});
+        return final_exponentiate(f).is_one();
+    }
+
+    // core_verify_pubkey_g1 with H(m) given by its line table, prepare_g2_lines(H(m))
+    inline bool core_verify_pubkey_g1(const g1_point &pubkey, const g2_point &signature,
+                                      const g2_line_table &hm_lines) {
+        fp12 f = miller_loop_product({negate(signature)}, {g1_generator_line_point()}, {&hm_lines},
+                                     {prepare_line_point(pubkey)});
+        return final_exponentiate(f).is_one();
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_PAIRING_HPP
@@ -0,0 +1,451 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_POSEIDON_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_POSEIDON_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <ethereum/consensus_proof/constants.hpp>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fr.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/poseidon_constants.hpp>
+#include <ethereum/consensus_proof/native/thread_pool.hpp>
+
+/*
+ * Native PoseidonEx(16, nOuts), PoseidonSponge, PoseidonG1Array and
+ * PoseidonG1Tree of poseidon.hpp. poseidon_permute_reference follows the round structure
+ * literally (t^2 multiplications per round); poseidon_permute computes the
+ * same permutation with the partial-round optimisation of the Poseidon
+ * paper (appendix B), which is also what circomlib's C / S / M / P tables
+ * encode:
+ *  - the constants a partial round adds to state[1..t) are pushed through
+ *    the MDS matrix into the next round, so partial rounds add one scalar;
+ *  - the MDS matrix of the partial rounds is factored into a dense matrix,
+ *    applied once at the end of the first full rounds, and one sparse
+ *    matrix per round (first row, first column and the identity), 2t - 1
+ *    multiplications instead of t^2.
+ * The optimised tables are derived once from poseidon_constants.hpp. Rows
+ * of the mix layers are summed unreduced and reduced once (fr_wide).
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    using poseidon_state = std::array<fr, POSEIDON_WIDTH>;
+
+    // x^5
+    inline fr poseidon_sbox(const fr &x) {
+        fr x2 = square(x);
+        return square(x2) * x;
+    }
+
+    inline void poseidon_mix(poseidon_state &state, const std::array<fr, POSEIDON_WIDTH * POSEIDON_WIDTH> &m) {
+        poseidon_state out;
+        for (std::size_t i = 0; i < POSEIDON_WIDTH; i++) {
+            fr_wide acc = fr_wide::zero();
+            for (std::size_t j = 0; j < POSEIDON_WIDTH; j++) {
+                fr_mul_accumulate(acc, m[i * POSEIDON_WIDTH + j], state[j]);
+            }
+            out[i] = fr_reduce(acc);
+        }
+        state = out;
+    }
+
+    inline void poseidon_permute_reference(poseidon_state &state) {
+        constexpr std::size_t half = POSEIDON_FULL_ROUNDS / 2;
+        for (std::size_t r = 0; r < POSEIDON_FULL_ROUNDS + POSEIDON_PARTIAL_ROUNDS; r++) {
+            for (std::size_t i = 0; i < POSEIDON_WIDTH; i++) {
+                state[i] += POSEIDON_ROUND_CONSTANTS[r * POSEIDON_WIDTH + i];
+            }
+            if (r < half || r >= half + POSEIDON_PARTIAL_ROUNDS) {
+                for (fr &x : state) {
+                    x = poseidon_sbox(x);
+                }
+            } else {
+                state[0] = poseidon_sbox(state[0]);
+            }
+            poseidon_mix(state, POSEIDON_MDS);
+        }
+    }
+
+    struct poseidon_optimized_tables {
+        // full round constants, the first second-half round carrying the partial rounds' remainder
+        std::array<poseidon_state, POSEIDON_FULL_ROUNDS> full_constants;
+        std::array<fr, POSEIDON_PARTIAL_ROUNDS> partial_constants;
+        // M with its lower-right block replaced by the product of the partial rounds' dense factors,
+        // the mix of the last first-half full round
+        std::array<fr, POSEIDON_WIDTH * POSEIDON_WIDTH> pre_sparse;
+        // partial round k: state'[0] = M[0][0] state[0] + sum_j w[k][j] state[1 + j],
+        // state'[1 + j] = state[1 + j] + v[k][j] state[0]
+        std::array<std::array<fr, POSEIDON_WIDTH - 1>, POSEIDON_PARTIAL_ROUNDS> sparse_w;
+        std::array<std::array<fr, POSEIDON_WIDTH - 1>, POSEIDON_PARTIAL_ROUNDS> sparse_v;
+    };
+
+    using poseidon_minor_matrix = std::array<std::array<fr, POSEIDON_WIDTH - 1>, POSEIDON_WIDTH - 1>;
+
+    inline poseidon_minor_matrix poseidon_minor_mul(const poseidon_minor_matrix &a, const poseidon_minor_matrix &b) {
+        poseidon_minor_matrix out {};
+        for (std::size_t i = 0; i < POSEIDON_WIDTH - 1; i++) {
+            for (std::size_t k = 0; k < POSEIDON_WIDTH - 1; k++) {
+                for (std::size_t j = 0; j < POSEIDON_WIDTH - 1; j++) {
+                    out[i][j] += a[i][k] * b[k][j];
+                }
+            }
+        }
+        return out;
+    }
+
+    // Gauss-Jordan elimination; the lower-right block of a Cauchy matrix is a Cauchy matrix,
+    // so it is always invertible
+    inline poseidon_minor_matrix poseidon_minor_inverse(poseidon_minor_matrix a) {
+        constexpr std::size_t n = POSEIDON_WIDTH - 1;
+        poseidon_minor_matrix out {};
+        for (std::size_t i = 0; i < n; i++) {
+            out[i][i] = fr::one();
+        }
+        for (std::size_t col = 0; col < n; col++) {
+            std::size_t pivot = col;
+            while (pivot < n && a[pivot][col].is_zero()) {
+                pivot++;
+            }
+            if (pivot == n) {
+                throw std::invalid_argument("poseidon_minor_inverse: singular matrix");
+            }
+            std::swap(a[col], a[pivot]);
+            std::swap(out[col], out[pivot]);
+            fr scale = inverse(a[col][col]);
+            for (std::size_t j = 0; j < n; j++) {
+                a[col][j] *= scale;
+                out[col][j] *= scale;
+            }
+            for (std::size_t i = 0; i < n; i++) {
+                if (i == col || a[i][col].is_zero()) {
+                    continue;
+                }
+                fr factor = a[i][col];
+                for (std::size_t j = 0; j < n; j++) {
+                    a[i][j] -= factor * a[col][j];
+                    out[i][j] -= factor * out[col][j];
+                }
+            }
+        }
+        return out;
+    }
+
+    inline poseidon_optimized_tables poseidon_optimize() {
+        constexpr std::size_t t = POSEIDON_WIDTH, half = POSEIDON_FULL_ROUNDS / 2;
+        poseidon_optimized_tables out;
+
+        // Constants: the state[1..t) part b of a partial round's constants passes the s-box
+        // untouched, so it is added as M b at the start of the next round instead
+        std::vector<poseidon_state> constants(POSEIDON_FULL_ROUNDS + POSEIDON_PARTIAL_ROUNDS);
+        for (std::size_t r = 0; r < constants.size(); r++) {
+            for (std::size_t i = 0; i < t; i++) {
+                constants[r][i] = POSEIDON_ROUND_CONSTANTS[r * t + i];
+            }
+        }
+        for (std::size_t k = 0; k < POSEIDON_PARTIAL_ROUNDS; k++) {
+            poseidon_state b = constants[half + k];
+            b[0] = fr::zero();
+            poseidon_mix(b, POSEIDON_MDS);
+            for (std::size_t i = 0; i < t; i++) {
+                constants[half + k + 1][i] += b[i];
+            }
+            out.partial_constants[k] = constants[half + k][0];
+        }
+        for (std::size_t r = 0; r < POSEIDON_FULL_ROUNDS; r++) {
+            out.full_constants[r] = constants[r < half ? r : r + POSEIDON_PARTIAL_ROUNDS];
+        }
+
+        // Matrices: with M = [[m, w^T], [v, M^]] and D = diag(1, X), D M = S diag(1, X M^) where
+        // S = [[m, w^T (X M^)^{-1}], [X v, I]]. diag(1, .) commutes with the partial s-box and
+        // constant, so going backwards from X = I every partial round keeps only S and the last
+        // dense factor moves into the mix of the preceding full round.
+        poseidon_minor_matrix m_minor {}, x {}, x_inverse {};
+        for (std::size_t i = 0; i < t - 1; i++) {
+            for (std::size_t j = 0; j < t - 1; j++) {
+                m_minor[i][j] = POSEIDON_MDS[(i + 1) * t + j + 1];
+            }
+            x[i][i] = fr::one();
+            x_inverse[i][i] = fr::one();
+        }
+        poseidon_minor_matrix m_minor_inverse = poseidon_minor_inverse(m_minor);
+        for (std::size_t k = POSEIDON_PARTIAL_ROUNDS; k-- > 0;) {
+            for (std::size_t i = 0; i < t - 1; i++) {
+                fr v = fr::zero();
+                for (std::size_t j = 0; j < t - 1; j++) {
+                    v += x[i][j] * POSEIDON_MDS[(j + 1) * t];
+                }
+                out.sparse_v[k][i] = v;
+            }
+            x = poseidon_minor_mul(x, m_minor);
+            x_inverse = poseidon_minor_mul(m_minor_inverse, x_inverse);
+            for (std::size_t j = 0; j < t - 1; j++) {
+                fr w = fr::zero();
+                for (std::size_t i = 0; i < t - 1; i++) {
+                    w += POSEIDON_MDS[i + 1] * x_inverse[i][j];
+                }
+                out.sparse_w[k][j] = w;
+            }
+        }
+        // diag(1, X) M
+        for (std::size_t j = 0; j < t; j++) {
+            out.pre_sparse[j] = POSEIDON_MDS[j];
+            for (std::size_t i = 0; i < t - 1; i++) {
+                fr acc = fr::zero();
+                for (std::size_t l = 0; l < t - 1; l++) {
+                    acc += x[i][l] * POSEIDON_MDS[(l + 1) * t + j];
+                }
+                out.pre_sparse[(i + 1) * t + j] = acc;
+            }
+        }
+        return out;
+    }
+
+    inline void poseidon_permute(poseidon_state &state, const poseidon_optimized_tables &tables) {
+        constexpr std::size_t half = POSEIDON_FULL_ROUNDS / 2;
+        auto full_round = [&](std::size_t r, const std::array<fr, POSEIDON_WIDTH * POSEIDON_WIDTH> &mix) {
+            for (std::size_t i = 0; i < POSEIDON_WIDTH; i++) {
+                state[i] = poseidon_sbox(state[i] + tables.full_constants[r][i]);
+            }
+            poseidon_mix(state, mix);
+        };
+
+        for (std::size_t r = 0; r < half; r++) {
+            full_round(r, r + 1 == half ? tables.pre_sparse : POSEIDON_MDS);
+        }
+        const fr m00 = POSEIDON_MDS[0];
+        for (std::size_t k = 0; k < POSEIDON_PARTIAL_ROUNDS; k++) {
+            fr s0 = poseidon_sbox(state[0] + tables.partial_constants[k]);
+            fr_wide acc = fr_wide::zero();
+            fr_mul_accumulate(acc, m00, s0);
+            for (std::size_t j = 0; j < POSEIDON_WIDTH - 1; j++) {
+                fr_mul_accumulate(acc, tables.sparse_w[k][j], state[j + 1]);
+                state[j + 1] += tables.sparse_v[k][j] * s0;
+            }
+            state[0] = fr_reduce(acc);
+        }
+        for (std::size_t r = half; r < POSEIDON_FULL_ROUNDS; r++) {
+            full_round(r, POSEIDON_MDS);
+        }
+    }
+
+    // The tables, derived the first time they are needed
+    inline const poseidon_optimized_tables &poseidon_optimized() {
+        static const poseidon_optimized_tables tables = poseidon_optimize();
+        return tables;
+    }
+
+    inline void poseidon_permute(poseidon_state &state) {
+        poseidon_permute(state, poseidon_optimized());
+    }
+
+    // PoseidonEx(16, nOuts): state = (initialState, inputs), out[i] is state[i] after the permutation
+    inline poseidon_state poseidon_ex(const fr &initial_state, const fr *inputs) {
+        poseidon_state state;
+        state[0] = initial_state;
+        for (std::size_t i = 1; i < POSEIDON_WIDTH; i++) {
+            state[i] = inputs[i - 1];
+        }
+        poseidon_permute(state);
+        return state;
+    }
+
+    // PoseidonSponge: chunks of 16 chained through out[0], the result is out[1] of the last one
+    inline fr poseidon_sponge(const fr *in, std::size_t length) {
+        constexpr std::size_t rate = POSEIDON_WIDTH - 1;
+        if (length == 0 || length % rate != 0) {
+            throw std::invalid_argument("poseidon_sponge: length must be a non-zero multiple of 16");
+        }
+        poseidon_state state {};
+        for (std::size_t i = 0; i < length; i += rate) {
+            state = poseidon_ex(state[0], in + i);
+        }
+        return state[1];
+    }
+
+    // PoseidonG1Array: x and y of every pubkey as K registers of N bits, interleaved per register
+    template<std::size_t N = NUM_BITS_PER_REGISTER, std::size_t K = NUM_REGISTERS>
+    fr poseidon_g1_array(const std::vector<g1_point> &pubkeys) {
+        std::vector<fr> in(pubkeys.size() * 2 * K);
+        for (std::size_t i = 0; i < pubkeys.size(); i++) {
+            std::array<std::array<std::size_t, K>, 2> registers = to_registers<N, K>(pubkeys[i]);
+            for (std::size_t j = 0; j < K; j++) {
+                for (std::size_t l = 0; l < 2; l++) {
+                    in[i * K * 2 + j * 2 + l] = fr_from_u64(registers[l][j]);
+                }
+            }
+        }
+        return poseidon_sponge(in.data(), in.size());
+    }
+
+    // PoseidonG1Leaf: the registers of one pubkey in PoseidonG1Array order, zero padded
+    template<std::size_t N = NUM_BITS_PER_REGISTER, std::size_t K = NUM_REGISTERS>
+    fr poseidon_g1_leaf(const g1_point &pubkey) {
+        static_assert(2 * K <= POSEIDON_TREE_ARITY);
+        std::array<std::array<std::size_t, K>, 2> registers = to_registers<N, K>(pubkey);
+        std::array<fr, POSEIDON_TREE_ARITY> in {};
+        for (std::size_t j = 0; j < 2 * K; j++) {
+            in[j] = fr_from_u64(registers[j % 2][j / 2]);
+        }
+        return poseidon_ex(fr_from_u64(POSEIDON_TREE_LEAF_DOMAIN), in.data())[0];
+    }
+
+    // node over count <= POSEIDON_TREE_ARITY children, the missing ones being zero
+    inline fr poseidon_tree_node(const fr *children, std::size_t count) {
+        std::array<fr, POSEIDON_TREE_ARITY> in {};
+        for (std::size_t c = 0; c < count; c++) {
+            in[c] = children[c];
+        }
+        return poseidon_ex(fr_from_u64(POSEIDON_TREE_NODE_DOMAIN), in.data())[0];
+    }
+
+    // The other children of every node on a leaf's path, from the leaves up
+    using poseidon_tree_branch = std::vector<std::array<fr, POSEIDON_TREE_ARITY - 1>>;
+
+    // PoseidonG1Tree with every layer kept, so any pubkey opens against the root without hashing.
+    // Leaves and the nodes of a layer are independent and are spread over pool if one is given.
+    class poseidon_tree {
+    public:
+        explicit poseidon_tree(std::vector<fr> leaves, thread_pool *pool = nullptr) {
+            if (leaves.empty()) {
+                throw std::invalid_argument("poseidon_tree: expected at least one leaf");
+            }
+            layers.push_back(std::move(leaves));
+            while (layers.back().size() > 1) {
+                const std::vector<fr> &children = layers.back();
+                std::vector<fr> parents((children.size() + POSEIDON_TREE_ARITY - 1) / POSEIDON_TREE_ARITY);
+                parallel(pool, parents.size(), [&](std::size_t p) {
+                    std::size_t first = p * POSEIDON_TREE_ARITY;
+                    std::size_t count = std::min(POSEIDON_TREE_ARITY, children.size() - first);
+                    parents[p] = poseidon_tree_node(children.data() + first, count);
+                });
+                layers.push_back(std::move(parents));
+            }
+        }
+
+        // PoseidonG1Leaf of every pubkey, then the tree over them
+        template<std::size_t N = NUM_BITS_PER_REGISTER, std::size_t K = NUM_REGISTERS>
+        static poseidon_tree from_pubkeys(const std::vector<g1_point> &pubkeys, thread_pool *pool = nullptr) {
+            std::vector<fr> leaves(pubkeys.size());
+            parallel(pool, leaves.size(), [&](std::size_t i) {
+                leaves[i] = poseidon_g1_leaf<N, K>(pubkeys[i]);
+            });
+            return poseidon_tree(std::move(leaves), pool);
+        }
+
+        std::size_t size() const {
+            return layers[0].size();
+        }
+
+        // number of node layers above the leaves, SYNC_COMMITTEE_POSEIDON_TREE_DEPTH for the committee
+        std::size_t depth() const {
+            return layers.size() - 1;
+        }
+
+        const fr &root() const {
+            return layers.back()[0];
+        }
+
+        const fr &leaf(std::size_t index) const {
+            check_index(index);
+            return layers[0][index];
+        }
+
+        poseidon_tree_branch branch(std::size_t index) const {
+            check_index(index);
+            poseidon_tree_branch out(depth());
+            for (std::size_t level = 0; level < depth(); level++, index /= POSEIDON_TREE_ARITY) {
+                const std::vector<fr> &layer = layers[level];
+                std::size_t first = index - index % POSEIDON_TREE_ARITY;
+                for (std::size_t c = 0, k = 0; c < POSEIDON_TREE_ARITY; c++) {
+                    if (first + c != index) {
+                        out[level][k++] = first + c < layer.size() ? layer[first + c] : fr::zero();
+                    }
+                }
+            }
+            return out;
+        }
+
+    private:
+        template<typename Function>
+        static void parallel(thread_pool *pool, std::size_t n, Function &&f) {
+            if (pool == nullptr) {
+                for (std::size_t i = 0; i < n; i++) {
+                    f(i);
+                }
+                return;
+            }
+            pool->parallel_for(n, 1, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    f(i);
+                }
+            });
+        }
+
+        void check_index(std::size_t index) const {
+            if (index >= size()) {
+                throw std::invalid_argument("poseidon_tree: leaf index out of range");
+            }
+        }
+
+        std::vector<std::vector<fr>> layers;
+    };
+
+    // Root of the tree holding leaf at index with the given branch, the check of an opening
+    inline fr poseidon_tree_root(fr leaf, std::size_t index, const poseidon_tree_branch &branch) {
+        for (const std::array<fr, POSEIDON_TREE_ARITY - 1> &siblings : branch) {
+            std::size_t position = index % POSEIDON_TREE_ARITY;
+            std::array<fr, POSEIDON_TREE_ARITY> children;
+            for (std::size_t c = 0, k = 0; c < POSEIDON_TREE_ARITY; c++) {
+                children[c] = c == position ? leaf : siblings[k++];
+            }
+            leaf = poseidon_tree_node(children.data(), children.size());
+            index /= POSEIDON_TREE_ARITY;
+        }
+        if (index != 0) {
+            throw std::invalid_argument("poseidon_tree_root: index out of range for the branch");
+        }
+        return leaf;
+    }
+
+    // The layout PoseidonG1Tree of poseidon.hpp is compiled with: the committee fills the last layer
+    // but not the one below it, and a leaf holds the 2 K registers of one pubkey
+    constexpr std::size_t poseidon_tree_capacity(std::size_t depth) {
+        return depth == 0 ? 1 : POSEIDON_TREE_ARITY * poseidon_tree_capacity(depth - 1);
+    }
+    static_assert(POSEIDON_TREE_ARITY == 16 && POSEIDON_TREE_ARITY == POSEIDON_WIDTH - 1);
+    static_assert(POSEIDON_TREE_LEAF_DOMAIN == 0 && POSEIDON_TREE_NODE_DOMAIN == 1);
+    static_assert(SYNC_COMMITTEE_POSEIDON_TREE_DEPTH == 3);
+    static_assert(poseidon_tree_capacity(SYNC_COMMITTEE_POSEIDON_TREE_DEPTH - 1) < SYNC_COMMITTEE_SIZE &&
+                  SYNC_COMMITTEE_SIZE <= poseidon_tree_capacity(SYNC_COMMITTEE_POSEIDON_TREE_DEPTH));
+    static_assert(2 * NUM_REGISTERS <= POSEIDON_TREE_ARITY);
+
+    // PoseidonG1Commitment: the sponge or the tree root, as selected by SYNC_COMMITTEE_POSEIDON_TREE.
+    // pool only helps the tree, the sponge is sequential.
+    template<std::size_t N = NUM_BITS_PER_REGISTER, std::size_t K = NUM_REGISTERS>
+    fr poseidon_g1_commitment(const std::vector<g1_point> &pubkeys, thread_pool *pool = nullptr) {
+        if constexpr (SYNC_COMMITTEE_POSEIDON_TREE) {
+            return poseidon_tree::from_pubkeys<N, K>(pubkeys, pool).root();
+        } else {
+            return poseidon_g1_array<N, K>(pubkeys);
+        }
+    }
+
+    // syncCommitteePoseidon as the little-endian bytes carried by step_input
+    template<std::size_t N = NUM_BITS_PER_REGISTER, std::size_t K = NUM_REGISTERS>
+    bytes32 sync_committee_poseidon(const std::vector<g1_point> &pubkeys, thread_pool *pool = nullptr) {
+        bytes32 out;
+        fr_to_bytes_le(poseidon_g1_commitment<N, K>(pubkeys, pool), out.data());
+        return out;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_POSEIDON_HPP
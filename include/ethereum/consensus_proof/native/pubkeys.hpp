@@ -0,0 +1,143 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_PUBKEYS_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_PUBKEYS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp_simd.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/ssz.hpp>
+
+/*
+ * Committee-wide G1 pubkey handling: the 48-byte compressed encoding used by
+ * the beacon chain (flags in the three top bits of the first byte:
+ * compressed, infinity, sign of y) and the per-key checks Rotate performs
+ * (PointOnBLSCurveNoCheck). Decompression takes a square root,
+ * (x^3 + 4)^{(p + 1) / 4}, for every key; the *_many variants run those
+ * exponentiations side by side on fp_batch.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    // (p - 1) / 2, y is "larger" than -y when above it
+    constexpr static const limbs_type FP_HALF_MODULUS = {0xdcff7fffffffd555, 0x0f55ffff58a9ffff, 0xb39869507b587b12,
+                                                         0xb23ba5c279c2895f, 0x258dd3db21a5d66b, 0x0d0088f51cbff34d};
+
+    inline bool fp_is_lexicographically_largest(const fp &y) {
+        limbs_type l = fp_to_limbs(y);
+        return !limbs_geq(FP_HALF_MODULUS, l);
+    }
+
+    inline g1_bytes_type g1_compress(const g1_point &p) {
+        g1_bytes_type out {};
+        if (p.infinity) {
+            out[0] = 0xc0;
+            return out;
+        }
+        fp_to_bytes_be(p.x, out.data());
+        out[0] |= 0x80;
+        if (fp_is_lexicographically_largest(p.y)) {
+            out[0] |= 0x20;
+        }
+        return out;
+    }
+
+    // x of a compressed point after checking the flags; infinity is reported separately
+    inline fp g1_compressed_x(const g1_bytes_type &in, bool &infinity, bool &sign) {
+        if ((in[0] & 0x80) == 0) {
+            throw std::invalid_argument("g1_decompress: not a compressed point");
+        }
+        infinity = (in[0] & 0x40) != 0;
+        sign = (in[0] & 0x20) != 0;
+        g1_bytes_type x = in;
+        x[0] &= 0x1f;
+        if (infinity) {
+            bool rest_zero = !sign;
+            for (std::uint8_t b : x) {
+                rest_zero = rest_zero && b == 0;
+            }
+            if (!rest_zero) {
+                throw std::invalid_argument("g1_decompress: malformed point at infinity");
+            }
+            return fp::zero();
+        }
+        limbs_type l {};
+        for (std::size_t i = 0; i < 48; i++) {
+            l[5 - i / 8] |= std::uint64_t(x[i]) << (8 * (7 - i % 8));
+        }
+        if (limbs_geq(l, FP_MODULUS)) {
+            throw std::invalid_argument("g1_decompress: x is not reduced");
+        }
+        return fp_from_limbs(l);
+    }
+
+    // y from a square root of x^3 + 4 and the sign flag; throws if there is none
+    inline g1_point g1_select_root(const fp &x, const fp &rhs, const fp &root, bool sign) {
+        if (square(root) != rhs) {
+            throw std::invalid_argument("g1_decompress: x is not on the curve");
+        }
+        fp y = (fp_is_lexicographically_largest(root) == sign) ? root : -root;
+        return {x, y, false};
+    }
+
+    inline g1_point g1_decompress(const g1_bytes_type &in) {
+        bool infinity, sign;
+        fp x = g1_compressed_x(in, infinity, sign);
+        if (infinity) {
+            return g1_point::point_at_infinity();
+        }
+        fp rhs = square(x) * x + g1_curve_b();
+        return g1_select_root(x, rhs, rhs * pow(rhs, FP_SQRT_CHAIN), sign);
+    }
+
+    // g1_decompress of every key, with the square roots computed side by side
+    inline std::vector<g1_point> g1_decompress_many(const std::vector<g1_bytes_type> &in,
+                                                    fp_simd_backend backend = fp_simd_default_backend()) {
+        std::vector<fp> x(in.size()), rhs(in.size());
+        std::vector<bool> infinity(in.size()), sign(in.size());
+        for (std::size_t i = 0; i < in.size(); i++) {
+            bool inf, sgn;
+            x[i] = g1_compressed_x(in[i], inf, sgn);
+            infinity[i] = inf;
+            sign[i] = sgn;
+        }
+        fp_batch xs(x, backend);
+        std::vector<fp> cube = (square(xs) * xs).values();
+        for (std::size_t i = 0; i < in.size(); i++) {
+            rhs[i] = cube[i] + g1_curve_b();
+        }
+        fp_batch rhs_batch(rhs, backend);
+        std::vector<fp> root = (rhs_batch * pow(rhs_batch, FP_SQRT_CHAIN)).values();
+
+        std::vector<g1_point> out(in.size());
+        for (std::size_t i = 0; i < in.size(); i++) {
+            out[i] = infinity[i] ? g1_point::point_at_infinity() : g1_select_root(x[i], rhs[i], root[i], sign[i]);
+        }
+        return out;
+    }
+
+    // y^2 == x^3 + 4 for every point, PointOnBLSCurveNoCheck
+    inline std::vector<bool> g1_is_on_curve_many(const std::vector<g1_point> &points,
+                                                 fp_simd_backend backend = fp_simd_default_backend()) {
+        std::vector<fp> x(points.size()), y(points.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            x[i] = points[i].x;
+            y[i] = points[i].y;
+        }
+        fp_batch xs(x, backend);
+        std::vector<fp> cube = (square(xs) * xs).values();
+        std::vector<fp> y_sq = square(fp_batch(y, backend)).values();
+        std::vector<bool> out(points.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            out[i] = points[i].infinity || y_sq[i] == cube[i] + g1_curve_b();
+        }
+        return out;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_PUBKEYS_HPP
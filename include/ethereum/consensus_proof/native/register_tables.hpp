@@ -0,0 +1,288 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_REGISTER_TABLES_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_REGISTER_TABLES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+
+/*
+ * The constant tables of pairing/bls12_381_func.hpp (Frobenius coefficients,
+ * SWU roots of unity and etas, 3-isogeny coefficients, generators) as
+ * static constexpr arrays in any register layout with N * K >= 381. Every
+ * table is written once as canonical hex, "-0x..." meaning p - 0x..., and
+ * split into N-bit registers at compile time. Registers wider than 64 bits,
+ * as in the (96, 4) and (77, 5) layouts, are unsigned __int128. The native
+ * field code reads the same tables through the (64, 6) layout, whose
+ * registers are the canonical limbs.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    template<std::size_t N>
+    using register_type = std::conditional_t<(N <= 64), std::size_t, uint128_t>;
+
+    using fp_hex = std::string_view;
+    using fp2_hex = std::array<fp_hex, 2>;
+
+    // p - a for a in [0, p), zero stays zero
+    constexpr limbs_type limbs_negate(const limbs_type &a) {
+        if ((a[0] | a[1] | a[2] | a[3] | a[4] | a[5]) == 0) {
+            return a;
+        }
+        limbs_type out {};
+        limbs_sub(out, FP_MODULUS, a);
+        return out;
+    }
+
+    // canonical integer in [0, p) from big-endian hex digits with an 0x prefix; a leading
+    // minus sign gives p minus the value
+    constexpr limbs_type limbs_from_hex(fp_hex hex) {
+        bool negative = !hex.empty() && hex[0] == '-';
+        if (negative) {
+            hex.remove_prefix(1);
+        }
+        if (hex.size() < 3 || hex.size() > 98 || hex[0] != '0' || hex[1] != 'x') {
+            throw std::invalid_argument("limbs_from_hex: expected 0x followed by at most 96 digits");
+        }
+        hex.remove_prefix(2);
+        limbs_type out {};
+        for (std::size_t i = 0; i < hex.size(); i++) {
+            char c = hex[hex.size() - 1 - i];
+            if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
+                throw std::invalid_argument("limbs_from_hex: not a hex digit");
+            }
+            std::uint64_t digit = (c <= '9') ? c - '0' : c - 'a' + 10;
+            out[i / 16] |= digit << (4 * (i % 16));
+        }
+        if (limbs_geq(out, FP_MODULUS)) {
+            throw std::invalid_argument("limbs_from_hex: value is not reduced");
+        }
+        return negative ? limbs_negate(out) : out;
+    }
+
+    // K little-endian registers of N bits
+    template<std::size_t N, std::size_t K>
+    constexpr std::array<register_type<N>, K> limbs_to_registers(const limbs_type &l) {
+        static_assert(N <= 128 && N * K >= 381);
+        std::array<register_type<N>, K> out {};
+        for (std::size_t i = 0; i < K && i * N < 384; i++) {
+            std::size_t bit = i * N;
+            uint128_t v = 0;
+            for (std::size_t w = bit / 64; w < 6 && w * 64 < bit + N; w++) {
+                v |= (w * 64 >= bit) ? uint128_t(l[w]) << (w * 64 - bit) : uint128_t(l[w]) >> (bit - w * 64);
+            }
+            out[i] = register_type<N>(N == 128 ? v : v & ((uint128_t(1) << N) - 1));
+        }
+        return out;
+    }
+
+    // (w^i)^{p^j} / w^i = (1 + u)^{i (p^j - 1) / 6} for j, i in [1, 6); the other rows follow
+    // from j = 0 and w^{p^6} = -w
+    constexpr static const std::array<std::array<fp2_hex, 5>, 5> FP12_FROBENIUS_HEX = {{
+        {{
+            {"0x1904d3bf02bb0667c231beb4202c0d1f0fd603fd3cbd5f4f7b2443d784bab9c4f67ea53d63e7813d8d0775ed92235fb8",
+             "0xfc3e2b36c4e03288e9e902231f9fb854a14787b6c7b36fec0c8ec971f63c5f282d5ac14d6c7ec22cf78a126ddc4af3"},
+            {"0x0",
+             "0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac"},
+            {"0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09",
+             "0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09"},
+            {"0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaad",
+             "0x0"},
+            {"0x5b2cfd9013a5fd8df47fa6b48b1e045f39816240c0b8fee8beadf4d8e9c0566c63a3e6e257f87329b18fae980078116",
+             "0x144e4211384586c16bd3ad4afa99cc9170df3560e77982d0db45f3536814f0bd5871c1908bd478cd1ee605167ff82995"}
+        }},
+        {{
+            {"0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffeffff", "0x0"},
+            {"0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe", "0x0"},
+            {"-0x1", "0x0"},
+            {"0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac",
+             "0x0"},
+            {"0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaad",
+             "0x0"}
+        }},
+        {{
+            {"0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2",
+             "0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09"},
+            {"0x0", "0x1"},
+            {"0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2",
+             "0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2"},
+            {"-0x1", "0x0"},
+            {"0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09",
+             "0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2"}
+        }},
+        {{
+            {"0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe", "0x0"},
+            {"0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac",
+             "0x0"},
+            {"0x1", "0x0"},
+            {"0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe", "0x0"},
+            {"0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac",
+             "0x0"}
+        }},
+        {{
+            {"0x144e4211384586c16bd3ad4afa99cc9170df3560e77982d0db45f3536814f0bd5871c1908bd478cd1ee605167ff82995",
+             "0x5b2cfd9013a5fd8df47fa6b48b1e045f39816240c0b8fee8beadf4d8e9c0566c63a3e6e257f87329b18fae980078116"},
+            {"0x0", "0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe"},
+            {"0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09",
+             "0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09"},
+            {"0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffeffff", "0x0"},
+            {"0xfc3e2b36c4e03288e9e902231f9fb854a14787b6c7b36fec0c8ec971f63c5f282d5ac14d6c7ec22cf78a126ddc4af3",
+             "0x1904d3bf02bb0667c231beb4202c0d1f0fd603fd3cbd5f4f7b2443d784bab9c4f67ea53d63e7813d8d0775ed92235fb8"}
+        }}
+    }};
+
+    // 1, u, (rv, rv), (rv, -rv) with rv = 1 / sqrt(2), get_roots_of_unity
+    constexpr static const std::array<fp2_hex, 4> SWU_ROOTS_OF_UNITY_HEX = {{
+        {"0x1", "0x0"},
+        {"0x0", "0x1"},
+        {"0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09",
+         "0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09"},
+        {"0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09",
+         "0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2"}
+    }};
+
+    // etas[1] = u * etas[0], etas[3] = u * etas[2], get_etas
+    constexpr static const std::array<fp2_hex, 4> SWU_ETAS_HEX = {{
+        {"0x699be3b8c6870965e5bf892ad5d2cc7b0e85a117402dfd83b7f4a947e02d978498255a2aaec0ac627b5afbdf1bf1c90",
+         "0x8157cd83046453f5dd0972b6e3949e4288020b5b8a9cc99ca07e27089a2ce2436d965026adad3ef7baba37f2183e9b5"},
+        {"0x11eb95120939a15aed4b108ad51262f33bf72acf3adb46259d28f0306d0e27ffe7d29afc46792c103e535c80de7bc0f6",
+         "0x699be3b8c6870965e5bf892ad5d2cc7b0e85a117402dfd83b7f4a947e02d978498255a2aaec0ac627b5afbdf1bf1c90"},
+        {"0xab1c2ffdd6c253ca155231eb3e71ba044fd562f6f72bc5bad5ec46a0b7a3b0247cf08ce6c6317f40edbc653a72dee17",
+         "0xaa404866706722864480885d68ad0ccac1967c7544b447873cc37e0181271e006df72162a3d3e0287bf597fbf7f8fc1"},
+        {"0xf5d0d63d2797471e6d39f306cc0dc0ab85de3bd9f39ce46f3649ac0de9e844417cc8de88716c1fd323fa68040801aea",
+         "0xab1c2ffdd6c253ca155231eb3e71ba044fd562f6f72bc5bad5ec46a0b7a3b0247cf08ce6c6317f40edbc653a72dee17"}
+    }};
+
+    // x_num, x_den, y_num, y_den of the 3-isogeny, E.3 of the hash-to-curve draft, get_iso3_coeffs
+    constexpr static const std::array<std::array<fp2_hex, 4>, 4> ISO3_COEFFICIENTS_HEX = {{
+        {{
+            {"0x5c759507e8e333ebb5b7a9a47d7ed8532c52d39fd3a042a88b58423c50ae15d5c2638e343d9c71c6238aaaaaaaa97d6",
+             "0x5c759507e8e333ebb5b7a9a47d7ed8532c52d39fd3a042a88b58423c50ae15d5c2638e343d9c71c6238aaaaaaaa97d6"},
+            {"0x0",
+             "0x11560bf17baa99bc32126fced787c88f984f87adf7ae0c7f9a208c6b4f20a4181472aaa9cb8d555526a9ffffffffc71a"},
+            {"0x11560bf17baa99bc32126fced787c88f984f87adf7ae0c7f9a208c6b4f20a4181472aaa9cb8d555526a9ffffffffc71e",
+             "0x8ab05f8bdd54cde190937e76bc3e447cc27c3d6fbd7063fcd104635a790520c0a395554e5c6aaaa9354ffffffffe38d"},
+            {"0x171d6541fa38ccfaed6dea691f5fb614cb14b4e7f4e810aa22d6108f142b85757098e38d0f671c7188e2aaaaaaaa5ed1",
+             "0x0"}
+        }},
+        {{
+            {"0x0", "-0x48"},
+            {"0xc", "-0xc"},
+            {"0x1", "0x0"},
+            {"0x0", "0x0"}
+        }},
+        {{
+            {"0x1530477c7ab4113b59a4c18b076d11930f7da5d4a07f649bf54439d87d27e500fc8c25ebf8c92f6812cfc71c71c6d706",
+             "0x1530477c7ab4113b59a4c18b076d11930f7da5d4a07f649bf54439d87d27e500fc8c25ebf8c92f6812cfc71c71c6d706"},
+            {"0x0",
+             "0x5c759507e8e333ebb5b7a9a47d7ed8532c52d39fd3a042a88b58423c50ae15d5c2638e343d9c71c6238aaaaaaaa97be"},
+            {"0x11560bf17baa99bc32126fced787c88f984f87adf7ae0c7f9a208c6b4f20a4181472aaa9cb8d555526a9ffffffffc71c",
+             "0x8ab05f8bdd54cde190937e76bc3e447cc27c3d6fbd7063fcd104635a790520c0a395554e5c6aaaa9354ffffffffe38f"},
+            {"0x124c9ad43b6cf79bfbf7043de3811ad0761b0f37a1e26286b0e977c69aa274524e79097a56dc4bd9e1b371c71c718b10",
+             "0x0"}
+        }},
+        {{
+            {"-0x1b0", "-0x1b0"},
+            {"0x0", "-0xd8"},
+            {"0x12", "-0x12"},
+            {"0x1", "0x0"}
+        }}
+    }};
+
+    constexpr static const std::array<fp_hex, 2> G1_GENERATOR_HEX = {
+        "0x17f1d3a73197d7942695638c4fa9ac0fc3688c4f9774b905a14e3a3f171bac586c55e83ff97a1aeffb3af00adb22c6bb",
+        "0x8b3f481e3aaa0f1a09e30ed741d8ae4fcf5e095d5d00af600db18cb2c04b3edd03cc744a2888ae40caa232946c5e7e1"
+    };
+
+    constexpr static const std::array<fp2_hex, 2> G2_GENERATOR_HEX = {{
+        {"0x24aa2b2f08f0a91260805272dc51051c6e47ad4fa403b02b4510b647ae3d1770bac0326a805bbefd48056c8c121bdb8",
+         "0x13e02b6052719f607dacd3a088274f65596bd0d09920b61ab5da61bbdc7f5049334cf11213945d57e5ac7d055d042b7e"},
+        {"0xce5d527727d6e118cc9cdc6da2e351aadfd9baa8cbdd3a76d429a695160d12c923ac9cc3baca289e193548608b82801",
+         "0x606c4a02ea734cc32acd2b02bc28b99cb3e287e85a763af267492ab572e99ab3f370d275cec1da1aaa9075ff05f79be"}
+    }};
+
+    template<std::size_t N, std::size_t K>
+    struct bls12_381_registers {
+        using fp_type = std::array<register_type<N>, K>;
+        using fp2_type = std::array<fp_type, 2>;
+
+        static constexpr fp_type from_hex(fp_hex hex) {
+            return limbs_to_registers<N, K>(limbs_from_hex(hex));
+        }
+
+        static constexpr fp2_type from_hex(const fp2_hex &hex) {
+            return {from_hex(hex[0]), from_hex(hex[1])};
+        }
+
+        template<std::size_t M>
+        static constexpr std::array<fp2_type, M> from_hex(const std::array<fp2_hex, M> &hex) {
+            std::array<fp2_type, M> out {};
+            for (std::size_t i = 0; i < M; i++) {
+                out[i] = from_hex(hex[i]);
+            }
+            return out;
+        }
+
+        // get_BLS12_381_prime
+        static constexpr fp_type prime = limbs_to_registers<N, K>(FP_MODULUS);
+
+        // coeff[j][i] with (w^i)^{p^j} = coeff[j][i] * w^i, get_Fp12_frobenius
+        static constexpr std::array<std::array<fp2_type, 6>, 12> fp12_frobenius = [] {
+            std::array<std::array<fp2_type, 6>, 12> out {};
+            for (std::size_t j = 0; j < 6; j++) {
+                for (std::size_t i = 0; i < 6; i++) {
+                    fp2_hex hex = (i == 0 || j == 0) ? fp2_hex {"0x1", "0x0"} : FP12_FROBENIUS_HEX[j - 1][i - 1];
+                    limbs_type c0 = limbs_from_hex(hex[0]);
+                    limbs_type c1 = limbs_from_hex(hex[1]);
+                    out[j][i] = {limbs_to_registers<N, K>(c0), limbs_to_registers<N, K>(c1)};
+                    // (w^i)^{p^{j + 6}} = (-1)^i (w^i)^{p^j}
+                    if (i % 2 == 1) {
+                        c0 = limbs_negate(c0);
+                        c1 = limbs_negate(c1);
+                    }
+                    out[j + 6][i] = {limbs_to_registers<N, K>(c0), limbs_to_registers<N, K>(c1)};
+                }
+            }
+            return out;
+        }();
+
+        // get_roots_of_unity
+        static constexpr std::array<fp2_type, 4> roots_of_unity = from_hex(SWU_ROOTS_OF_UNITY_HEX);
+
+        // get_etas
+        static constexpr std::array<fp2_type, 4> etas = from_hex(SWU_ETAS_HEX);
+
+        // get_iso3_coeffs
+        static constexpr std::array<std::array<fp2_type, 4>, 4> iso3_coeffs = {
+            from_hex(ISO3_COEFFICIENTS_HEX[0]), from_hex(ISO3_COEFFICIENTS_HEX[1]),
+            from_hex(ISO3_COEFFICIENTS_HEX[2]), from_hex(ISO3_COEFFICIENTS_HEX[3])};
+
+        // get_generator_G1
+        static constexpr std::array<fp_type, 2> generator_g1 = {from_hex(G1_GENERATOR_HEX[0]),
+                                                                from_hex(G1_GENERATOR_HEX[1])};
+
+        // get_generator_G2
+        static constexpr std::array<fp2_type, 2> generator_g2 = from_hex(G2_GENERATOR_HEX);
+    };
+
+    // The tables with 64-bit registers, i.e. canonical limbs, for the native field code
+    using bls12_381_limbs = bls12_381_registers<64, 6>;
+
+    template<std::size_t M>
+    std::array<fp2, M> fp2_from_limbs_table(const std::array<bls12_381_limbs::fp2_type, M> &table) {
+        std::array<fp2, M> out;
+        for (std::size_t i = 0; i < M; i++) {
+            out[i] = from_registers<64, 6>(table[i]);
+        }
+        return out;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_REGISTER_TABLES_HPP
@@ -0,0 +1,340 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+/*
+ * Plain FIPS 180-4 SHA-256 used by the native witness generator for the SSZ
+ * merkleization, expand_message_xmd and the public input commitment. Only
+ * the compression function touches the message schedule; the streaming
+ * wrapper handles buffering and padding.
+ *
+ * The compression function has a portable implementation and one on the
+ * Intel SHA extensions; sha256_compress picks the latter when CPUID reports
+ * it, so every hasher (and the sequential chains built on sha256(a, b), where
+ * the multi-buffer kernels of sha256_batch.hpp cannot help) gets it.
+ */
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_X86
+#endif
+
+namespace ethereum::consensus_proof::native {
+
+    using bytes32 = std::array<std::uint8_t, 32>;
+
+    using sha256_state_type = std::array<std::uint32_t, 8>;
+
+    constexpr static const sha256_state_type SHA256_IV = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                                          0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+    constexpr static const std::array<std::uint32_t, 64> SHA256_K = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+    inline std::uint32_t sha256_rotr(std::uint32_t x, std::uint32_t n) {
+        return (x >> n) | (x << (32 - n));
+    }
+
+    enum class sha256_backend { portable, sha_ni };
+
+    using sha256_schedule_type = std::array<std::uint32_t, 64>;
+
+    // State after compressing one all-zero block from SHA256_IV, SHA256_ZERO_BLOCK_MIDSTATE in constants.hpp
+    constexpr static const sha256_state_type SHA256_ZERO_BLOCK_MIDSTATE = {
+        0xda5698be, 0x17b9b469, 0x62335799, 0x779fbeca, 0x8ce5d491, 0xc0d26243, 0xbafef9ea, 0x1837a9d8};
+
+    // K[t] + W[t] of the block 0x80 || 0^55 || be64(512) that ends every 64-byte message (two chunks)
+    constexpr sha256_schedule_type sha256_padding_schedule() {
+        auto rotr = [](std::uint32_t x, std::uint32_t n) { return (x >> n) | (x << (32 - n)); };
+        sha256_schedule_type w {};
+        w[0] = 0x80000000;
+        w[15] = 512;
+        for (std::size_t i = 16; i < 64; i++) {
+            std::uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            std::uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        for (std::size_t i = 0; i < 64; i++) {
+            w[i] += SHA256_K[i];
+        }
+        return w;
+    }
+
+    constexpr static const sha256_schedule_type SHA256_PADDING_KW = sha256_padding_schedule();
+
+    // K[t] + W[t] of a 64-byte block; a constant block's schedule can be computed once and reused
+    inline sha256_schedule_type sha256_schedule(const std::uint8_t *block) {
+        sha256_schedule_type w;
+        for (std::size_t i = 0; i < 16; i++) {
+            w[i] = (std::uint32_t(block[4 * i]) << 24) | (std::uint32_t(block[4 * i + 1]) << 16) |
+                   (std::uint32_t(block[4 * i + 2]) << 8) | std::uint32_t(block[4 * i + 3]);
+        }
+        for (std::size_t i = 16; i < 64; i++) {
+            std::uint32_t s0 = sha256_rotr(w[i - 15], 7) ^ sha256_rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            std::uint32_t s1 = sha256_rotr(w[i - 2], 17) ^ sha256_rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        for (std::size_t i = 0; i < 64; i++) {
+            w[i] += SHA256_K[i];
+        }
+        return w;
+    }
+
+    // The 64 rounds of a block given its schedule kw = sha256_schedule(block)
+    inline void sha256_rounds_portable(sha256_state_type &state, const sha256_schedule_type &kw) {
+        std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        std::uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (std::size_t i = 0; i < 64; i++) {
+            std::uint32_t s1 = sha256_rotr(e, 6) ^ sha256_rotr(e, 11) ^ sha256_rotr(e, 25);
+            std::uint32_t ch = (e & f) ^ (~e & g);
+            std::uint32_t t1 = h + s1 + ch + kw[i];
+            std::uint32_t s0 = sha256_rotr(a, 2) ^ sha256_rotr(a, 13) ^ sha256_rotr(a, 22);
+            std::uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+            std::uint32_t t2 = s0 + maj;
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+
+    // One application of the compression function to a 64-byte block
+    inline void sha256_compress_portable(sha256_state_type &state, const std::uint8_t *block) {
+        sha256_rounds_portable(state, sha256_schedule(block));
+    }
+
+    // Big-endian encoding of a final state
+    inline bytes32 sha256_digest(const sha256_state_type &state) {
+        bytes32 out;
+        for (std::size_t i = 0; i < 8; i++) {
+            out[4 * i] = std::uint8_t(state[i] >> 24);
+            out[4 * i + 1] = std::uint8_t(state[i] >> 16);
+            out[4 * i + 2] = std::uint8_t(state[i] >> 8);
+            out[4 * i + 3] = std::uint8_t(state[i]);
+        }
+        return out;
+    }
+
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_X86
+
+    // state <-> the ABEF / CDGH register pair sha256rnds2 works on
+    __attribute__((target("sha,sse4.1"))) inline void sha256_sha_ni_load(const sha256_state_type &state, __m128i &abef,
+                                                                          __m128i &cdgh) {
+        __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[0])), 0xB1);
+        __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[4])), 0x1B);
+        abef = _mm_alignr_epi8(cdab, efgh, 8);
+        cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+    }
+
+    __attribute__((target("sha,sse4.1"))) inline void sha256_sha_ni_store(sha256_state_type &state, __m128i abef,
+                                                                           __m128i cdgh) {
+        __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+        __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+    }
+
+    // blocks consecutive 64-byte blocks with sha256rnds2 / sha256msg1 / sha256msg2;
+    // msg[g % 4] holds W[4g .. 4g + 3]
+    __attribute__((target("sha,sse4.1"))) inline void sha256_compress_sha_ni(sha256_state_type &state,
+                                                                              const std::uint8_t *block,
+                                                                              std::size_t blocks) {
+        const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+        __m128i abef, cdgh;
+        sha256_sha_ni_load(state, abef, cdgh);
+
+        for (; blocks > 0; blocks--, block += 64) {
+            __m128i abef_in = abef, cdgh_in = cdgh;
+            __m128i msg[4];
+            for (std::size_t g = 0; g < 16; g++) {
+                if (g < 4) {
+                    msg[g] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 16 * g)),
+                                              byte_swap);
+                } else {
+                    __m128i w7 = _mm_alignr_epi8(msg[(g + 3) % 4], msg[(g + 2) % 4], 4);
+                    msg[g % 4] = _mm_sha256msg2_epu32(
+                        _mm_add_epi32(_mm_sha256msg1_epu32(msg[g % 4], msg[(g + 1) % 4]), w7), msg[(g + 3) % 4]);
+                }
+                __m128i kw = _mm_add_epi32(
+                    msg[g % 4], _mm_loadu_si128(reinterpret_cast<const __m128i *>(&SHA256_K[4 * g])));
+                cdgh = _mm_sha256rnds2_epu32(cdgh, abef, kw);
+                abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(kw, 0x0E));
+            }
+            abef = _mm_add_epi32(abef, abef_in);
+            cdgh = _mm_add_epi32(cdgh, cdgh_in);
+        }
+
+        sha256_sha_ni_store(state, abef, cdgh);
+    }
+
+    __attribute__((target("sha,sse4.1"))) inline void sha256_rounds_sha_ni(sha256_state_type &state,
+                                                                            const sha256_schedule_type &kw) {
+        __m128i abef, cdgh;
+        sha256_sha_ni_load(state, abef, cdgh);
+        __m128i abef_in = abef, cdgh_in = cdgh;
+        for (std::size_t g = 0; g < 16; g++) {
+            __m128i kw4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&kw[4 * g]));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, kw4);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(kw4, 0x0E));
+        }
+        sha256_sha_ni_store(state, _mm_add_epi32(abef, abef_in), _mm_add_epi32(cdgh, cdgh_in));
+    }
+
+#endif
+
+    inline sha256_backend sha256_detect() {
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1")) {
+            return sha256_backend::sha_ni;
+        }
+#endif
+        return sha256_backend::portable;
+    }
+
+    inline sha256_backend sha256_default_backend() {
+        static const sha256_backend backend = sha256_detect();
+        return backend;
+    }
+
+    // Compression of blocks consecutive 64-byte blocks on the given backend
+    inline void sha256_compress(sha256_state_type &state, const std::uint8_t *block, std::size_t blocks = 1,
+                                sha256_backend backend = sha256_default_backend()) {
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_X86
+        if (backend == sha256_backend::sha_ni) {
+            sha256_compress_sha_ni(state, block, blocks);
+            return;
+        }
+#endif
+        for (; blocks > 0; blocks--, block += 64) {
+            sha256_compress_portable(state, block);
+        }
+    }
+
+    // Rounds of a block whose schedule kw = sha256_schedule(block) was computed beforehand
+    inline void sha256_compress_schedule(sha256_state_type &state, const sha256_schedule_type &kw,
+                                         sha256_backend backend = sha256_default_backend()) {
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_X86
+        if (backend == sha256_backend::sha_ni) {
+            sha256_rounds_sha_ni(state, kw);
+            return;
+        }
+#endif
+        sha256_rounds_portable(state, kw);
+    }
+
+    // Streaming hasher: update() any number of times, then finalize() once
+    class sha256_hasher {
+    public:
+        explicit sha256_hasher(sha256_backend backend = sha256_default_backend()) :
+            state(SHA256_IV), buffer {}, buffered(0), length(0), backend(backend) {
+        }
+
+        // Resumes from the state after a constant prefix of prefix_length bytes (a whole number
+        // of blocks), e.g. SHA256_ZERO_BLOCK_MIDSTATE for one zero block
+        sha256_hasher(const sha256_state_type &midstate, std::uint64_t prefix_length,
+                      sha256_backend backend = sha256_default_backend()) :
+            state(midstate), buffer {}, buffered(0), length(prefix_length), backend(backend) {
+            if (prefix_length % 64 != 0) {
+                throw std::invalid_argument("sha256_hasher: a midstate covers whole blocks");
+            }
+        }
+
+        void update(const std::uint8_t *data, std::size_t size) {
+            length += size;
+            while (size > 0) {
+                // whole blocks go straight from the input to the compression function
+                if (buffered == 0 && size >= 64) {
+                    sha256_compress(state, data, size / 64, backend);
+                    data += size - size % 64;
+                    size %= 64;
+                    continue;
+                }
+                std::size_t take = std::min(size, std::size_t(64) - buffered);
+                for (std::size_t i = 0; i < take; i++) {
+                    buffer[buffered + i] = data[i];
+                }
+                buffered += take;
+                data += take;
+                size -= take;
+                if (buffered == 64) {
+                    sha256_compress(state, buffer.data(), 1, backend);
+                    buffered = 0;
+                }
+            }
+        }
+
+        template<std::size_t SIZE>
+        void update(const std::array<std::uint8_t, SIZE> &data) {
+            update(data.data(), SIZE);
+        }
+
+        bytes32 finalize() {
+            std::uint64_t bit_length = length * 8;
+            std::uint8_t pad = 0x80;
+            update(&pad, 1);
+            std::uint8_t zero = 0;
+            while (buffered != 56) {
+                update(&zero, 1);
+            }
+            std::array<std::uint8_t, 8> len_be;
+            for (std::size_t i = 0; i < 8; i++) {
+                len_be[i] = std::uint8_t(bit_length >> (56 - 8 * i));
+            }
+            update(len_be);
+            return sha256_digest(state);
+        }
+
+    private:
+        sha256_state_type state;
+        std::array<std::uint8_t, 64> buffer;
+        std::size_t buffered;
+        std::uint64_t length;
+        sha256_backend backend;
+    };
+
+    inline bytes32 sha256(const std::uint8_t *data, std::size_t size) {
+        sha256_hasher hasher;
+        hasher.update(data, size);
+        return hasher.finalize();
+    }
+
+    // sha256(a || b), the node hash of SSZ merkleization; the padding block's schedule is constant
+    inline bytes32 sha256(const bytes32 &a, const bytes32 &b, sha256_backend backend = sha256_default_backend()) {
+        std::array<std::uint8_t, 64> block;
+        std::copy(a.begin(), a.end(), block.begin());
+        std::copy(b.begin(), b.end(), block.begin() + 32);
+
+        sha256_state_type state = SHA256_IV;
+        sha256_compress(state, block.data(), 1, backend);
+        sha256_compress_schedule(state, SHA256_PADDING_KW, backend);
+        return sha256_digest(state);
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_HPP
@@ -0,0 +1,177 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_BATCH_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_BATCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+
+/*
+ * Multi-buffer SHA-256 for SSZ layers. Every node of a layer is the hash of
+ * an independent 64-byte message in[2i] || in[2i + 1], so 8 (AVX2) or 16
+ * (AVX-512) of them run through the compression function in lockstep, one
+ * message per 32-bit vector lane. The second block of such a message is
+ * always the same padding block, whose schedule SHA256_PADDING_KW is a
+ * compile-time constant.
+ *
+ * The lane kernel is written once with GCC vector extensions and is inlined
+ * into target("avx2") / target("avx512f") wrappers; the backend is picked
+ * at run time like in fp_simd.hpp. A single SHA-NI stream is slower than
+ * either vector kernel on whole layers, so it only takes the remainder.
+ */
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_BATCH_X86
+#endif
+
+namespace ethereum::consensus_proof::native {
+
+    enum class sha256_batch_backend { scalar, avx2, avx512 };
+
+    // Portable sha256(in[0] || in[1]) with the padding block's schedule taken from SHA256_PADDING_KW
+    inline bytes32 sha256_pair(const bytes32 *in) {
+        sha256_state_type state = SHA256_IV;
+        sha256_compress_portable(state, in[0].data());
+        sha256_rounds_portable(state, SHA256_PADDING_KW);
+        return sha256_digest(state);
+    }
+
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_BATCH_X86
+
+    using sha256_u32x8 = std::uint32_t __attribute__((vector_size(32)));
+    using sha256_u32x16 = std::uint32_t __attribute__((vector_size(64)));
+
+    // Rounds of one block on transposed states, kw[t] = K[t] + W[t] of the block. Rotations are
+    // spelled out as shift pairs, the compiler turns them into vprord where AVX-512 has one
+    template<typename V>
+    __attribute__((always_inline)) inline void sha256_lanes_rounds(V (&state)[8], const V (&kw)[64]) {
+        V a = state[0], b = state[1], c = state[2], d = state[3];
+        V e = state[4], f = state[5], g = state[6], h = state[7];
+        for (std::size_t i = 0; i < 64; i++) {
+            V s1 = (e >> 6 | e << 26) ^ (e >> 11 | e << 21) ^ (e >> 25 | e << 7);
+            V ch = (e & f) ^ (~e & g);
+            V t1 = h + s1 + ch + kw[i];
+            V s0 = (a >> 2 | a << 30) ^ (a >> 13 | a << 19) ^ (a >> 22 | a << 10);
+            V maj = (a & b) ^ (c & (a ^ b));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + s0 + maj;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+
+    // out[l] = sha256(in[2l] || in[2l + 1]) for the LANES lanes of V
+    template<typename V, std::size_t LANES>
+    __attribute__((always_inline)) inline void sha256_pairs_lanes(bytes32 *out, const bytes32 *in) {
+        V w[64];
+        for (std::size_t t = 0; t < 16; t++) {
+            for (std::size_t l = 0; l < LANES; l++) {
+                const std::uint8_t *word = in[2 * l + t / 8].data() + 4 * (t % 8);
+                w[t][l] = (std::uint32_t(word[0]) << 24) | (std::uint32_t(word[1]) << 16) |
+                          (std::uint32_t(word[2]) << 8) | std::uint32_t(word[3]);
+            }
+        }
+        for (std::size_t i = 16; i < 64; i++) {
+            V s0 = (w[i - 15] >> 7 | w[i - 15] << 25) ^ (w[i - 15] >> 18 | w[i - 15] << 14) ^ (w[i - 15] >> 3);
+            V s1 = (w[i - 2] >> 17 | w[i - 2] << 15) ^ (w[i - 2] >> 19 | w[i - 2] << 13) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        V padding[64];
+        for (std::size_t i = 0; i < 64; i++) {
+            w[i] += SHA256_K[i];
+            padding[i] = V {} + SHA256_PADDING_KW[i];
+        }
+
+        V state[8];
+        for (std::size_t j = 0; j < 8; j++) {
+            state[j] = V {} + SHA256_IV[j];
+        }
+        sha256_lanes_rounds<V>(state, w);
+        sha256_lanes_rounds<V>(state, padding);
+
+        for (std::size_t l = 0; l < LANES; l++) {
+            for (std::size_t j = 0; j < 8; j++) {
+                std::uint32_t word = state[j][l];
+                out[l][4 * j] = std::uint8_t(word >> 24);
+                out[l][4 * j + 1] = std::uint8_t(word >> 16);
+                out[l][4 * j + 2] = std::uint8_t(word >> 8);
+                out[l][4 * j + 3] = std::uint8_t(word);
+            }
+        }
+    }
+
+    __attribute__((target("avx2"))) inline void sha256_pairs_avx2(bytes32 *out, const bytes32 *in,
+                                                                  std::size_t count) {
+        for (std::size_t i = 0; i < count; i += 8) {
+            sha256_pairs_lanes<sha256_u32x8, 8>(out + i, in + 2 * i);
+        }
+    }
+
+    __attribute__((target("avx512f"))) inline void sha256_pairs_avx512(bytes32 *out, const bytes32 *in,
+                                                                      std::size_t count) {
+        for (std::size_t i = 0; i < count; i += 16) {
+            sha256_pairs_lanes<sha256_u32x16, 16>(out + i, in + 2 * i);
+        }
+    }
+
+#endif
+
+    // Widest backend supported by the CPU we run on
+    inline sha256_batch_backend sha256_batch_detect() {
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_BATCH_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return sha256_batch_backend::avx512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return sha256_batch_backend::avx2;
+        }
+#endif
+        return sha256_batch_backend::scalar;
+    }
+
+    inline sha256_batch_backend sha256_batch_default_backend() {
+        static const sha256_batch_backend backend = sha256_batch_detect();
+        return backend;
+    }
+
+    // out[i] = sha256(in[2i] || in[2i + 1]) for i < count; whole groups of lanes go to the
+    // vector backend, the remainder is hashed one pair at a time (with SHA-NI if the CPU has it)
+    inline void sha256_pairs(bytes32 *out, const bytes32 *in, std::size_t count,
+                             sha256_batch_backend backend = sha256_batch_default_backend()) {
+        std::size_t done = 0;
+#ifdef ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_BATCH_X86
+        if (backend == sha256_batch_backend::avx512) {
+            done = count - count % 16;
+            sha256_pairs_avx512(out, in, done);
+        }
+        if (backend != sha256_batch_backend::scalar && count - done >= 8) {
+            std::size_t lanes = (count - done) - (count - done) % 8;
+            sha256_pairs_avx2(out + done, in + 2 * done, lanes);
+            done += lanes;
+        }
+#endif
+        sha256_backend single = sha256_default_backend();
+        for (std::size_t i = done; i < count; i++) {
+            out[i] = single == sha256_backend::sha_ni ? sha256(in[2 * i], in[2 * i + 1], single)
+                                                      : sha256_pair(in + 2 * i);
+        }
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_SHA256_BATCH_HPP
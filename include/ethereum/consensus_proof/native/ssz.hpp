@@ -0,0 +1,146 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_SSZ_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_SSZ_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <ethereum/consensus_proof/constants.hpp>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/sha256_batch.hpp>
+
+/*
+ * Native counterparts of the SSZ templates in ssz.hpp: merkleization of
+ * fixed size containers, the BeaconBlockHeader and SyncCommittee roots, the
+ * signing root and merkle branch verification. Whole layers are handed to
+ * the multi-buffer hasher of sha256_batch.hpp. Padding chunks are never
+ * hashed: a subtree made only of zero chunks is looked up in the zero hash
+ * table, so a list is merkleized at the cost of its real chunks.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    using g1_bytes_type = std::array<std::uint8_t, 48>;
+
+    // zero_hashes[d] is the root of a subtree of 2^d zero chunks, SSZ_ZERO_HASHES as bytes
+    inline const std::array<bytes32, SSZ_ZERO_HASH_DEPTH + 1> &ssz_zero_hashes() {
+        static const std::array<bytes32, SSZ_ZERO_HASH_DEPTH + 1> zero_hashes = [] {
+            std::array<bytes32, SSZ_ZERO_HASH_DEPTH + 1> out;
+            for (std::size_t d = 0; d <= SSZ_ZERO_HASH_DEPTH; d++) {
+                for (std::size_t i = 0; i < 32; i++) {
+                    out[d][i] = std::uint8_t(SSZ_ZERO_HASHES[d][i]);
+                }
+            }
+            return out;
+        }();
+        return zero_hashes;
+    }
+
+    // Hashes one layer of 32-byte nodes pairwise, SSZLayer
+    inline std::vector<bytes32> ssz_layer(const std::vector<bytes32> &in) {
+        std::vector<bytes32> out(in.size() / 2);
+        sha256_pairs(out.data(), in.data(), out.size());
+        return out;
+    }
+
+    // Root of chunks right padded with zero chunks to 2^depth, SSZArrayPadded. Only the
+    // nodes with a real chunk below them are hashed; the last one of an odd layer is paired
+    // with the zero subtree of that height.
+    inline bytes32 ssz_merkleize(std::vector<bytes32> chunks, std::size_t depth) {
+        if (depth > SSZ_ZERO_HASH_DEPTH || (depth < 64 && chunks.size() > (std::size_t(1) << depth))) {
+            throw std::invalid_argument("ssz_merkleize: too many chunks for the tree depth");
+        }
+        if (chunks.empty()) {
+            return ssz_zero_hashes()[depth];
+        }
+        // layers are hashed in place: node i of the next layer only overwrites nodes 2i, 2i + 1
+        for (std::size_t d = 0; d < depth; d++) {
+            if (chunks.size() % 2 == 1) {
+                chunks.push_back(ssz_zero_hashes()[d]);
+            }
+            sha256_pairs(chunks.data(), chunks.data(), chunks.size() / 2);
+            chunks.resize(chunks.size() / 2);
+        }
+        return chunks[0];
+    }
+
+    // Root of a power of two number of chunks, SSZArray
+    inline bytes32 ssz_merkleize(std::vector<bytes32> chunks) {
+        if (chunks.empty() || (chunks.size() & (chunks.size() - 1)) != 0) {
+            throw std::invalid_argument("ssz_merkleize: chunk count must be a power of two");
+        }
+        std::size_t depth = 0;
+        while ((std::size_t(1) << depth) < chunks.size()) {
+            depth++;
+        }
+        return ssz_merkleize(std::move(chunks), depth);
+    }
+
+    // The two chunks of a 48-byte G1 point right padded to 64 bytes
+    inline void ssz_g1_point_chunks(const g1_bytes_type &point, bytes32 *out) {
+        out[1] = bytes32 {};
+        for (std::size_t i = 0; i < 48; i++) {
+            out[i / 32][i % 32] = point[i];
+        }
+    }
+
+    // hash_tree_root of a 48-byte G1 point
+    inline bytes32 ssz_g1_point_root(const g1_bytes_type &point) {
+        std::array<bytes32, 2> chunks;
+        ssz_g1_point_chunks(point, chunks.data());
+        return sha256(chunks[0], chunks[1]);
+    }
+
+    // SSZPhase0SyncCommittee; the pubkey roots are one more layer of the batched hasher
+    inline bytes32 ssz_sync_committee_root(const std::vector<g1_bytes_type> &pubkeys,
+                                           const g1_bytes_type &aggregate_pubkey) {
+        std::vector<bytes32> chunks(2 * pubkeys.size());
+        for (std::size_t i = 0; i < pubkeys.size(); i++) {
+            ssz_g1_point_chunks(pubkeys[i], chunks.data() + 2 * i);
+        }
+        std::vector<bytes32> leaves = ssz_layer(chunks);
+        return sha256(ssz_merkleize(std::move(leaves)), ssz_g1_point_root(aggregate_pubkey));
+    }
+
+    struct beacon_block_header {
+        bytes32 slot;
+        bytes32 proposer_index;
+        bytes32 parent_root;
+        bytes32 state_root;
+        bytes32 body_root;
+    };
+
+    // SSZPhase0BeaconBlockHeader, five fields padded to eight chunks (six compressions instead of seven)
+    inline bytes32 ssz_beacon_block_header_root(const beacon_block_header &header) {
+        return ssz_merkleize({header.slot, header.proposer_index, header.parent_root, header.state_root,
+                              header.body_root},
+                             3);
+    }
+
+    // SSZPhase0SigningRoot
+    inline bytes32 ssz_signing_root(const bytes32 &header_root, const bytes32 &domain) {
+        return sha256(header_root, domain);
+    }
+
+    // SSZRestoreMerkleRoot: walks the branch from leaf to root, bit i of index
+    // tells whether the running node is the right child at depth i
+    inline bytes32 ssz_restore_merkle_root(const bytes32 &leaf, const std::vector<bytes32> &branch,
+                                           std::size_t index) {
+        bytes32 node = leaf;
+        for (std::size_t i = 0; i < branch.size(); i++) {
+            if ((index >> i) & 1) {
+                node = sha256(branch[i], node);
+            } else {
+                node = sha256(node, branch[i]);
+            }
+        }
+        return node;
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_SSZ_HPP
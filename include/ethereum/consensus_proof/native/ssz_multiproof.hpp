@@ -0,0 +1,169 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_SSZ_MULTIPROOF_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_SSZ_MULTIPROOF_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+
+/*
+ * SSZ multiproofs, checked off-circuit only. Nodes are named by
+ * generalized index (the root is 1, the children of g are 2g and 2g + 1,
+ * leaf i of a depth d branch is 2^d + i). A multiproof carries its leaves
+ * and the deduplicated helper nodes of ssz_helper_indices, and every node
+ * on the union of the leaf paths is hashed exactly once. Several proofs
+ * against the same root (the finality and sync committee branches of one
+ * state, or a batch of updates anchored to it) are merged into one so the
+ * shared ancestors are recomputed once for all of them.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    using ssz_gindex = std::uint64_t;
+
+    // generalized index of node index at depth depth
+    inline ssz_gindex ssz_generalized_index(std::size_t depth, std::size_t index) {
+        if (depth >= 64 || index >> depth != 0) {
+            throw std::invalid_argument("ssz_generalized_index: index out of range for the depth");
+        }
+        return (ssz_gindex(1) << depth) | index;
+    }
+
+    // get_helper_indices: siblings of the path nodes that are not path nodes themselves, decreasing.
+    // An index above another one is rejected, nothing would tie the lower leaf to the root.
+    inline std::vector<ssz_gindex> ssz_helper_indices(const std::vector<ssz_gindex> &indices) {
+        std::set<ssz_gindex, std::greater<ssz_gindex>> siblings, paths, ancestors;
+        for (ssz_gindex g : indices) {
+            if (g == 0) {
+                throw std::invalid_argument("ssz_helper_indices: 0 is not a generalized index");
+            }
+            for (; g > 1; g /= 2) {
+                siblings.insert(g ^ 1);
+                paths.insert(g);
+                ancestors.insert(g / 2);
+            }
+        }
+        for (ssz_gindex g : indices) {
+            if (ancestors.count(g) != 0) {
+                throw std::invalid_argument("ssz_helper_indices: an index is an ancestor of another one");
+            }
+        }
+        std::vector<ssz_gindex> out;
+        for (ssz_gindex g : siblings) {
+            if (paths.count(g) == 0) {
+                out.push_back(g);
+            }
+        }
+        return out;
+    }
+
+    struct ssz_multiproof {
+        std::vector<ssz_gindex> indices;
+        std::vector<bytes32> leaves;
+        // the nodes at ssz_helper_indices(indices), in that order
+        std::vector<bytes32> helpers;
+    };
+
+    // The branch of ssz_restore_merkle_root(leaf, branch, index) as a one-leaf multiproof
+    inline ssz_multiproof ssz_branch_multiproof(const bytes32 &leaf, const std::vector<bytes32> &branch,
+                                                std::size_t index) {
+        ssz_multiproof out;
+        out.indices = {ssz_generalized_index(branch.size(), index)};
+        out.leaves = {leaf};
+        // the branch runs from the leaf up, which is the decreasing order of the helpers
+        out.helpers = branch;
+        return out;
+    }
+
+    // calculate_multi_merkle_root; hashes, if given, receives the number of compressions of
+    // 64-byte messages, one per distinct ancestor
+    inline bytes32 ssz_multiproof_root(const ssz_multiproof &proof, std::size_t *hashes = nullptr) {
+        std::vector<ssz_gindex> helper_indices = ssz_helper_indices(proof.indices);
+        if (proof.leaves.size() != proof.indices.size() || proof.helpers.size() != helper_indices.size()) {
+            throw std::invalid_argument("ssz_multiproof_root: node count does not match the indices");
+        }
+
+        std::map<ssz_gindex, bytes32, std::greater<ssz_gindex>> nodes;
+        for (std::size_t i = 0; i < proof.indices.size(); i++) {
+            auto [it, inserted] = nodes.emplace(proof.indices[i], proof.leaves[i]);
+            if (!inserted && it->second != proof.leaves[i]) {
+                throw std::invalid_argument("ssz_multiproof_root: conflicting leaves at one index");
+            }
+        }
+        for (std::size_t i = 0; i < helper_indices.size(); i++) {
+            nodes.emplace(helper_indices[i], proof.helpers[i]);
+        }
+
+        // decreasing order visits both children of a node before the node itself
+        std::size_t count = 0;
+        for (auto it = nodes.begin(); it != nodes.end() && it->first > 1; it++) {
+            ssz_gindex g = it->first;
+            if (nodes.count(g / 2) != 0) {
+                continue;    // hashed from the sibling
+            }
+            auto sibling = nodes.find(g ^ 1);
+            if (sibling == nodes.end()) {
+                throw std::invalid_argument("ssz_multiproof_root: missing helper node");
+            }
+            nodes.emplace(g / 2, (g & 1) ? sha256(sibling->second, it->second) : sha256(it->second, sibling->second));
+            count++;
+        }
+        if (hashes != nullptr) {
+            *hashes = count;
+        }
+        return nodes.at(1);
+    }
+
+    inline bool ssz_verify_multiproof(const ssz_multiproof &proof, const bytes32 &root) {
+        return ssz_multiproof_root(proof) == root;
+    }
+
+    // One multiproof for the union of the leaves of proofs over the same root. A node given by
+    // several proofs must be the same in all of them.
+    inline ssz_multiproof ssz_merge_multiproofs(const std::vector<ssz_multiproof> &proofs) {
+        std::map<ssz_gindex, bytes32> leaves, known;
+        auto add = [](std::map<ssz_gindex, bytes32> &nodes, ssz_gindex g, const bytes32 &node) {
+            auto [it, inserted] = nodes.emplace(g, node);
+            if (!inserted && it->second != node) {
+                throw std::invalid_argument("ssz_merge_multiproofs: proofs disagree on a node");
+            }
+        };
+        for (const ssz_multiproof &proof : proofs) {
+            std::vector<ssz_gindex> helper_indices = ssz_helper_indices(proof.indices);
+            if (proof.leaves.size() != proof.indices.size() || proof.helpers.size() != helper_indices.size()) {
+                throw std::invalid_argument("ssz_merge_multiproofs: node count does not match the indices");
+            }
+            for (std::size_t i = 0; i < proof.indices.size(); i++) {
+                add(leaves, proof.indices[i], proof.leaves[i]);
+                add(known, proof.indices[i], proof.leaves[i]);
+            }
+            for (std::size_t i = 0; i < helper_indices.size(); i++) {
+                add(known, helper_indices[i], proof.helpers[i]);
+            }
+        }
+
+        ssz_multiproof out;
+        for (const auto &[g, node] : leaves) {
+            out.indices.push_back(g);
+            out.leaves.push_back(node);
+        }
+        // every helper of the union is a helper of the proof whose path it borders
+        for (ssz_gindex g : ssz_helper_indices(out.indices)) {
+            out.helpers.push_back(known.at(g));
+        }
+        return out;
+    }
+
+    // Batch check of proofs anchored to the same root: shared ancestors are hashed once
+    inline bool ssz_verify_multiproofs(const std::vector<ssz_multiproof> &proofs, const bytes32 &root) {
+        return ssz_verify_multiproof(ssz_merge_multiproofs(proofs), root);
+    }
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_SSZ_MULTIPROOF_HPP
@@ -0,0 +1,325 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_STEP_WITNESS_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_STEP_WITNESS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <ethereum/consensus_proof/constants.hpp>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/fp12.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/ssz.hpp>
+#include <ethereum/consensus_proof/native/hash_to_field.hpp>
+#include <ethereum/consensus_proof/native/hash_to_g2.hpp>
+#include <ethereum/consensus_proof/native/hash_to_g2_cache.hpp>
+#include <ethereum/consensus_proof/native/pairing.hpp>
+#include <ethereum/consensus_proof/native/bls.hpp>
+#include <ethereum/consensus_proof/native/aggregate_pubkey.hpp>
+#include <ethereum/consensus_proof/native/inputs.hpp>
+#include <ethereum/consensus_proof/native/poseidon.hpp>
+#include <ethereum/consensus_proof/native/thread_pool.hpp>
+
+/*
+ * Out-of-circuit witness generator for Step (src/step.cpp). Everything is
+ * computed with native 64-bit limb arithmetic: SSZ roots and the signing
+ * root, the aggregate public key and its reduction tree, hash_to_field and
+ * MapToG2 with its intermediate points, the Miller loop accumulators and
+ * the final exponentiation. Only step_witness_registers re-encodes the
+ * field elements into the N x K register layout (NUM_BITS_PER_REGISTER x
+ * NUM_REGISTERS) expected by the circuit. Inconsistent inputs, including
+ * a syncCommitteePoseidon that is not the commitment to the pubkeys, are
+ * reported with std::invalid_argument, exactly where the circuit would have
+ * an unsatisfiable constraint.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    struct step_input {
+        beacon_block_header attested_header;
+        beacon_block_header finalized_header;
+
+        std::vector<g1_point> pubkeys;
+        std::vector<bool> aggregation_bits;
+        g2_point signature;
+        bytes32 domain;
+        // little-endian encoding of the Poseidon commitment produced by Rotate
+        bytes32 sync_committee_poseidon;
+
+        std::vector<bytes32> finality_branch;
+        bytes32 execution_state_root;
+        std::vector<bytes32> execution_state_branch;
+    };
+
+    struct step_witness {
+        bytes32 attested_header_root;
+        bytes32 finalized_header_root;
+        bytes32 signing_root;
+        std::uint64_t participation;
+        bytes32 public_inputs_root;
+
+        g1_add_many_trace aggregation;
+        g1_point aggregate_pubkey;
+
+        std::array<fp2, 2> hash_to_field;
+        g2_point hm;
+        map_to_g2_trace hm_trace;
+
+        miller_loop_trace miller_loop;
+        fp12 miller_loop_out;
+        fp12 final_exp_easy_part;
+        final_exp_hard_trace final_exp_hard_part;
+        fp12 final_exp_out;
+    };
+
+    // aggregate(bits, trace) fills the G1AddMany trace for in.pubkeys and returns its root;
+    // hm_cache, if given, supplies hash_to_field and H(m) of signing roots seen before;
+    // pool, if given, is used for the Poseidon commitment to the pubkeys
+    template<typename AggregateFunction>
+    step_witness generate_step_witness_with(const step_input &in, AggregateFunction &&aggregate,
+                                            hash_to_g2_cache *hm_cache = nullptr, thread_pool *pool = nullptr) {
+        if (in.pubkeys.size() != SYNC_COMMITTEE_SIZE || in.aggregation_bits.size() != SYNC_COMMITTEE_SIZE) {
+            throw std::invalid_argument("generate_step_witness: expected SYNC_COMMITTEE_SIZE pubkeys and bits");
+        }
+        if (in.finality_branch.size() != FINALIZED_HEADER_DEPTH ||
+            in.execution_state_branch.size() != EXECUTION_STATE_ROOT_DEPTH) {
+            throw std::invalid_argument("generate_step_witness: unexpected merkle branch depth");
+        }
+
+        step_witness out;
+
+        /* VALIDATE PUBKEYS AGAINST SYNC COMMITTEE ROOT */
+        if (sync_committee_poseidon(in.pubkeys, pool) != in.sync_committee_poseidon) {
+            throw std::invalid_argument("generate_step_witness: sync committee poseidon does not match pubkeys");
+        }
+
+        /* VALIDATE BEACON CHAIN DATA AGAINST SIGNING ROOT */
+        out.attested_header_root = ssz_beacon_block_header_root(in.attested_header);
+        out.finalized_header_root = ssz_beacon_block_header_root(in.finalized_header);
+        out.signing_root = ssz_signing_root(out.attested_header_root, in.domain);
+
+        /* VERIFY FINALITY PROOF */
+        if (ssz_restore_merkle_root(out.finalized_header_root, in.finality_branch, FINALIZED_HEADER_INDEX) !=
+            in.attested_header.state_root) {
+            throw std::invalid_argument("generate_step_witness: finality branch does not match attested state root");
+        }
+
+        /* VERIFY EXECUTION STATE PROOF */
+        if (ssz_restore_merkle_root(in.execution_state_root, in.execution_state_branch,
+                                    EXECUTION_STATE_ROOT_INDEX) != in.finalized_header.body_root) {
+            throw std::invalid_argument("generate_step_witness: execution state branch does not match body root");
+        }
+
+        /* COMPUTE SYNC COMMITTEE PARTICIPATION */
+        out.participation = 0;
+        for (bool bit : in.aggregation_bits) {
+            out.participation += bit ? 1 : 0;
+        }
+        if (out.participation == 0) {
+            throw std::invalid_argument("generate_step_witness: participation must be non-zero");
+        }
+
+        /* COMPUTE AGGREGATE PUBKEY BASED ON AGGREGATION BITS */
+        out.aggregate_pubkey = aggregate(in.aggregation_bits, out.aggregation);
+        if (out.aggregate_pubkey.infinity) {
+            throw std::invalid_argument("generate_step_witness: aggregate pubkey is the point at infinity");
+        }
+
+        /* HASH SIGNING ROOT TO G2 */
+        if (hm_cache != nullptr) {
+            std::shared_ptr<const hash_to_g2_entry> cached = hm_cache->get(out.signing_root);
+            out.hash_to_field = cached->hash_to_field;
+            out.hm = cached->hm;
+            out.hm_trace = cached->hm_trace;
+        } else {
+            out.hash_to_field = hash_to_field(out.signing_root.data(), out.signing_root.size());
+            out.hm = map_to_g2(out.hash_to_field, &out.hm_trace);
+        }
+
+        /* VERIFY BLS SIGNATURE */
+        out.miller_loop_out =
+            miller_loop_two({negate(in.signature), out.hm},
+                            {g1_generator_line_point(), prepare_line_point(out.aggregate_pubkey)}, &out.miller_loop);
+        out.final_exp_easy_part = final_exp_easy_part(out.miller_loop_out);
+        out.final_exp_out = final_exp_hard_part(out.final_exp_easy_part, &out.final_exp_hard_part);
+        if (!out.final_exp_out.is_one()) {
+            throw std::invalid_argument("generate_step_witness: invalid sync committee signature");
+        }
+
+        /* REDUCE CALLDATA COSTS VIA THE PUBLIC INPUTS ROOT */
+        out.public_inputs_root = commit_to_public_inputs_for_step<TRUNCATED_SHA256_SIZE>(
+            {in.attested_header.slot, in.finalized_header.slot, out.finalized_header_root, out.participation,
+             in.execution_state_root, in.sync_committee_poseidon});
+
+        return out;
+    }
+
+    // pool, if given, is used to spread the aggregate pubkey reduction over several threads;
+    // committee, if given, must hold in.pubkeys and lets the reduction start from its full tree
+    inline step_witness generate_step_witness(const step_input &in, thread_pool *pool = nullptr,
+                                              const committee_aggregate *committee = nullptr,
+                                              hash_to_g2_cache *hm_cache = nullptr) {
+        if (committee != nullptr && committee->keys() != in.pubkeys) {
+            throw std::invalid_argument("generate_step_witness: committee precomputation is for other pubkeys");
+        }
+        return generate_step_witness_with(in, [&](const std::vector<bool> &bits, g1_add_many_trace &trace) {
+            if (committee != nullptr) {
+                return committee->aggregate(bits, trace, pool);
+            }
+            return g1_add_many_batched(in.pubkeys, bits, pool, &trace);
+        }, hm_cache, pool);
+    }
+
+    // Follow head mode: the aggregate pubkey trace is updated from the previous slot's one.
+    // follower must keep its trace and be built over in.pubkeys.
+    inline step_witness generate_step_witness(const step_input &in, incremental_aggregate &follower,
+                                              thread_pool *pool = nullptr, hash_to_g2_cache *hm_cache = nullptr) {
+        if (follower.base().keys() != in.pubkeys) {
+            throw std::invalid_argument("generate_step_witness: committee precomputation is for other pubkeys");
+        }
+        return generate_step_witness_with(in, [&](const std::vector<bool> &bits, g1_add_many_trace &trace) {
+            g1_point result = follower.update(bits, pool);
+            trace = follower.trace();
+            return result;
+        }, hm_cache, pool);
+    }
+
+    // The signals of Step that the witness sets, field elements in the circuit's register layout
+    template<std::size_t N = NUM_BITS_PER_REGISTER, std::size_t K = NUM_REGISTERS>
+    struct step_witness_registers {
+        using fp_registers = std::array<std::size_t, K>;
+        using fp2_registers = std::array<fp_registers, 2>;
+        using fp12_registers = std::array<fp2_registers, 6>;
+        using g1_registers = std::array<fp_registers, 2>;
+        using g2_registers = std::array<fp2_registers, 2>;
+
+        // EllipticCurveScalarMultiplyFp2 by |x|, as g2_scalar_mul_trace
+        struct g2_scalar_mul_registers {
+            std::vector<g2_registers> doubled;
+            std::vector<g2_registers> partial;
+        };
+
+        // MapToG2, as map_to_g2_trace
+        struct map_to_g2_registers {
+            struct swu_registers {
+                fp2_registers x0;
+                fp2_registers x1;
+                std::size_t is_square;
+                g2_registers out;
+            };
+
+            std::array<swu_registers, 2> swu;
+            g2_registers sum;
+            g2_registers iso;
+            g2_scalar_mul_registers x_p;
+            g2_registers psi_p;
+            g2_registers dbl_p;
+            g2_registers psi2_dbl_p;
+            std::array<g2_registers, 5> add;
+            g2_scalar_mul_registers x_add1;
+            g2_registers out;
+        };
+
+        std::vector<fp_registers> pubkeys_x;
+        std::vector<fp_registers> pubkeys_y;
+        g2_registers signature;
+
+        // reducers[i].out and reducers[i].outBits of G1AddMany
+        std::vector<std::vector<g1_registers>> aggregation_out;
+        std::vector<std::vector<std::size_t>> aggregation_out_bits;
+        g1_registers aggregate_pubkey;
+
+        std::array<fp2_registers, 2> hash_to_field;
+        map_to_g2_registers hm_trace;
+        g2_registers hm;
+
+        std::vector<fp12_registers> miller_loop_f;
+        std::vector<std::array<g2_registers, 2>> miller_loop_r;
+        fp12_registers final_exp_easy_part;
+        // pow[0 .. 13) of FinalExpHardPart
+        std::array<fp12_registers, 13> final_exp_hard_part;
+        fp12_registers final_exp_out;
+
+        // publicInputsRoot is a single field element, kept as its little-endian bytes
+        bytes32 public_inputs_root;
+
+        step_witness_registers(const step_input &in, const step_witness &witness) {
+            for (const g1_point &pubkey : in.pubkeys) {
+                pubkeys_x.push_back(to_registers<N, K>(pubkey.x));
+                pubkeys_y.push_back(to_registers<N, K>(pubkey.y));
+            }
+            signature = to_registers<N, K>(in.signature);
+
+            for (std::size_t i = 1; i < witness.aggregation.levels.size(); i++) {
+                std::vector<g1_registers> &out = aggregation_out.emplace_back();
+                std::vector<std::size_t> &out_bits = aggregation_out_bits.emplace_back();
+                for (const g1_point &p : witness.aggregation.levels[i]) {
+                    out.push_back(to_registers<N, K>(p));
+                    out_bits.push_back(p.infinity ? 0 : 1);
+                }
+            }
+            aggregate_pubkey = to_registers<N, K>(witness.aggregate_pubkey);
+
+            hash_to_field = {to_registers<N, K>(witness.hash_to_field[0]),
+                             to_registers<N, K>(witness.hash_to_field[1])};
+            hm_trace = from_trace(witness.hm_trace);
+            hm = to_registers<N, K>(witness.hm);
+
+            for (const fp12 &f : witness.miller_loop.f) {
+                miller_loop_f.push_back(to_registers<N, K>(f));
+            }
+            for (const std::array<g2_point, 2> &r : witness.miller_loop.r) {
+                miller_loop_r.push_back({to_registers<N, K>(r[0]), to_registers<N, K>(r[1])});
+            }
+            final_exp_easy_part = to_registers<N, K>(witness.final_exp_easy_part);
+            for (std::size_t i = 0; i < final_exp_hard_part.size(); i++) {
+                final_exp_hard_part[i] = to_registers<N, K>(witness.final_exp_hard_part[i]);
+            }
+            final_exp_out = to_registers<N, K>(witness.final_exp_out);
+
+            public_inputs_root = witness.public_inputs_root;
+        }
+
+    private:
+        static g2_scalar_mul_registers from_trace(const g2_scalar_mul_trace &trace) {
+            g2_scalar_mul_registers out;
+            for (const g2_point &p : trace.doubled) {
+                out.doubled.push_back(to_registers<N, K>(p));
+            }
+            for (const g2_point &p : trace.partial) {
+                out.partial.push_back(to_registers<N, K>(p));
+            }
+            return out;
+        }
+
+        static map_to_g2_registers from_trace(const map_to_g2_trace &trace) {
+            map_to_g2_registers out;
+            for (std::size_t i = 0; i < 2; i++) {
+                out.swu[i] = {to_registers<N, K>(trace.swu[i].x0), to_registers<N, K>(trace.swu[i].x1),
+                              trace.swu[i].is_square ? std::size_t(1) : std::size_t(0),
+                              to_registers<N, K>(trace.swu[i].out)};
+            }
+            out.sum = to_registers<N, K>(trace.sum);
+            out.iso = to_registers<N, K>(trace.iso);
+            out.x_p = from_trace(trace.clear_cofactor.x_p);
+            out.psi_p = to_registers<N, K>(trace.clear_cofactor.psi_p);
+            out.dbl_p = to_registers<N, K>(trace.clear_cofactor.dbl_p);
+            out.psi2_dbl_p = to_registers<N, K>(trace.clear_cofactor.psi2_dbl_p);
+            for (std::size_t i = 0; i < out.add.size(); i++) {
+                out.add[i] = to_registers<N, K>(trace.clear_cofactor.add[i]);
+            }
+            out.x_add1 = from_trace(trace.clear_cofactor.x_add1);
+            out.out = to_registers<N, K>(trace.out);
+            return out;
+        }
+    };
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_STEP_WITNESS_HPP
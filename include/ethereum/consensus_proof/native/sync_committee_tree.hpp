@@ -0,0 +1,143 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_SYNC_COMMITTEE_TREE_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_SYNC_COMMITTEE_TREE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/ssz.hpp>
+#include <ethereum/consensus_proof/native/lru_cache.hpp>
+
+/*
+ * Memoised SSZPhase0SyncCommittee tree. A committee is fixed for a whole
+ * period (256 epochs), so its merkle tree is built once with every layer
+ * kept (1023 nodes, 32 KiB for 512 keys) and the root, the pubkeys root
+ * and the branch of any pubkey are then read off in O(depth) without
+ * hashing. sync_committee_tree_cache shares the trees between the Rotate
+ * witnesses and native checks of a period, keyed by the SSZ root.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    class sync_committee_tree {
+    public:
+        sync_committee_tree(const std::vector<g1_bytes_type> &pubkeys, const g1_bytes_type &aggregate_pubkey) {
+            if (pubkeys.empty() || (pubkeys.size() & (pubkeys.size() - 1)) != 0) {
+                throw std::invalid_argument("sync_committee_tree: pubkey count must be a power of two");
+            }
+            std::vector<bytes32> chunks(2 * pubkeys.size());
+            for (std::size_t i = 0; i < pubkeys.size(); i++) {
+                ssz_g1_point_chunks(pubkeys[i], chunks.data() + 2 * i);
+            }
+            layers.push_back(ssz_layer(chunks));
+            while (layers.back().size() > 1) {
+                layers.push_back(ssz_layer(layers.back()));
+            }
+            aggregate_root = ssz_g1_point_root(aggregate_pubkey);
+            container_root = sha256(pubkeys_root(), aggregate_root);
+        }
+
+        std::size_t size() const {
+            return layers[0].size();
+        }
+
+        // log2 of the committee size; a pubkey branch is one node longer (the aggregate pubkey root)
+        std::size_t depth() const {
+            return layers.size() - 1;
+        }
+
+        // hash_tree_root of the SyncCommittee container
+        const bytes32 &root() const {
+            return container_root;
+        }
+
+        const bytes32 &pubkeys_root() const {
+            return layers.back()[0];
+        }
+
+        const bytes32 &aggregate_pubkey_root() const {
+            return aggregate_root;
+        }
+
+        // hash_tree_root of pubkey i, the leaf its branch starts from
+        const bytes32 &leaf(std::size_t index) const {
+            check_index(index);
+            return layers[0][index];
+        }
+
+        // Siblings from pubkey i's leaf up to root(), as read by ssz_restore_merkle_root(leaf(i), branch(i), i)
+        std::vector<bytes32> branch(std::size_t index) const {
+            check_index(index);
+            std::vector<bytes32> out;
+            out.reserve(depth() + 1);
+            for (std::size_t level = 0; level < depth(); level++) {
+                out.push_back(layers[level][(index >> level) ^ 1]);
+            }
+            out.push_back(aggregate_root);
+            return out;
+        }
+
+        // Nodes of one layer, level 0 being the pubkey roots and level depth() the pubkeys root
+        const std::vector<bytes32> &layer(std::size_t level) const {
+            if (level >= layers.size()) {
+                throw std::invalid_argument("sync_committee_tree: layer index out of range");
+            }
+            return layers[level];
+        }
+
+    private:
+        void check_index(std::size_t index) const {
+            if (index >= size()) {
+                throw std::invalid_argument("sync_committee_tree: pubkey index out of range");
+            }
+        }
+
+        std::vector<std::vector<bytes32>> layers;
+        bytes32 aggregate_root;
+        bytes32 container_root;
+    };
+
+    // sync_committee_tree instances keyed by their SSZ root. Only the most recent capacity
+    // committees are kept.
+    class sync_committee_tree_cache {
+    public:
+        explicit sync_committee_tree_cache(std::size_t capacity = 2) : cache(capacity) {
+        }
+
+        // the tree with this root if it is cached, nullptr otherwise
+        std::shared_ptr<const sync_committee_tree> find(const bytes32 &root) {
+            return cache.find(root);
+        }
+
+        // The tree with this root, built from pubkeys and aggregate_pubkey on a miss;
+        // a committee that does not hash to root is rejected
+        std::shared_ptr<const sync_committee_tree> get(const bytes32 &root, const std::vector<g1_bytes_type> &pubkeys,
+                                                       const g1_bytes_type &aggregate_pubkey) {
+            return cache.get(root, [&] {
+                auto tree = std::make_shared<const sync_committee_tree>(pubkeys, aggregate_pubkey);
+                if (tree->root() != root) {
+                    throw std::invalid_argument("sync_committee_tree_cache: committee does not match its SSZ root");
+                }
+                return tree;
+            });
+        }
+
+        // Caches a tree built elsewhere under its own root and returns the cached instance
+        std::shared_ptr<const sync_committee_tree> insert(std::shared_ptr<const sync_committee_tree> tree) {
+            if (tree == nullptr) {
+                throw std::invalid_argument("sync_committee_tree_cache: tree must not be null");
+            }
+            bytes32 root = tree->root();
+            return cache.insert(root, std::move(tree));
+        }
+
+    private:
+        lru_cache<bytes32, sync_committee_tree, bytes32_hash> cache;
+    };
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_SYNC_COMMITTEE_TREE_HPP
@@ -0,0 +1,126 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_NATIVE_THREAD_POOL_HPP
+#define ETHEREUM_CONSENSUS_PROOF_NATIVE_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/*
+ * Fixed size worker pool for the native witness generator. The only
+ * primitive is a blocking parallel_for over [0, n) split into contiguous
+ * chunks, which is what the level-by-level reductions (G1AddMany, SSZ
+ * layers) need. The calling thread works on the first chunk itself.
+ */
+
+namespace ethereum::consensus_proof::native {
+
+    class thread_pool {
+    public:
+        explicit thread_pool(std::size_t size = std::max(1u, std::thread::hardware_concurrency())) : stop(false) {
+            for (std::size_t i = 1; i < size; i++) {
+                workers.emplace_back([this] { worker_loop(); });
+            }
+        }
+
+        thread_pool(const thread_pool &) = delete;
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            cv.notify_all();
+            for (std::thread &worker : workers) {
+                worker.join();
+            }
+        }
+
+        // number of threads taking part in parallel_for, the caller included
+        std::size_t size() const {
+            return workers.size() + 1;
+        }
+
+        // Calls f(begin, end) on disjoint chunks covering [0, n), each of at least
+        // grain elements, and returns once all of them are done. The first
+        // exception thrown by a chunk is rethrown here.
+        template<typename Function>
+        void parallel_for(std::size_t n, std::size_t grain, Function &&f) {
+            std::size_t min_chunk = std::max<std::size_t>(grain, 1);
+            std::size_t chunks = std::min(size(), (n + min_chunk - 1) / min_chunk);
+            if (chunks <= 1) {
+                if (n > 0) {
+                    f(std::size_t(0), n);
+                }
+                return;
+            }
+
+            std::size_t chunk_size = (n + chunks - 1) / chunks;
+            std::latch done(std::ptrdiff_t(chunks - 1));
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            auto run = [&](std::size_t begin, std::size_t end) {
+                try {
+                    f(begin, end);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            };
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (std::size_t c = 1; c < chunks; c++) {
+                    std::size_t begin = std::min(n, c * chunk_size);
+                    std::size_t end = std::min(n, begin + chunk_size);
+                    tasks.emplace([&run, &done, begin, end] {
+                        run(begin, end);
+                        done.count_down();
+                    });
+                }
+            }
+            cv.notify_all();
+
+            run(0, std::min(n, chunk_size));
+            done.wait();
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        void worker_loop() {
+            for (;;) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [this] { return stop || !tasks.empty(); });
+                    if (stop && tasks.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop();
+                }
+                task();
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::queue<std::function<void()>> tasks;
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool stop;
+    };
+
+}    // namespace ethereum::consensus_proof::native
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_NATIVE_THREAD_POOL_HPP
@@ -440,9 +440,12 @@ return temp[1];
 // k * n <= 500
 // p is a prime
 // computes a^e mod p
+// Sliding window of 5 bits over e: the odd powers a, a^3, .., a^31 are tabulated, then every
+// window costs its squarings and one multiplication. For e = p - 2 that is 82 multiplications
+// instead of 228 with square-and-multiply.
 std::array<std::size_t, 50> mod_exp(std::size_t n, std::size_t k, std::size_t a, std::size_t p, std::size_t e) {
     std::size_t eBits[500]; // length is k * n
-    std::size_t bitlength;
+    std::size_t bitlength = 0;
     for (int i = 0; i < k; i++) {
         for (std::size_t j = 0; j < n; j++) {
             eBits[j + n * i] = (e[i] >> j) & 1;
@@ -456,27 +459,60 @@ std::array<std::size_t, 50> mod_exp(std::size_t n, std::size_t k, std::size_t a,
         out[i] = 0;
     }
     out[0] = 1;
+    if (bitlength == 0) {
+        return out;
+    }
 
-    // repeated squaring
-    for (std::size_t i = bitlength - 1; i >= 0; i--) {
-        // multiply by a if bit is 0
-        if (eBits[i] == 1) {
-            std::size_t temp[50]; // length 2 * k
-            temp = prod(n, k, out, a);
-            std::size_t temp2[2][50];
-            temp2 = long_div(n, k, temp, p);
-            out = temp2[1];
-        }
-
-        // square, unless we're at the end
-        if (i > 0) {
-            std::size_t temp[50]; // length 2 * k
+    // oddPowers[i] = a^{2i + 1}
+    std::size_t oddPowers[16][50];
+    std::size_t aSq[50];
+    std::size_t temp[50]; // length 2 * k
+    std::size_t temp2[2][50];
+    temp = prod(n, k, a, a);
+    temp2 = long_div(n, k, temp, p);
+    aSq = temp2[1];
+    temp2 = long_div2(n, k, 0, a, p);
+    oddPowers[0] = temp2[1];
+    for (std::size_t i = 1; i < 16; i++) {
+        temp = prod(n, k, oddPowers[i - 1], aSq);
+        temp2 = long_div(n, k, temp, p);
+        oddPowers[i] = temp2[1];
+    }
+
+    // bits [0, i) of e are left
+    std::size_t started = 0;
+    for (std::size_t i = bitlength; i > 0;) {
+        if (eBits[i - 1] == 0) {
             temp = prod(n, k, out, out);
-            std::size_t temp2[2][50];
             temp2 = long_div(n, k, temp, p);
             out = temp2[1];
+            i--;
+        } else {
+            // window [j, i) of at most 5 bits, ending in a set bit
+            std::size_t j = 0;
+            if (i > 5)
+                j = i - 5;
+            while (eBits[j] == 0)
+                j++;
+            std::size_t digit = 0;
+            for (std::size_t b = i; b > j; b--) {
+                digit = 2 * digit + eBits[b - 1];
+                if (started == 1) {
+                    temp = prod(n, k, out, out);
+                    temp2 = long_div(n, k, temp, p);
+                    out = temp2[1];
+                }
+            }
+            if (started == 0) {
+                out = oddPowers[digit / 2];
+                started = 1;
+            } else {
+                temp = prod(n, k, out, oddPowers[digit / 2]);
+                temp2 = long_div(n, k, temp, p);
+                out = temp2[1];
+            }
+            i = j;
         }
-
     }
     return out;
 }
@@ -1,2972 +1,48 @@
-function get_BLS12_381_prime(n, k) {
-    std::size_t p[50];
-    assert((n == 96 && k == 4) || (n == 77 && k == 5) || (n == 55 && k == 7));
-    if (n == 96 && k == 4) {
-        p = [
-            54880396502181392957329877675, 31935979117156477062286671870, 20826981314825584179608359615,
-            8047903782086192180586325942
-        ];
-    }
-    if (n == 77 && k == 5) {
-        p = [
-            151110683138771015150251, 101672770061349971921567, 5845403419599137187901, 110079541992039310225047,
-            7675079137884323292337
-        ];
-    }
-    if (n == 55 && k == 7) {
-        p = [
-            35747322042231467, 36025922209447795, 1084959616957103, 7925923977987733, 16551456537884751,
-            23443114579904617, 1829881462546425
-        ];
-    }
-    return p;
-}
+#include <ethereum/consensus_proof/native/register_tables.hpp>
 
-// half of 8th roots of unity, up to negation
-function get_roots_of_unity(n, k) {
-    assert(n == 55 && k == 7);
-    std::size_t roots[4][2][50];
-    for (std::size_t idx = 0; idx < k; idx++) {
-        roots[0][0][idx] = 0;
-        roots[0][1][idx] = 0;
-        roots[1][0][idx] = 0;
-        roots[1][1][idx] = 0;
-    }
-    roots[0][0][0] = 1;    // roots[0] = 1
-    roots[1][1][0] = 1;    // roots[1] = sqrt(-1)
+// Constant tables in the n x k register layout. Each one is a static constexpr array of
+// ethereum::consensus_proof::native::bls12_381_registers<n, k>, split at compile time from
+// the canonical hex constants, so any layout with n * k >= 381 is supported, including
+// (96, 4) and (77, 5); registers are unsigned __int128 when n > 64.
 
-    if (n == 55 && k == 7) {
-        roots[2][0] = [
-            4649817190157321, 14178090100713872, 25898210532243870, 6361890036890480, 6755281389607612, 401348527762810,
-            470331148861392
-        ];
-        roots[2][1] = [
-            4649817190157321, 14178090100713872, 25898210532243870, 6361890036890480, 6755281389607612, 401348527762810,
-            470331148861392
-        ];
-        roots[3][0] = [
-            4649817190157321, 14178090100713872, 25898210532243870, 6361890036890480, 6755281389607612, 401348527762810,
-            470331148861392
-        ];
-        roots[3][1] = [
-            31097504852074146, 21847832108733923, 11215546103677201, 1564033941097252, 9796175148277139,
-            23041766052141807, 1359550313685033
-        ];
-    }
-    return roots;
+template<std::size_t n, std::size_t k>
+constexpr const auto &get_BLS12_381_prime() {
+    return ethereum::consensus_proof::native::bls12_381_registers<n, k>::prime;
 }
 
-function get_etas(n, k) {
-    assert(n == 55 && k == 7);
-    std::size_t p[50] = get_BLS12_381_prime(n, k);
-    std::size_t etas[4][2][50];
+// half of 8th roots of unity, up to negation
+template<std::size_t n, std::size_t k>
+constexpr const auto &get_roots_of_unity() {
+    return ethereum::consensus_proof::native::bls12_381_registers<n, k>::roots_of_unity;
+}
 
-    if (n == 55 && k == 7) {
-        etas[0][0] = [
-            15111404105178256, 12179658998385743, 23072200951145993, 9032482684664404, 23305776986956055,
-            5290624451499435, 464473045539356
-        ];
-        etas[0][1] = [
-            12283190417025461, 20834464198811383, 18619727854230373, 19507968258096915, 5803508121078619,
-            11236708505185735, 568856440213905
-        ];
-        etas[2][0] = [
-            25832285470060055, 4957529455978525, 11309477484109628, 34786223745332771, 32011200050324214,
-            11140434959259260, 752550210394889
-        ];
-        etas[2][1] = [
-            17831328741298113, 28196239014888719, 105869995940733, 9669258860454335, 12680438922771573,
-            19435555960961745, 748772277207452
-        ];
-        etas[1][0] = long_sub(n, k, p, etas[0][1]);
-        etas[1][1] = etas[0][0];
-        etas[3][0] = long_sub(n, k, p, etas[2][1]);
-        etas[3][1] = etas[2][0];
-    }
-    return etas;
+template<std::size_t n, std::size_t k>
+constexpr const auto &get_etas() {
+    return ethereum::consensus_proof::native::bls12_381_registers<n, k>::etas;
 }
 
 // coefficients for the 3-isogeny map from E2' to E2
 // taken from E.3 of
 // https://cfrg.github.io/draft-irtf-cfrg-hash-to-curve/draft-irtf-cfrg-hash-to-curve.html#appendix-E.3
-function get_iso3_coeffs(n, k) {
-    assert(n == 55 && k == 7);
-    std::size_t coeffs[4][4][2][50];
-    if (n == 55 && k == 7) {
-        coeffs[0][0][0] = [
-            15950248680265686, 32024958503631044, 4244301805875352, 29783714120969249, 35703698803053471,
-            29228779030399226, 406640325010316
-        ];
-        coeffs[0][0][1] = [
-            15950248680265686, 32024958503631044, 4244301805875352, 29783714120969249, 35703698803053471,
-            29228779030399226, 406640325010316
-        ];
-        coeffs[0][1][0] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[0][1][1] = [
-            11821949021832986, 24017281472965197, 12732905417626058, 17293548324979811, 35053502371232479,
-            15628743053269744, 1219920975030950
-        ];
-        coeffs[0][2][0] = [
-            11821949021832990, 24017281472965197, 12732905417626058, 17293548324979811, 35053502371232479,
-            15628743053269744, 1219920975030950
-        ];
-        coeffs[0][2][1] = [
-            23925373020398477, 12008640736482598, 24380851218295013, 26661172671971889, 17526751185616239,
-            7814371526634872, 609960487515475
-        ];
-        coeffs[0][3][0] = [
-            27772197702098641, 20013442957632273, 16977207223501411, 11048465426985092, 34728404155321983,
-            8828725064705003, 1626561300041267
-        ];
-        coeffs[0][3][1] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[1][0][0] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[1][0][1] = [
-            35747322042231395, 36025922209447795, 1084959616957103, 7925923977987733, 16551456537884751,
-            23443114579904617, 1829881462546425
-        ];
-        coeffs[1][1][0] = [ 12, 0, 0, 0, 0, 0, 0 ];
-        coeffs[1][1][1] = [
-            35747322042231455, 36025922209447795, 1084959616957103, 7925923977987733, 16551456537884751,
-            23443114579904617, 1829881462546425
-        ];
-        coeffs[1][2][0] = [ 1, 0, 0, 0, 0, 0, 0 ];
-        coeffs[1][2][1] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[1][3][0] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[1][3][1] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[2][0][0] = [
-            22455448142010118, 21348055796076581, 27572038961197616, 1120560719995342, 22827171220970826,
-            11095397727559917, 1491014525037828
-        ];
-        coeffs[2][0][1] = [
-            22455448142010118, 21348055796076581, 27572038961197616, 1120560719995342, 22827171220970826,
-            11095397727559917, 1491014525037828
-        ];
-        coeffs[2][1][0] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[2][1][1] = [
-            15950248680265662, 32024958503631044, 4244301805875352, 29783714120969249, 35703698803053471,
-            29228779030399226, 406640325010316
-        ];
-        coeffs[2][2][0] = [
-            11821949021832988, 24017281472965197, 12732905417626058, 17293548324979811, 35053502371232479,
-            15628743053269744, 1219920975030950
-        ];
-        coeffs[2][2][1] = [
-            23925373020398479, 12008640736482598, 24380851218295013, 26661172671971889, 17526751185616239,
-            7814371526634872, 609960487515475
-        ];
-        coeffs[2][3][0] = [
-            14480323801877264, 5335576544261059, 7435489548777956, 4243102168992702, 4975321819444090,
-            32509805231324272, 1287694362532669
-        ];
-        coeffs[2][3][1] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[3][0][0] = [
-            35747322042231035, 36025922209447795, 1084959616957103, 7925923977987733, 16551456537884751,
-            23443114579904617, 1829881462546425
-        ];
-        coeffs[3][0][1] = [
-            35747322042231035, 36025922209447795, 1084959616957103, 7925923977987733, 16551456537884751,
-            23443114579904617, 1829881462546425
-        ];
-        coeffs[3][1][0] = [ 0, 0, 0, 0, 0, 0, 0 ];
-        coeffs[3][1][1] = [
-            35747322042231251, 36025922209447795, 1084959616957103, 7925923977987733, 16551456537884751,
-            23443114579904617, 1829881462546425
-        ];
-        coeffs[3][2][0] = [ 18, 0, 0, 0, 0, 0, 0 ];
-        coeffs[3][2][1] = [
-            35747322042231449, 36025922209447795, 1084959616957103, 7925923977987733, 16551456537884751,
-            23443114579904617, 1829881462546425
-        ];
-        coeffs[3][3][0] = [ 1, 0, 0, 0, 0, 0, 0 ];
-        coeffs[3][3][1] = [ 0, 0, 0, 0, 0, 0, 0 ];
-    }
-    return coeffs;
+template<std::size_t n, std::size_t k>
+constexpr const auto &get_iso3_coeffs() {
+    return ethereum::consensus_proof::native::bls12_381_registers<n, k>::iso3_coeffs;
 }
 
-function get_generator_G1(n, k) {
-    assert(n == 55 && k == 7);
-    std::size_t g1[2][50];
-
-    g1[0] = [
-        16589478066046651, 22658679592837110, 35004527604248919, 16789302793630161, 7530538873701625, 32234187716135413,
-        1684953952445941
-    ];
-    g1[1] = [
-        11860609209853921, 4091579406338073, 12578493816062195, 13088963032438982, 24961455755233629, 8501508834176643,
-        612415636564648
-    ];
-
-    return g1;
+template<std::size_t n, std::size_t k>
+constexpr const auto &get_generator_G1() {
+    return ethereum::consensus_proof::native::bls12_381_registers<n, k>::generator_g1;
 }
 
-function get_generator_G2(n, k) {
-    assert(n == 55 && k == 7);
-    std::size_t g2[2][2][50];
-
-    g2[0][0] = [
-        95420233661880, 1773856045391785, 5044075188989616, 23082975677810779, 22805092780977487, 23121359448368568,
-        161253150172098
-    ];
-    g2[0][1] = [
-        12522360964131710, 27624298323292107, 31369054948478259, 20553930357265165, 32921944760061193,
-        30416570139545860, 1398625365433447
-    ];
-    g2[1][0] = [
-        5440959206139905, 5515662923731907, 10491004233861355, 28691331721860307, 27955817036233384, 18631882631076677,
-        907600843284315
-    ];
-    g2[1][1] = [
-        11548582681213374, 7404909498155861, 12768329608264924, 12731371725497493, 11463081752430568, 7184576637437304,
-        424072857758157
-    ];
-
-    return g2;
+template<std::size_t n, std::size_t k>
+constexpr const auto &get_generator_G2() {
+    return ethereum::consensus_proof::native::bls12_381_registers<n, k>::generator_g2;
 }
 
-function get_Fp12_frobenius(n, k) {
-    assert((n == 96 && k == 4) || (n == 77 && k == 5) || (n == 55 && k == 7));
-    std::size_t coeff[12][6][2][20];    //
-    // coeff[j][i] represents an element in F_q^2
-    // F_q^12 = F_q^2[w] / (w^6 - (u+1))
-    // Apply Frobenius j times to w^i: (w^i)^(q^j) = coeff[j][i] * w^i
-    if (n == 96 && k == 4) {
-        coeff[0][0][0][0] = 1;
-        coeff[0][0][0][1] = 0;
-        coeff[0][0][0][2] = 0;
-        coeff[0][0][0][3] = 0;
-
-        coeff[0][0][1][0] = 0;
-        coeff[0][0][1][1] = 0;
-        coeff[0][0][1][2] = 0;
-        coeff[0][0][1][3] = 0;
-
-        coeff[0][1][0][0] = 1;
-        coeff[0][1][0][1] = 0;
-        coeff[0][1][0][2] = 0;
-        coeff[0][1][0][3] = 0;
-
-        coeff[0][1][1][0] = 0;
-        coeff[0][1][1][1] = 0;
-        coeff[0][1][1][2] = 0;
-        coeff[0][1][1][3] = 0;
-
-        coeff[0][2][0][0] = 1;
-        coeff[0][2][0][1] = 0;
-        coeff[0][2][0][2] = 0;
-        coeff[0][2][0][3] = 0;
-
-        coeff[0][2][1][0] = 0;
-        coeff[0][2][1][1] = 0;
-        coeff[0][2][1][2] = 0;
-        coeff[0][2][1][3] = 0;
-
-        coeff[0][3][0][0] = 1;
-        coeff[0][3][0][1] = 0;
-        coeff[0][3][0][2] = 0;
-        coeff[0][3][0][3] = 0;
-
-        coeff[0][3][1][0] = 0;
-        coeff[0][3][1][1] = 0;
-        coeff[0][3][1][2] = 0;
-        coeff[0][3][1][3] = 0;
-
-        coeff[0][4][0][0] = 1;
-        coeff[0][4][0][1] = 0;
-        coeff[0][4][0][2] = 0;
-        coeff[0][4][0][3] = 0;
-
-        coeff[0][4][1][0] = 0;
-        coeff[0][4][1][1] = 0;
-        coeff[0][4][1][2] = 0;
-        coeff[0][4][1][3] = 0;
-
-        coeff[0][5][0][0] = 1;
-        coeff[0][5][0][1] = 0;
-        coeff[0][5][0][2] = 0;
-        coeff[0][5][0][3] = 0;
-
-        coeff[0][5][1][0] = 0;
-        coeff[0][5][1][1] = 0;
-        coeff[0][5][1][2] = 0;
-        coeff[0][5][1][3] = 0;
-
-        coeff[1][0][0][0] = 1;
-        coeff[1][0][0][1] = 0;
-        coeff[1][0][0][2] = 0;
-        coeff[1][0][0][3] = 0;
-
-        coeff[1][0][1][0] = 0;
-        coeff[1][0][1][1] = 0;
-        coeff[1][0][1][2] = 0;
-        coeff[1][0][1][3] = 0;
-
-        coeff[1][1][0][0] = 30918888157334040571029970872;
-        coeff[1][1][0][1] = 38110497911700059231495300413;
-        coeff[1][1][0][2] = 9956775014100533415029595983;
-        coeff[1][1][0][3] = 7742960891664846859912986292;
-
-        coeff[1][1][1][0] = 23961508344847352386299906803;
-        coeff[1][1][1][1] = 73053643719720755424335321793;
-        coeff[1][1][1][2] = 10870206300725050764578763631;
-        coeff[1][1][1][3] = 304942890421345320673339650;
-
-        coeff[1][2][0][0] = 0;
-        coeff[1][2][0][1] = 0;
-        coeff[1][2][0][2] = 0;
-        coeff[1][2][0][3] = 0;
-
-        coeff[1][2][1][0] = 24538776241284729507437128364;
-        coeff[1][2][1][1] = 42550757554255812588943452139;
-        coeff[1][2][1][2] = 30896359077101218988767419092;
-        coeff[1][2][1][3] = 8047903782086192178990825606;
-
-        coeff[1][3][0][0] = 35566625740316527277988105225;
-        coeff[1][3][0][1] = 37127840730814273605658450223;
-        coeff[1][3][0][2] = 33368165978403992854926148446;
-        coeff[1][3][0][3] = 2068538268313381196677636973;
-
-        coeff[1][3][1][0] = 35566625740316527277988105225;
-        coeff[1][3][1][1] = 37127840730814273605658450223;
-        coeff[1][3][1][2] = 33368165978403992854926148446;
-        coeff[1][3][1][3] = 2068538268313381196677636973;
-
-        coeff[1][4][0][0] = 24538776241284729507437128365;
-        coeff[1][4][0][1] = 42550757554255812588943452139;
-        coeff[1][4][0][2] = 30896359077101218988767419092;
-        coeff[1][4][0][3] = 8047903782086192178990825606;
-
-        coeff[1][4][1][0] = 0;
-        coeff[1][4][1][1] = 0;
-        coeff[1][4][1][2] = 0;
-        coeff[1][4][1][3] = 0;
-
-        coeff[1][5][0][0] = 11605117395469174891688198422;
-        coeff[1][5][0][1] = 43302359525357855774867078766;
-        coeff[1][5][0][2] = 22497959677678942090347384814;
-        coeff[1][5][0][3] = 1763595377892035876004297323;
-
-        coeff[1][5][1][0] = 43275279106712218065641679253;
-        coeff[1][5][1][1] = 67861782106062958880963543440;
-        coeff[1][5][1][2] = 77557184151410979682804925136;
-        coeff[1][5][1][3] = 6284308404194156304582028618;
-
-        coeff[2][0][0][0] = 1;
-        coeff[2][0][0][1] = 0;
-        coeff[2][0][0][2] = 0;
-        coeff[2][0][0][3] = 0;
-
-        coeff[2][0][1][0] = 0;
-        coeff[2][0][1][1] = 0;
-        coeff[2][0][1][2] = 0;
-        coeff[2][0][1][3] = 0;
-
-        coeff[2][1][0][0] = 30341620260896663449892749311;
-        coeff[2][1][0][1] = 68613384077165002066887170067;
-        coeff[2][1][0][2] = 69158784751988702784384890858;
-        coeff[2][1][0][3] = 1595500335;
-
-        coeff[2][1][1][0] = 0;
-        coeff[2][1][1][1] = 0;
-        coeff[2][1][1][2] = 0;
-        coeff[2][1][1][3] = 0;
-
-        coeff[2][2][0][0] = 30341620260896663449892749310;
-        coeff[2][2][0][1] = 68613384077165002066887170067;
-        coeff[2][2][0][2] = 69158784751988702784384890858;
-        coeff[2][2][0][3] = 1595500335;
-
-        coeff[2][2][1][0] = 0;
-        coeff[2][2][1][1] = 0;
-        coeff[2][2][1][2] = 0;
-        coeff[2][2][1][3] = 0;
-
-        coeff[2][3][0][0] = 54880396502181392957329877674;
-        coeff[2][3][0][1] = 31935979117156477062286671870;
-        coeff[2][3][0][2] = 20826981314825584179608359615;
-        coeff[2][3][0][3] = 8047903782086192180586325942;
-
-        coeff[2][3][1][0] = 0;
-        coeff[2][3][1][1] = 0;
-        coeff[2][3][1][2] = 0;
-        coeff[2][3][1][3] = 0;
-
-        coeff[2][4][0][0] = 24538776241284729507437128364;
-        coeff[2][4][0][1] = 42550757554255812588943452139;
-        coeff[2][4][0][2] = 30896359077101218988767419092;
-        coeff[2][4][0][3] = 8047903782086192178990825606;
-
-        coeff[2][4][1][0] = 0;
-        coeff[2][4][1][1] = 0;
-        coeff[2][4][1][2] = 0;
-        coeff[2][4][1][3] = 0;
-
-        coeff[2][5][0][0] = 24538776241284729507437128365;
-        coeff[2][5][0][1] = 42550757554255812588943452139;
-        coeff[2][5][0][2] = 30896359077101218988767419092;
-        coeff[2][5][0][3] = 8047903782086192178990825606;
-
-        coeff[2][5][1][0] = 0;
-        coeff[2][5][1][1] = 0;
-        coeff[2][5][1][2] = 0;
-        coeff[2][5][1][3] = 0;
-
-        coeff[3][0][0][0] = 1;
-        coeff[3][0][0][1] = 0;
-        coeff[3][0][0][2] = 0;
-        coeff[3][0][0][3] = 0;
-
-        coeff[3][0][1][0] = 0;
-        coeff[3][0][1][1] = 0;
-        coeff[3][0][1][2] = 0;
-        coeff[3][0][1][3] = 0;
-
-        coeff[3][1][0][0] = 19313770761864865679341772450;
-        coeff[3][1][0][1] = 74036300900606541050172171983;
-        coeff[3][1][0][2] = 66686977850685928918226161504;
-        coeff[3][1][0][3] = 5979365513772810983908688968;
-
-        coeff[3][1][1][0] = 35566625740316527277988105225;
-        coeff[3][1][1][1] = 37127840730814273605658450223;
-        coeff[3][1][1][2] = 33368165978403992854926148446;
-        coeff[3][1][1][3] = 2068538268313381196677636973;
-
-        coeff[3][2][0][0] = 0;
-        coeff[3][2][0][1] = 0;
-        coeff[3][2][0][2] = 0;
-        coeff[3][2][0][3] = 0;
-
-        coeff[3][2][1][0] = 1;
-        coeff[3][2][1][1] = 0;
-        coeff[3][2][1][2] = 0;
-        coeff[3][2][1][3] = 0;
-
-        coeff[3][3][0][0] = 19313770761864865679341772450;
-        coeff[3][3][0][1] = 74036300900606541050172171983;
-        coeff[3][3][0][2] = 66686977850685928918226161504;
-        coeff[3][3][0][3] = 5979365513772810983908688968;
-
-        coeff[3][3][1][0] = 19313770761864865679341772450;
-        coeff[3][3][1][1] = 74036300900606541050172171983;
-        coeff[3][3][1][2] = 66686977850685928918226161504;
-        coeff[3][3][1][3] = 5979365513772810983908688968;
-
-        coeff[3][4][0][0] = 54880396502181392957329877674;
-        coeff[3][4][0][1] = 31935979117156477062286671870;
-        coeff[3][4][0][2] = 20826981314825584179608359615;
-        coeff[3][4][0][3] = 8047903782086192180586325942;
-
-        coeff[3][4][1][0] = 0;
-        coeff[3][4][1][1] = 0;
-        coeff[3][4][1][2] = 0;
-        coeff[3][4][1][3] = 0;
-
-        coeff[3][5][0][0] = 35566625740316527277988105225;
-        coeff[3][5][0][1] = 37127840730814273605658450223;
-        coeff[3][5][0][2] = 33368165978403992854926148446;
-        coeff[3][5][0][3] = 2068538268313381196677636973;
-
-        coeff[3][5][1][0] = 19313770761864865679341772450;
-        coeff[3][5][1][1] = 74036300900606541050172171983;
-        coeff[3][5][1][2] = 66686977850685928918226161504;
-        coeff[3][5][1][3] = 5979365513772810983908688968;
-
-        coeff[4][0][0][0] = 1;
-        coeff[4][0][0][1] = 0;
-        coeff[4][0][0][2] = 0;
-        coeff[4][0][0][3] = 0;
-
-        coeff[4][0][1][0] = 0;
-        coeff[4][0][1][1] = 0;
-        coeff[4][0][1][2] = 0;
-        coeff[4][0][1][3] = 0;
-
-        coeff[4][1][0][0] = 30341620260896663449892749310;
-        coeff[4][1][0][1] = 68613384077165002066887170067;
-        coeff[4][1][0][2] = 69158784751988702784384890858;
-        coeff[4][1][0][3] = 1595500335;
-
-        coeff[4][1][1][0] = 0;
-        coeff[4][1][1][1] = 0;
-        coeff[4][1][1][2] = 0;
-        coeff[4][1][1][3] = 0;
-
-        coeff[4][2][0][0] = 24538776241284729507437128364;
-        coeff[4][2][0][1] = 42550757554255812588943452139;
-        coeff[4][2][0][2] = 30896359077101218988767419092;
-        coeff[4][2][0][3] = 8047903782086192178990825606;
-
-        coeff[4][2][1][0] = 0;
-        coeff[4][2][1][1] = 0;
-        coeff[4][2][1][2] = 0;
-        coeff[4][2][1][3] = 0;
-
-        coeff[4][3][0][0] = 1;
-        coeff[4][3][0][1] = 0;
-        coeff[4][3][0][2] = 0;
-        coeff[4][3][0][3] = 0;
-
-        coeff[4][3][1][0] = 0;
-        coeff[4][3][1][1] = 0;
-        coeff[4][3][1][2] = 0;
-        coeff[4][3][1][3] = 0;
-
-        coeff[4][4][0][0] = 30341620260896663449892749310;
-        coeff[4][4][0][1] = 68613384077165002066887170067;
-        coeff[4][4][0][2] = 69158784751988702784384890858;
-        coeff[4][4][0][3] = 1595500335;
-
-        coeff[4][4][1][0] = 0;
-        coeff[4][4][1][1] = 0;
-        coeff[4][4][1][2] = 0;
-        coeff[4][4][1][3] = 0;
-
-        coeff[4][5][0][0] = 24538776241284729507437128364;
-        coeff[4][5][0][1] = 42550757554255812588943452139;
-        coeff[4][5][0][2] = 30896359077101218988767419092;
-        coeff[4][5][0][3] = 8047903782086192178990825606;
-
-        coeff[4][5][1][0] = 0;
-        coeff[4][5][1][1] = 0;
-        coeff[4][5][1][2] = 0;
-        coeff[4][5][1][3] = 0;
-
-        coeff[5][0][0][0] = 1;
-        coeff[5][0][0][1] = 0;
-        coeff[5][0][0][2] = 0;
-        coeff[5][0][0][3] = 0;
-
-        coeff[5][0][1][0] = 0;
-        coeff[5][0][1][1] = 0;
-        coeff[5][0][1][2] = 0;
-        coeff[5][0][1][3] = 0;
-
-        coeff[5][1][0][0] = 43275279106712218065641679253;
-        coeff[5][1][0][1] = 67861782106062958880963543440;
-        coeff[5][1][0][2] = 77557184151410979682804925136;
-        coeff[5][1][0][3] = 6284308404194156304582028618;
-
-        coeff[5][1][1][0] = 11605117395469174891688198422;
-        coeff[5][1][1][1] = 43302359525357855774867078766;
-        coeff[5][1][1][2] = 22497959677678942090347384814;
-        coeff[5][1][1][3] = 1763595377892035876004297323;
-
-        coeff[5][2][0][0] = 0;
-        coeff[5][2][0][1] = 0;
-        coeff[5][2][0][2] = 0;
-        coeff[5][2][0][3] = 0;
-
-        coeff[5][2][1][0] = 30341620260896663449892749310;
-        coeff[5][2][1][1] = 68613384077165002066887170067;
-        coeff[5][2][1][2] = 69158784751988702784384890858;
-        coeff[5][2][1][3] = 1595500335;
-
-        coeff[5][3][0][0] = 35566625740316527277988105225;
-        coeff[5][3][0][1] = 37127840730814273605658450223;
-        coeff[5][3][0][2] = 33368165978403992854926148446;
-        coeff[5][3][0][3] = 2068538268313381196677636973;
-
-        coeff[5][3][1][0] = 35566625740316527277988105225;
-        coeff[5][3][1][1] = 37127840730814273605658450223;
-        coeff[5][3][1][2] = 33368165978403992854926148446;
-        coeff[5][3][1][3] = 2068538268313381196677636973;
-
-        coeff[5][4][0][0] = 30341620260896663449892749311;
-        coeff[5][4][0][1] = 68613384077165002066887170067;
-        coeff[5][4][0][2] = 69158784751988702784384890858;
-        coeff[5][4][0][3] = 1595500335;
-
-        coeff[5][4][1][0] = 0;
-        coeff[5][4][1][1] = 0;
-        coeff[5][4][1][2] = 0;
-        coeff[5][4][1][3] = 0;
-
-        coeff[5][5][0][0] = 23961508344847352386299906803;
-        coeff[5][5][0][1] = 73053643719720755424335321793;
-        coeff[5][5][0][2] = 10870206300725050764578763631;
-        coeff[5][5][0][3] = 304942890421345320673339650;
-
-        coeff[5][5][1][0] = 30918888157334040571029970872;
-        coeff[5][5][1][1] = 38110497911700059231495300413;
-        coeff[5][5][1][2] = 9956775014100533415029595983;
-        coeff[5][5][1][3] = 7742960891664846859912986292;
-
-        coeff[6][0][0][0] = 1;
-        coeff[6][0][0][1] = 0;
-        coeff[6][0][0][2] = 0;
-        coeff[6][0][0][3] = 0;
-
-        coeff[6][0][1][0] = 0;
-        coeff[6][0][1][1] = 0;
-        coeff[6][0][1][2] = 0;
-        coeff[6][0][1][3] = 0;
-
-        coeff[6][1][0][0] = 54880396502181392957329877674;
-        coeff[6][1][0][1] = 31935979117156477062286671870;
-        coeff[6][1][0][2] = 20826981314825584179608359615;
-        coeff[6][1][0][3] = 8047903782086192180586325942;
-
-        coeff[6][1][1][0] = 0;
-        coeff[6][1][1][1] = 0;
-        coeff[6][1][1][2] = 0;
-        coeff[6][1][1][3] = 0;
-
-        coeff[6][2][0][0] = 1;
-        coeff[6][2][0][1] = 0;
-        coeff[6][2][0][2] = 0;
-        coeff[6][2][0][3] = 0;
-
-        coeff[6][2][1][0] = 0;
-        coeff[6][2][1][1] = 0;
-        coeff[6][2][1][2] = 0;
-        coeff[6][2][1][3] = 0;
-
-        coeff[6][3][0][0] = 54880396502181392957329877674;
-        coeff[6][3][0][1] = 31935979117156477062286671870;
-        coeff[6][3][0][2] = 20826981314825584179608359615;
-        coeff[6][3][0][3] = 8047903782086192180586325942;
-
-        coeff[6][3][1][0] = 0;
-        coeff[6][3][1][1] = 0;
-        coeff[6][3][1][2] = 0;
-        coeff[6][3][1][3] = 0;
-
-        coeff[6][4][0][0] = 1;
-        coeff[6][4][0][1] = 0;
-        coeff[6][4][0][2] = 0;
-        coeff[6][4][0][3] = 0;
-
-        coeff[6][4][1][0] = 0;
-        coeff[6][4][1][1] = 0;
-        coeff[6][4][1][2] = 0;
-        coeff[6][4][1][3] = 0;
-
-        coeff[6][5][0][0] = 54880396502181392957329877674;
-        coeff[6][5][0][1] = 31935979117156477062286671870;
-        coeff[6][5][0][2] = 20826981314825584179608359615;
-        coeff[6][5][0][3] = 8047903782086192180586325942;
-
-        coeff[6][5][1][0] = 0;
-        coeff[6][5][1][1] = 0;
-        coeff[6][5][1][2] = 0;
-        coeff[6][5][1][3] = 0;
-
-        coeff[7][0][0][0] = 1;
-        coeff[7][0][0][1] = 0;
-        coeff[7][0][0][2] = 0;
-        coeff[7][0][0][3] = 0;
-
-        coeff[7][0][1][0] = 0;
-        coeff[7][0][1][1] = 0;
-        coeff[7][0][1][2] = 0;
-        coeff[7][0][1][3] = 0;
-
-        coeff[7][1][0][0] = 23961508344847352386299906803;
-        coeff[7][1][0][1] = 73053643719720755424335321793;
-        coeff[7][1][0][2] = 10870206300725050764578763631;
-        coeff[7][1][0][3] = 304942890421345320673339650;
-
-        coeff[7][1][1][0] = 30918888157334040571029970872;
-        coeff[7][1][1][1] = 38110497911700059231495300413;
-        coeff[7][1][1][2] = 9956775014100533415029595983;
-        coeff[7][1][1][3] = 7742960891664846859912986292;
-
-        coeff[7][2][0][0] = 0;
-        coeff[7][2][0][1] = 0;
-        coeff[7][2][0][2] = 0;
-        coeff[7][2][0][3] = 0;
-
-        coeff[7][2][1][0] = 24538776241284729507437128364;
-        coeff[7][2][1][1] = 42550757554255812588943452139;
-        coeff[7][2][1][2] = 30896359077101218988767419092;
-        coeff[7][2][1][3] = 8047903782086192178990825606;
-
-        coeff[7][3][0][0] = 19313770761864865679341772450;
-        coeff[7][3][0][1] = 74036300900606541050172171983;
-        coeff[7][3][0][2] = 66686977850685928918226161504;
-        coeff[7][3][0][3] = 5979365513772810983908688968;
-
-        coeff[7][3][1][0] = 19313770761864865679341772450;
-        coeff[7][3][1][1] = 74036300900606541050172171983;
-        coeff[7][3][1][2] = 66686977850685928918226161504;
-        coeff[7][3][1][3] = 5979365513772810983908688968;
-
-        coeff[7][4][0][0] = 24538776241284729507437128365;
-        coeff[7][4][0][1] = 42550757554255812588943452139;
-        coeff[7][4][0][2] = 30896359077101218988767419092;
-        coeff[7][4][0][3] = 8047903782086192178990825606;
-
-        coeff[7][4][1][0] = 0;
-        coeff[7][4][1][1] = 0;
-        coeff[7][4][1][2] = 0;
-        coeff[7][4][1][3] = 0;
-
-        coeff[7][5][0][0] = 43275279106712218065641679253;
-        coeff[7][5][0][1] = 67861782106062958880963543440;
-        coeff[7][5][0][2] = 77557184151410979682804925136;
-        coeff[7][5][0][3] = 6284308404194156304582028618;
-
-        coeff[7][5][1][0] = 11605117395469174891688198422;
-        coeff[7][5][1][1] = 43302359525357855774867078766;
-        coeff[7][5][1][2] = 22497959677678942090347384814;
-        coeff[7][5][1][3] = 1763595377892035876004297323;
-
-        coeff[8][0][0][0] = 1;
-        coeff[8][0][0][1] = 0;
-        coeff[8][0][0][2] = 0;
-        coeff[8][0][0][3] = 0;
-
-        coeff[8][0][1][0] = 0;
-        coeff[8][0][1][1] = 0;
-        coeff[8][0][1][2] = 0;
-        coeff[8][0][1][3] = 0;
-
-        coeff[8][1][0][0] = 24538776241284729507437128364;
-        coeff[8][1][0][1] = 42550757554255812588943452139;
-        coeff[8][1][0][2] = 30896359077101218988767419092;
-        coeff[8][1][0][3] = 8047903782086192178990825606;
-
-        coeff[8][1][1][0] = 0;
-        coeff[8][1][1][1] = 0;
-        coeff[8][1][1][2] = 0;
-        coeff[8][1][1][3] = 0;
-
-        coeff[8][2][0][0] = 30341620260896663449892749310;
-        coeff[8][2][0][1] = 68613384077165002066887170067;
-        coeff[8][2][0][2] = 69158784751988702784384890858;
-        coeff[8][2][0][3] = 1595500335;
-
-        coeff[8][2][1][0] = 0;
-        coeff[8][2][1][1] = 0;
-        coeff[8][2][1][2] = 0;
-        coeff[8][2][1][3] = 0;
-
-        coeff[8][3][0][0] = 1;
-        coeff[8][3][0][1] = 0;
-        coeff[8][3][0][2] = 0;
-        coeff[8][3][0][3] = 0;
-
-        coeff[8][3][1][0] = 0;
-        coeff[8][3][1][1] = 0;
-        coeff[8][3][1][2] = 0;
-        coeff[8][3][1][3] = 0;
-
-        coeff[8][4][0][0] = 24538776241284729507437128364;
-        coeff[8][4][0][1] = 42550757554255812588943452139;
-        coeff[8][4][0][2] = 30896359077101218988767419092;
-        coeff[8][4][0][3] = 8047903782086192178990825606;
-
-        coeff[8][4][1][0] = 0;
-        coeff[8][4][1][1] = 0;
-        coeff[8][4][1][2] = 0;
-        coeff[8][4][1][3] = 0;
-
-        coeff[8][5][0][0] = 30341620260896663449892749310;
-        coeff[8][5][0][1] = 68613384077165002066887170067;
-        coeff[8][5][0][2] = 69158784751988702784384890858;
-        coeff[8][5][0][3] = 1595500335;
-
-        coeff[8][5][1][0] = 0;
-        coeff[8][5][1][1] = 0;
-        coeff[8][5][1][2] = 0;
-        coeff[8][5][1][3] = 0;
-
-        coeff[9][0][0][0] = 1;
-        coeff[9][0][0][1] = 0;
-        coeff[9][0][0][2] = 0;
-        coeff[9][0][0][3] = 0;
-
-        coeff[9][0][1][0] = 0;
-        coeff[9][0][1][1] = 0;
-        coeff[9][0][1][2] = 0;
-        coeff[9][0][1][3] = 0;
-
-        coeff[9][1][0][0] = 35566625740316527277988105225;
-        coeff[9][1][0][1] = 37127840730814273605658450223;
-        coeff[9][1][0][2] = 33368165978403992854926148446;
-        coeff[9][1][0][3] = 2068538268313381196677636973;
-
-        coeff[9][1][1][0] = 19313770761864865679341772450;
-        coeff[9][1][1][1] = 74036300900606541050172171983;
-        coeff[9][1][1][2] = 66686977850685928918226161504;
-        coeff[9][1][1][3] = 5979365513772810983908688968;
-
-        coeff[9][2][0][0] = 0;
-        coeff[9][2][0][1] = 0;
-        coeff[9][2][0][2] = 0;
-        coeff[9][2][0][3] = 0;
-
-        coeff[9][2][1][0] = 1;
-        coeff[9][2][1][1] = 0;
-        coeff[9][2][1][2] = 0;
-        coeff[9][2][1][3] = 0;
-
-        coeff[9][3][0][0] = 35566625740316527277988105225;
-        coeff[9][3][0][1] = 37127840730814273605658450223;
-        coeff[9][3][0][2] = 33368165978403992854926148446;
-        coeff[9][3][0][3] = 2068538268313381196677636973;
-
-        coeff[9][3][1][0] = 35566625740316527277988105225;
-        coeff[9][3][1][1] = 37127840730814273605658450223;
-        coeff[9][3][1][2] = 33368165978403992854926148446;
-        coeff[9][3][1][3] = 2068538268313381196677636973;
-
-        coeff[9][4][0][0] = 54880396502181392957329877674;
-        coeff[9][4][0][1] = 31935979117156477062286671870;
-        coeff[9][4][0][2] = 20826981314825584179608359615;
-        coeff[9][4][0][3] = 8047903782086192180586325942;
-
-        coeff[9][4][1][0] = 0;
-        coeff[9][4][1][1] = 0;
-        coeff[9][4][1][2] = 0;
-        coeff[9][4][1][3] = 0;
-
-        coeff[9][5][0][0] = 19313770761864865679341772450;
-        coeff[9][5][0][1] = 74036300900606541050172171983;
-        coeff[9][5][0][2] = 66686977850685928918226161504;
-        coeff[9][5][0][3] = 5979365513772810983908688968;
-
-        coeff[9][5][1][0] = 35566625740316527277988105225;
-        coeff[9][5][1][1] = 37127840730814273605658450223;
-        coeff[9][5][1][2] = 33368165978403992854926148446;
-        coeff[9][5][1][3] = 2068538268313381196677636973;
-
-        coeff[10][0][0][0] = 1;
-        coeff[10][0][0][1] = 0;
-        coeff[10][0][0][2] = 0;
-        coeff[10][0][0][3] = 0;
-
-        coeff[10][0][1][0] = 0;
-        coeff[10][0][1][1] = 0;
-        coeff[10][0][1][2] = 0;
-        coeff[10][0][1][3] = 0;
-
-        coeff[10][1][0][0] = 24538776241284729507437128365;
-        coeff[10][1][0][1] = 42550757554255812588943452139;
-        coeff[10][1][0][2] = 30896359077101218988767419092;
-        coeff[10][1][0][3] = 8047903782086192178990825606;
-
-        coeff[10][1][1][0] = 0;
-        coeff[10][1][1][1] = 0;
-        coeff[10][1][1][2] = 0;
-        coeff[10][1][1][3] = 0;
-
-        coeff[10][2][0][0] = 24538776241284729507437128364;
-        coeff[10][2][0][1] = 42550757554255812588943452139;
-        coeff[10][2][0][2] = 30896359077101218988767419092;
-        coeff[10][2][0][3] = 8047903782086192178990825606;
-
-        coeff[10][2][1][0] = 0;
-        coeff[10][2][1][1] = 0;
-        coeff[10][2][1][2] = 0;
-        coeff[10][2][1][3] = 0;
-
-        coeff[10][3][0][0] = 54880396502181392957329877674;
-        coeff[10][3][0][1] = 31935979117156477062286671870;
-        coeff[10][3][0][2] = 20826981314825584179608359615;
-        coeff[10][3][0][3] = 8047903782086192180586325942;
-
-        coeff[10][3][1][0] = 0;
-        coeff[10][3][1][1] = 0;
-        coeff[10][3][1][2] = 0;
-        coeff[10][3][1][3] = 0;
-
-        coeff[10][4][0][0] = 30341620260896663449892749310;
-        coeff[10][4][0][1] = 68613384077165002066887170067;
-        coeff[10][4][0][2] = 69158784751988702784384890858;
-        coeff[10][4][0][3] = 1595500335;
-
-        coeff[10][4][1][0] = 0;
-        coeff[10][4][1][1] = 0;
-        coeff[10][4][1][2] = 0;
-        coeff[10][4][1][3] = 0;
-
-        coeff[10][5][0][0] = 30341620260896663449892749311;
-        coeff[10][5][0][1] = 68613384077165002066887170067;
-        coeff[10][5][0][2] = 69158784751988702784384890858;
-        coeff[10][5][0][3] = 1595500335;
-
-        coeff[10][5][1][0] = 0;
-        coeff[10][5][1][1] = 0;
-        coeff[10][5][1][2] = 0;
-        coeff[10][5][1][3] = 0;
-
-        coeff[11][0][0][0] = 1;
-        coeff[11][0][0][1] = 0;
-        coeff[11][0][0][2] = 0;
-        coeff[11][0][0][3] = 0;
-
-        coeff[11][0][1][0] = 0;
-        coeff[11][0][1][1] = 0;
-        coeff[11][0][1][2] = 0;
-        coeff[11][0][1][3] = 0;
-
-        coeff[11][1][0][0] = 11605117395469174891688198422;
-        coeff[11][1][0][1] = 43302359525357855774867078766;
-        coeff[11][1][0][2] = 22497959677678942090347384814;
-        coeff[11][1][0][3] = 1763595377892035876004297323;
-
-        coeff[11][1][1][0] = 43275279106712218065641679253;
-        coeff[11][1][1][1] = 67861782106062958880963543440;
-        coeff[11][1][1][2] = 77557184151410979682804925136;
-        coeff[11][1][1][3] = 6284308404194156304582028618;
-
-        coeff[11][2][0][0] = 0;
-        coeff[11][2][0][1] = 0;
-        coeff[11][2][0][2] = 0;
-        coeff[11][2][0][3] = 0;
-
-        coeff[11][2][1][0] = 30341620260896663449892749310;
-        coeff[11][2][1][1] = 68613384077165002066887170067;
-        coeff[11][2][1][2] = 69158784751988702784384890858;
-        coeff[11][2][1][3] = 1595500335;
-
-        coeff[11][3][0][0] = 19313770761864865679341772450;
-        coeff[11][3][0][1] = 74036300900606541050172171983;
-        coeff[11][3][0][2] = 66686977850685928918226161504;
-        coeff[11][3][0][3] = 5979365513772810983908688968;
-
-        coeff[11][3][1][0] = 19313770761864865679341772450;
-        coeff[11][3][1][1] = 74036300900606541050172171983;
-        coeff[11][3][1][2] = 66686977850685928918226161504;
-        coeff[11][3][1][3] = 5979365513772810983908688968;
-
-        coeff[11][4][0][0] = 30341620260896663449892749311;
-        coeff[11][4][0][1] = 68613384077165002066887170067;
-        coeff[11][4][0][2] = 69158784751988702784384890858;
-        coeff[11][4][0][3] = 1595500335;
-
-        coeff[11][4][1][0] = 0;
-        coeff[11][4][1][1] = 0;
-        coeff[11][4][1][2] = 0;
-        coeff[11][4][1][3] = 0;
-
-        coeff[11][5][0][0] = 30918888157334040571029970872;
-        coeff[11][5][0][1] = 38110497911700059231495300413;
-        coeff[11][5][0][2] = 9956775014100533415029595983;
-        coeff[11][5][0][3] = 7742960891664846859912986292;
-
-        coeff[11][5][1][0] = 23961508344847352386299906803;
-        coeff[11][5][1][1] = 73053643719720755424335321793;
-        coeff[11][5][1][2] = 10870206300725050764578763631;
-        coeff[11][5][1][3] = 304942890421345320673339650;
-    }
-    if (n == 77 && k == 5) {
-        coeff[0][0][0][0] = 1;
-        coeff[0][0][0][1] = 0;
-        coeff[0][0][0][2] = 0;
-        coeff[0][0][0][3] = 0;
-        coeff[0][0][0][4] = 0;
-
-        coeff[0][0][1][0] = 0;
-        coeff[0][0][1][1] = 0;
-        coeff[0][0][1][2] = 0;
-        coeff[0][0][1][3] = 0;
-        coeff[0][0][1][4] = 0;
-
-        coeff[0][1][0][0] = 1;
-        coeff[0][1][0][1] = 0;
-        coeff[0][1][0][2] = 0;
-        coeff[0][1][0][3] = 0;
-        coeff[0][1][0][4] = 0;
-
-        coeff[0][1][1][0] = 0;
-        coeff[0][1][1][1] = 0;
-        coeff[0][1][1][2] = 0;
-        coeff[0][1][1][3] = 0;
-        coeff[0][1][1][4] = 0;
-
-        coeff[0][2][0][0] = 1;
-        coeff[0][2][0][1] = 0;
-        coeff[0][2][0][2] = 0;
-        coeff[0][2][0][3] = 0;
-        coeff[0][2][0][4] = 0;
-
-        coeff[0][2][1][0] = 0;
-        coeff[0][2][1][1] = 0;
-        coeff[0][2][1][2] = 0;
-        coeff[0][2][1][3] = 0;
-        coeff[0][2][1][4] = 0;
-
-        coeff[0][3][0][0] = 1;
-        coeff[0][3][0][1] = 0;
-        coeff[0][3][0][2] = 0;
-        coeff[0][3][0][3] = 0;
-        coeff[0][3][0][4] = 0;
-
-        coeff[0][3][1][0] = 0;
-        coeff[0][3][1][1] = 0;
-        coeff[0][3][1][2] = 0;
-        coeff[0][3][1][3] = 0;
-        coeff[0][3][1][4] = 0;
-
-        coeff[0][4][0][0] = 1;
-        coeff[0][4][0][1] = 0;
-        coeff[0][4][0][2] = 0;
-        coeff[0][4][0][3] = 0;
-        coeff[0][4][0][4] = 0;
-
-        coeff[0][4][1][0] = 0;
-        coeff[0][4][1][1] = 0;
-        coeff[0][4][1][2] = 0;
-        coeff[0][4][1][3] = 0;
-        coeff[0][4][1][4] = 0;
-
-        coeff[0][5][0][0] = 1;
-        coeff[0][5][0][1] = 0;
-        coeff[0][5][0][2] = 0;
-        coeff[0][5][0][3] = 0;
-        coeff[0][5][0][4] = 0;
-
-        coeff[0][5][1][0] = 0;
-        coeff[0][5][1][1] = 0;
-        coeff[0][5][1][2] = 0;
-        coeff[0][5][1][3] = 0;
-        coeff[0][5][1][4] = 0;
-
-        coeff[1][0][0][0] = 1;
-        coeff[1][0][0][1] = 0;
-        coeff[1][0][0][2] = 0;
-        coeff[1][0][0][3] = 0;
-        coeff[1][0][0][4] = 0;
-
-        coeff[1][0][1][0] = 0;
-        coeff[1][0][1][1] = 0;
-        coeff[1][0][1][2] = 0;
-        coeff[1][0][1][3] = 0;
-        coeff[1][0][1][4] = 0;
-
-        coeff[1][1][0][0] = 5857780092113332166584;
-        coeff[1][1][0][1] = 27555843941809817067324;
-        coeff[1][1][0][2] = 147854065178978622174689;
-        coeff[1][1][0][3] = 16480454558870818237447;
-        coeff[1][1][0][4] = 7384262935318800792611;
-
-        coeff[1][1][1][0] = 145252903046657682983667;
-        coeff[1][1][1][1] = 74116926119540154854243;
-        coeff[1][1][1][2] = 9107065692449161851484;
-        coeff[1][1][1][3] = 93599087433168491987599;
-        coeff[1][1][1][4] = 290816202565522499726;
-
-        coeff[1][2][0][0] = 0;
-        coeff[1][2][0][1] = 0;
-        coeff[1][2][0][2] = 0;
-        coeff[1][2][0][3] = 0;
-        coeff[1][2][0][4] = 0;
-
-        coeff[1][2][1][0] = 151070474438347898006188;
-        coeff[1][2][1][1] = 140545516233852444113487;
-        coeff[1][2][1][2] = 148207872154034921691459;
-        coeff[1][2][1][3] = 21270016808265337543434;
-        coeff[1][2][1][4] = 7675079137884323290816;
-
-        coeff[1][3][0][0] = 28127254136958132407305;
-        coeff[1][3][0][1] = 21583712728585527334752;
-        coeff[1][3][0][2] = 51663912557182296229312;
-        coeff[1][3][0][3] = 17835324027044025627323;
-        coeff[1][3][0][4] = 1972711818993931957891;
-
-        coeff[1][3][1][0] = 28127254136958132407305;
-        coeff[1][3][1][1] = 21583712728585527334752;
-        coeff[1][3][1][2] = 51663912557182296229312;
-        coeff[1][3][1][3] = 17835324027044025627323;
-        coeff[1][3][1][4] = 1972711818993931957891;
-
-        coeff[1][4][0][0] = 151070474438347898006189;
-        coeff[1][4][0][1] = 140545516233852444113487;
-        coeff[1][4][0][2] = 148207872154034921691459;
-        coeff[1][4][0][3] = 21270016808265337543434;
-        coeff[1][4][0][4] = 7675079137884323290816;
-
-        coeff[1][4][1][0] = 0;
-        coeff[1][4][1][1] = 0;
-        coeff[1][4][1][2] = 0;
-        coeff[1][4][1][3] = 0;
-        coeff[1][4][1][4] = 0;
-
-        coeff[1][5][0][0] = 33990078542129096261910;
-        coeff[1][5][0][1] = 98582514060874019318780;
-        coeff[1][5][0][2] = 42556846864733134377827;
-        coeff[1][5][0][3] = 75351964045704180477996;
-        coeff[1][5][0][4] = 1681895616428409458164;
-
-        coeff[1][5][1][0] = 117120604596641918888341;
-        coeff[1][5][1][1] = 3090256000475952602787;
-        coeff[1][5][1][2] = 114404284006694649648346;
-        coeff[1][5][1][3] = 34727577946335129747050;
-        coeff[1][5][1][4] = 5993183521455913834173;
-
-        coeff[2][0][0][0] = 1;
-        coeff[2][0][0][1] = 0;
-        coeff[2][0][0][2] = 0;
-        coeff[2][0][0][3] = 0;
-        coeff[2][0][0][4] = 0;
-
-        coeff[2][0][1][0] = 0;
-        coeff[2][0][1][1] = 0;
-        coeff[2][0][1][2] = 0;
-        coeff[2][0][1][3] = 0;
-        coeff[2][0][1][4] = 0;
-
-        coeff[2][1][0][0] = 40208700423117144063;
-        coeff[2][1][0][1] = 112242981279326174646352;
-        coeff[2][1][0][2] = 8753258717392862334713;
-        coeff[2][1][0][3] = 88809525183773972681612;
-        coeff[2][1][0][4] = 1521;
-
-        coeff[2][1][1][0] = 0;
-        coeff[2][1][1][1] = 0;
-        coeff[2][1][1][2] = 0;
-        coeff[2][1][1][3] = 0;
-        coeff[2][1][1][4] = 0;
-
-        coeff[2][2][0][0] = 40208700423117144062;
-        coeff[2][2][0][1] = 112242981279326174646352;
-        coeff[2][2][0][2] = 8753258717392862334713;
-        coeff[2][2][0][3] = 88809525183773972681612;
-        coeff[2][2][0][4] = 1521;
-
-        coeff[2][2][1][0] = 0;
-        coeff[2][2][1][1] = 0;
-        coeff[2][2][1][2] = 0;
-        coeff[2][2][1][3] = 0;
-        coeff[2][2][1][4] = 0;
-
-        coeff[2][3][0][0] = 151110683138771015150250;
-        coeff[2][3][0][1] = 101672770061349971921567;
-        coeff[2][3][0][2] = 5845403419599137187901;
-        coeff[2][3][0][3] = 110079541992039310225047;
-        coeff[2][3][0][4] = 7675079137884323292337;
-
-        coeff[2][3][1][0] = 0;
-        coeff[2][3][1][1] = 0;
-        coeff[2][3][1][2] = 0;
-        coeff[2][3][1][3] = 0;
-        coeff[2][3][1][4] = 0;
-
-        coeff[2][4][0][0] = 151070474438347898006188;
-        coeff[2][4][0][1] = 140545516233852444113487;
-        coeff[2][4][0][2] = 148207872154034921691459;
-        coeff[2][4][0][3] = 21270016808265337543434;
-        coeff[2][4][0][4] = 7675079137884323290816;
-
-        coeff[2][4][1][0] = 0;
-        coeff[2][4][1][1] = 0;
-        coeff[2][4][1][2] = 0;
-        coeff[2][4][1][3] = 0;
-        coeff[2][4][1][4] = 0;
-
-        coeff[2][5][0][0] = 151070474438347898006189;
-        coeff[2][5][0][1] = 140545516233852444113487;
-        coeff[2][5][0][2] = 148207872154034921691459;
-        coeff[2][5][0][3] = 21270016808265337543434;
-        coeff[2][5][0][4] = 7675079137884323290816;
-
-        coeff[2][5][1][0] = 0;
-        coeff[2][5][1][1] = 0;
-        coeff[2][5][1][2] = 0;
-        coeff[2][5][1][3] = 0;
-        coeff[2][5][1][4] = 0;
-
-        coeff[3][0][0][0] = 1;
-        coeff[3][0][0][1] = 0;
-        coeff[3][0][0][2] = 0;
-        coeff[3][0][0][3] = 0;
-        coeff[3][0][0][4] = 0;
-
-        coeff[3][0][1][0] = 0;
-        coeff[3][0][1][1] = 0;
-        coeff[3][0][1][2] = 0;
-        coeff[3][0][1][3] = 0;
-        coeff[3][0][1][4] = 0;
-
-        coeff[3][1][0][0] = 122983429001812882742946;
-        coeff[3][1][0][1] = 80089057332764444586815;
-        coeff[3][1][0][2] = 105297218314245487796861;
-        coeff[3][1][0][3] = 92244217964995284597723;
-        coeff[3][1][0][4] = 5702367318890391334446;
-
-        coeff[3][1][1][0] = 28127254136958132407305;
-        coeff[3][1][1][1] = 21583712728585527334752;
-        coeff[3][1][1][2] = 51663912557182296229312;
-        coeff[3][1][1][3] = 17835324027044025627323;
-        coeff[3][1][1][4] = 1972711818993931957891;
-
-        coeff[3][2][0][0] = 0;
-        coeff[3][2][0][1] = 0;
-        coeff[3][2][0][2] = 0;
-        coeff[3][2][0][3] = 0;
-        coeff[3][2][0][4] = 0;
-
-        coeff[3][2][1][0] = 1;
-        coeff[3][2][1][1] = 0;
-        coeff[3][2][1][2] = 0;
-        coeff[3][2][1][3] = 0;
-        coeff[3][2][1][4] = 0;
-
-        coeff[3][3][0][0] = 122983429001812882742946;
-        coeff[3][3][0][1] = 80089057332764444586815;
-        coeff[3][3][0][2] = 105297218314245487796861;
-        coeff[3][3][0][3] = 92244217964995284597723;
-        coeff[3][3][0][4] = 5702367318890391334446;
-
-        coeff[3][3][1][0] = 122983429001812882742946;
-        coeff[3][3][1][1] = 80089057332764444586815;
-        coeff[3][3][1][2] = 105297218314245487796861;
-        coeff[3][3][1][3] = 92244217964995284597723;
-        coeff[3][3][1][4] = 5702367318890391334446;
-
-        coeff[3][4][0][0] = 151110683138771015150250;
-        coeff[3][4][0][1] = 101672770061349971921567;
-        coeff[3][4][0][2] = 5845403419599137187901;
-        coeff[3][4][0][3] = 110079541992039310225047;
-        coeff[3][4][0][4] = 7675079137884323292337;
-
-        coeff[3][4][1][0] = 0;
-        coeff[3][4][1][1] = 0;
-        coeff[3][4][1][2] = 0;
-        coeff[3][4][1][3] = 0;
-        coeff[3][4][1][4] = 0;
-
-        coeff[3][5][0][0] = 28127254136958132407305;
-        coeff[3][5][0][1] = 21583712728585527334752;
-        coeff[3][5][0][2] = 51663912557182296229312;
-        coeff[3][5][0][3] = 17835324027044025627323;
-        coeff[3][5][0][4] = 1972711818993931957891;
-
-        coeff[3][5][1][0] = 122983429001812882742946;
-        coeff[3][5][1][1] = 80089057332764444586815;
-        coeff[3][5][1][2] = 105297218314245487796861;
-        coeff[3][5][1][3] = 92244217964995284597723;
-        coeff[3][5][1][4] = 5702367318890391334446;
-
-        coeff[4][0][0][0] = 1;
-        coeff[4][0][0][1] = 0;
-        coeff[4][0][0][2] = 0;
-        coeff[4][0][0][3] = 0;
-        coeff[4][0][0][4] = 0;
-
-        coeff[4][0][1][0] = 0;
-        coeff[4][0][1][1] = 0;
-        coeff[4][0][1][2] = 0;
-        coeff[4][0][1][3] = 0;
-        coeff[4][0][1][4] = 0;
-
-        coeff[4][1][0][0] = 40208700423117144062;
-        coeff[4][1][0][1] = 112242981279326174646352;
-        coeff[4][1][0][2] = 8753258717392862334713;
-        coeff[4][1][0][3] = 88809525183773972681612;
-        coeff[4][1][0][4] = 1521;
-
-        coeff[4][1][1][0] = 0;
-        coeff[4][1][1][1] = 0;
-        coeff[4][1][1][2] = 0;
-        coeff[4][1][1][3] = 0;
-        coeff[4][1][1][4] = 0;
-
-        coeff[4][2][0][0] = 151070474438347898006188;
-        coeff[4][2][0][1] = 140545516233852444113487;
-        coeff[4][2][0][2] = 148207872154034921691459;
-        coeff[4][2][0][3] = 21270016808265337543434;
-        coeff[4][2][0][4] = 7675079137884323290816;
-
-        coeff[4][2][1][0] = 0;
-        coeff[4][2][1][1] = 0;
-        coeff[4][2][1][2] = 0;
-        coeff[4][2][1][3] = 0;
-        coeff[4][2][1][4] = 0;
-
-        coeff[4][3][0][0] = 1;
-        coeff[4][3][0][1] = 0;
-        coeff[4][3][0][2] = 0;
-        coeff[4][3][0][3] = 0;
-        coeff[4][3][0][4] = 0;
-
-        coeff[4][3][1][0] = 0;
-        coeff[4][3][1][1] = 0;
-        coeff[4][3][1][2] = 0;
-        coeff[4][3][1][3] = 0;
-        coeff[4][3][1][4] = 0;
-
-        coeff[4][4][0][0] = 40208700423117144062;
-        coeff[4][4][0][1] = 112242981279326174646352;
-        coeff[4][4][0][2] = 8753258717392862334713;
-        coeff[4][4][0][3] = 88809525183773972681612;
-        coeff[4][4][0][4] = 1521;
-
-        coeff[4][4][1][0] = 0;
-        coeff[4][4][1][1] = 0;
-        coeff[4][4][1][2] = 0;
-        coeff[4][4][1][3] = 0;
-        coeff[4][4][1][4] = 0;
-
-        coeff[4][5][0][0] = 151070474438347898006188;
-        coeff[4][5][0][1] = 140545516233852444113487;
-        coeff[4][5][0][2] = 148207872154034921691459;
-        coeff[4][5][0][3] = 21270016808265337543434;
-        coeff[4][5][0][4] = 7675079137884323290816;
-
-        coeff[4][5][1][0] = 0;
-        coeff[4][5][1][1] = 0;
-        coeff[4][5][1][2] = 0;
-        coeff[4][5][1][3] = 0;
-        coeff[4][5][1][4] = 0;
-
-        coeff[5][0][0][0] = 1;
-        coeff[5][0][0][1] = 0;
-        coeff[5][0][0][2] = 0;
-        coeff[5][0][0][3] = 0;
-        coeff[5][0][0][4] = 0;
-
-        coeff[5][0][1][0] = 0;
-        coeff[5][0][1][1] = 0;
-        coeff[5][0][1][2] = 0;
-        coeff[5][0][1][3] = 0;
-        coeff[5][0][1][4] = 0;
-
-        coeff[5][1][0][0] = 117120604596641918888341;
-        coeff[5][1][0][1] = 3090256000475952602787;
-        coeff[5][1][0][2] = 114404284006694649648346;
-        coeff[5][1][0][3] = 34727577946335129747050;
-        coeff[5][1][0][4] = 5993183521455913834173;
-
-        coeff[5][1][1][0] = 33990078542129096261910;
-        coeff[5][1][1][1] = 98582514060874019318780;
-        coeff[5][1][1][2] = 42556846864733134377827;
-        coeff[5][1][1][3] = 75351964045704180477996;
-        coeff[5][1][1][4] = 1681895616428409458164;
-
-        coeff[5][2][0][0] = 0;
-        coeff[5][2][0][1] = 0;
-        coeff[5][2][0][2] = 0;
-        coeff[5][2][0][3] = 0;
-        coeff[5][2][0][4] = 0;
-
-        coeff[5][2][1][0] = 40208700423117144062;
-        coeff[5][2][1][1] = 112242981279326174646352;
-        coeff[5][2][1][2] = 8753258717392862334713;
-        coeff[5][2][1][3] = 88809525183773972681612;
-        coeff[5][2][1][4] = 1521;
-
-        coeff[5][3][0][0] = 28127254136958132407305;
-        coeff[5][3][0][1] = 21583712728585527334752;
-        coeff[5][3][0][2] = 51663912557182296229312;
-        coeff[5][3][0][3] = 17835324027044025627323;
-        coeff[5][3][0][4] = 1972711818993931957891;
-
-        coeff[5][3][1][0] = 28127254136958132407305;
-        coeff[5][3][1][1] = 21583712728585527334752;
-        coeff[5][3][1][2] = 51663912557182296229312;
-        coeff[5][3][1][3] = 17835324027044025627323;
-        coeff[5][3][1][4] = 1972711818993931957891;
-
-        coeff[5][4][0][0] = 40208700423117144063;
-        coeff[5][4][0][1] = 112242981279326174646352;
-        coeff[5][4][0][2] = 8753258717392862334713;
-        coeff[5][4][0][3] = 88809525183773972681612;
-        coeff[5][4][0][4] = 1521;
-
-        coeff[5][4][1][0] = 0;
-        coeff[5][4][1][1] = 0;
-        coeff[5][4][1][2] = 0;
-        coeff[5][4][1][3] = 0;
-        coeff[5][4][1][4] = 0;
-
-        coeff[5][5][0][0] = 145252903046657682983667;
-        coeff[5][5][0][1] = 74116926119540154854243;
-        coeff[5][5][0][2] = 9107065692449161851484;
-        coeff[5][5][0][3] = 93599087433168491987599;
-        coeff[5][5][0][4] = 290816202565522499726;
-
-        coeff[5][5][1][0] = 5857780092113332166584;
-        coeff[5][5][1][1] = 27555843941809817067324;
-        coeff[5][5][1][2] = 147854065178978622174689;
-        coeff[5][5][1][3] = 16480454558870818237447;
-        coeff[5][5][1][4] = 7384262935318800792611;
-
-        coeff[6][0][0][0] = 1;
-        coeff[6][0][0][1] = 0;
-        coeff[6][0][0][2] = 0;
-        coeff[6][0][0][3] = 0;
-        coeff[6][0][0][4] = 0;
-
-        coeff[6][0][1][0] = 0;
-        coeff[6][0][1][1] = 0;
-        coeff[6][0][1][2] = 0;
-        coeff[6][0][1][3] = 0;
-        coeff[6][0][1][4] = 0;
-
-        coeff[6][1][0][0] = 151110683138771015150250;
-        coeff[6][1][0][1] = 101672770061349971921567;
-        coeff[6][1][0][2] = 5845403419599137187901;
-        coeff[6][1][0][3] = 110079541992039310225047;
-        coeff[6][1][0][4] = 7675079137884323292337;
-
-        coeff[6][1][1][0] = 0;
-        coeff[6][1][1][1] = 0;
-        coeff[6][1][1][2] = 0;
-        coeff[6][1][1][3] = 0;
-        coeff[6][1][1][4] = 0;
-
-        coeff[6][2][0][0] = 1;
-        coeff[6][2][0][1] = 0;
-        coeff[6][2][0][2] = 0;
-        coeff[6][2][0][3] = 0;
-        coeff[6][2][0][4] = 0;
-
-        coeff[6][2][1][0] = 0;
-        coeff[6][2][1][1] = 0;
-        coeff[6][2][1][2] = 0;
-        coeff[6][2][1][3] = 0;
-        coeff[6][2][1][4] = 0;
-
-        coeff[6][3][0][0] = 151110683138771015150250;
-        coeff[6][3][0][1] = 101672770061349971921567;
-        coeff[6][3][0][2] = 5845403419599137187901;
-        coeff[6][3][0][3] = 110079541992039310225047;
-        coeff[6][3][0][4] = 7675079137884323292337;
-
-        coeff[6][3][1][0] = 0;
-        coeff[6][3][1][1] = 0;
-        coeff[6][3][1][2] = 0;
-        coeff[6][3][1][3] = 0;
-        coeff[6][3][1][4] = 0;
-
-        coeff[6][4][0][0] = 1;
-        coeff[6][4][0][1] = 0;
-        coeff[6][4][0][2] = 0;
-        coeff[6][4][0][3] = 0;
-        coeff[6][4][0][4] = 0;
-
-        coeff[6][4][1][0] = 0;
-        coeff[6][4][1][1] = 0;
-        coeff[6][4][1][2] = 0;
-        coeff[6][4][1][3] = 0;
-        coeff[6][4][1][4] = 0;
-
-        coeff[6][5][0][0] = 151110683138771015150250;
-        coeff[6][5][0][1] = 101672770061349971921567;
-        coeff[6][5][0][2] = 5845403419599137187901;
-        coeff[6][5][0][3] = 110079541992039310225047;
-        coeff[6][5][0][4] = 7675079137884323292337;
-
-        coeff[6][5][1][0] = 0;
-        coeff[6][5][1][1] = 0;
-        coeff[6][5][1][2] = 0;
-        coeff[6][5][1][3] = 0;
-        coeff[6][5][1][4] = 0;
-
-        coeff[7][0][0][0] = 1;
-        coeff[7][0][0][1] = 0;
-        coeff[7][0][0][2] = 0;
-        coeff[7][0][0][3] = 0;
-        coeff[7][0][0][4] = 0;
-
-        coeff[7][0][1][0] = 0;
-        coeff[7][0][1][1] = 0;
-        coeff[7][0][1][2] = 0;
-        coeff[7][0][1][3] = 0;
-        coeff[7][0][1][4] = 0;
-
-        coeff[7][1][0][0] = 145252903046657682983667;
-        coeff[7][1][0][1] = 74116926119540154854243;
-        coeff[7][1][0][2] = 9107065692449161851484;
-        coeff[7][1][0][3] = 93599087433168491987599;
-        coeff[7][1][0][4] = 290816202565522499726;
-
-        coeff[7][1][1][0] = 5857780092113332166584;
-        coeff[7][1][1][1] = 27555843941809817067324;
-        coeff[7][1][1][2] = 147854065178978622174689;
-        coeff[7][1][1][3] = 16480454558870818237447;
-        coeff[7][1][1][4] = 7384262935318800792611;
-
-        coeff[7][2][0][0] = 0;
-        coeff[7][2][0][1] = 0;
-        coeff[7][2][0][2] = 0;
-        coeff[7][2][0][3] = 0;
-        coeff[7][2][0][4] = 0;
-
-        coeff[7][2][1][0] = 151070474438347898006188;
-        coeff[7][2][1][1] = 140545516233852444113487;
-        coeff[7][2][1][2] = 148207872154034921691459;
-        coeff[7][2][1][3] = 21270016808265337543434;
-        coeff[7][2][1][4] = 7675079137884323290816;
-
-        coeff[7][3][0][0] = 122983429001812882742946;
-        coeff[7][3][0][1] = 80089057332764444586815;
-        coeff[7][3][0][2] = 105297218314245487796861;
-        coeff[7][3][0][3] = 92244217964995284597723;
-        coeff[7][3][0][4] = 5702367318890391334446;
-
-        coeff[7][3][1][0] = 122983429001812882742946;
-        coeff[7][3][1][1] = 80089057332764444586815;
-        coeff[7][3][1][2] = 105297218314245487796861;
-        coeff[7][3][1][3] = 92244217964995284597723;
-        coeff[7][3][1][4] = 5702367318890391334446;
-
-        coeff[7][4][0][0] = 151070474438347898006189;
-        coeff[7][4][0][1] = 140545516233852444113487;
-        coeff[7][4][0][2] = 148207872154034921691459;
-        coeff[7][4][0][3] = 21270016808265337543434;
-        coeff[7][4][0][4] = 7675079137884323290816;
-
-        coeff[7][4][1][0] = 0;
-        coeff[7][4][1][1] = 0;
-        coeff[7][4][1][2] = 0;
-        coeff[7][4][1][3] = 0;
-        coeff[7][4][1][4] = 0;
-
-        coeff[7][5][0][0] = 117120604596641918888341;
-        coeff[7][5][0][1] = 3090256000475952602787;
-        coeff[7][5][0][2] = 114404284006694649648346;
-        coeff[7][5][0][3] = 34727577946335129747050;
-        coeff[7][5][0][4] = 5993183521455913834173;
-
-        coeff[7][5][1][0] = 33990078542129096261910;
-        coeff[7][5][1][1] = 98582514060874019318780;
-        coeff[7][5][1][2] = 42556846864733134377827;
-        coeff[7][5][1][3] = 75351964045704180477996;
-        coeff[7][5][1][4] = 1681895616428409458164;
-
-        coeff[8][0][0][0] = 1;
-        coeff[8][0][0][1] = 0;
-        coeff[8][0][0][2] = 0;
-        coeff[8][0][0][3] = 0;
-        coeff[8][0][0][4] = 0;
-
-        coeff[8][0][1][0] = 0;
-        coeff[8][0][1][1] = 0;
-        coeff[8][0][1][2] = 0;
-        coeff[8][0][1][3] = 0;
-        coeff[8][0][1][4] = 0;
-
-        coeff[8][1][0][0] = 151070474438347898006188;
-        coeff[8][1][0][1] = 140545516233852444113487;
-        coeff[8][1][0][2] = 148207872154034921691459;
-        coeff[8][1][0][3] = 21270016808265337543434;
-        coeff[8][1][0][4] = 7675079137884323290816;
-
-        coeff[8][1][1][0] = 0;
-        coeff[8][1][1][1] = 0;
-        coeff[8][1][1][2] = 0;
-        coeff[8][1][1][3] = 0;
-        coeff[8][1][1][4] = 0;
-
-        coeff[8][2][0][0] = 40208700423117144062;
-        coeff[8][2][0][1] = 112242981279326174646352;
-        coeff[8][2][0][2] = 8753258717392862334713;
-        coeff[8][2][0][3] = 88809525183773972681612;
-        coeff[8][2][0][4] = 1521;
-
-        coeff[8][2][1][0] = 0;
-        coeff[8][2][1][1] = 0;
-        coeff[8][2][1][2] = 0;
-        coeff[8][2][1][3] = 0;
-        coeff[8][2][1][4] = 0;
-
-        coeff[8][3][0][0] = 1;
-        coeff[8][3][0][1] = 0;
-        coeff[8][3][0][2] = 0;
-        coeff[8][3][0][3] = 0;
-        coeff[8][3][0][4] = 0;
-
-        coeff[8][3][1][0] = 0;
-        coeff[8][3][1][1] = 0;
-        coeff[8][3][1][2] = 0;
-        coeff[8][3][1][3] = 0;
-        coeff[8][3][1][4] = 0;
-
-        coeff[8][4][0][0] = 151070474438347898006188;
-        coeff[8][4][0][1] = 140545516233852444113487;
-        coeff[8][4][0][2] = 148207872154034921691459;
-        coeff[8][4][0][3] = 21270016808265337543434;
-        coeff[8][4][0][4] = 7675079137884323290816;
-
-        coeff[8][4][1][0] = 0;
-        coeff[8][4][1][1] = 0;
-        coeff[8][4][1][2] = 0;
-        coeff[8][4][1][3] = 0;
-        coeff[8][4][1][4] = 0;
-
-        coeff[8][5][0][0] = 40208700423117144062;
-        coeff[8][5][0][1] = 112242981279326174646352;
-        coeff[8][5][0][2] = 8753258717392862334713;
-        coeff[8][5][0][3] = 88809525183773972681612;
-        coeff[8][5][0][4] = 1521;
-
-        coeff[8][5][1][0] = 0;
-        coeff[8][5][1][1] = 0;
-        coeff[8][5][1][2] = 0;
-        coeff[8][5][1][3] = 0;
-        coeff[8][5][1][4] = 0;
-
-        coeff[9][0][0][0] = 1;
-        coeff[9][0][0][1] = 0;
-        coeff[9][0][0][2] = 0;
-        coeff[9][0][0][3] = 0;
-        coeff[9][0][0][4] = 0;
-
-        coeff[9][0][1][0] = 0;
-        coeff[9][0][1][1] = 0;
-        coeff[9][0][1][2] = 0;
-        coeff[9][0][1][3] = 0;
-        coeff[9][0][1][4] = 0;
-
-        coeff[9][1][0][0] = 28127254136958132407305;
-        coeff[9][1][0][1] = 21583712728585527334752;
-        coeff[9][1][0][2] = 51663912557182296229312;
-        coeff[9][1][0][3] = 17835324027044025627323;
-        coeff[9][1][0][4] = 1972711818993931957891;
-
-        coeff[9][1][1][0] = 122983429001812882742946;
-        coeff[9][1][1][1] = 80089057332764444586815;
-        coeff[9][1][1][2] = 105297218314245487796861;
-        coeff[9][1][1][3] = 92244217964995284597723;
-        coeff[9][1][1][4] = 5702367318890391334446;
-
-        coeff[9][2][0][0] = 0;
-        coeff[9][2][0][1] = 0;
-        coeff[9][2][0][2] = 0;
-        coeff[9][2][0][3] = 0;
-        coeff[9][2][0][4] = 0;
-
-        coeff[9][2][1][0] = 1;
-        coeff[9][2][1][1] = 0;
-        coeff[9][2][1][2] = 0;
-        coeff[9][2][1][3] = 0;
-        coeff[9][2][1][4] = 0;
-
-        coeff[9][3][0][0] = 28127254136958132407305;
-        coeff[9][3][0][1] = 21583712728585527334752;
-        coeff[9][3][0][2] = 51663912557182296229312;
-        coeff[9][3][0][3] = 17835324027044025627323;
-        coeff[9][3][0][4] = 1972711818993931957891;
-
-        coeff[9][3][1][0] = 28127254136958132407305;
-        coeff[9][3][1][1] = 21583712728585527334752;
-        coeff[9][3][1][2] = 51663912557182296229312;
-        coeff[9][3][1][3] = 17835324027044025627323;
-        coeff[9][3][1][4] = 1972711818993931957891;
-
-        coeff[9][4][0][0] = 151110683138771015150250;
-        coeff[9][4][0][1] = 101672770061349971921567;
-        coeff[9][4][0][2] = 5845403419599137187901;
-        coeff[9][4][0][3] = 110079541992039310225047;
-        coeff[9][4][0][4] = 7675079137884323292337;
-
-        coeff[9][4][1][0] = 0;
-        coeff[9][4][1][1] = 0;
-        coeff[9][4][1][2] = 0;
-        coeff[9][4][1][3] = 0;
-        coeff[9][4][1][4] = 0;
-
-        coeff[9][5][0][0] = 122983429001812882742946;
-        coeff[9][5][0][1] = 80089057332764444586815;
-        coeff[9][5][0][2] = 105297218314245487796861;
-        coeff[9][5][0][3] = 92244217964995284597723;
-        coeff[9][5][0][4] = 5702367318890391334446;
-
-        coeff[9][5][1][0] = 28127254136958132407305;
-        coeff[9][5][1][1] = 21583712728585527334752;
-        coeff[9][5][1][2] = 51663912557182296229312;
-        coeff[9][5][1][3] = 17835324027044025627323;
-        coeff[9][5][1][4] = 1972711818993931957891;
-
-        coeff[10][0][0][0] = 1;
-        coeff[10][0][0][1] = 0;
-        coeff[10][0][0][2] = 0;
-        coeff[10][0][0][3] = 0;
-        coeff[10][0][0][4] = 0;
-
-        coeff[10][0][1][0] = 0;
-        coeff[10][0][1][1] = 0;
-        coeff[10][0][1][2] = 0;
-        coeff[10][0][1][3] = 0;
-        coeff[10][0][1][4] = 0;
-
-        coeff[10][1][0][0] = 151070474438347898006189;
-        coeff[10][1][0][1] = 140545516233852444113487;
-        coeff[10][1][0][2] = 148207872154034921691459;
-        coeff[10][1][0][3] = 21270016808265337543434;
-        coeff[10][1][0][4] = 7675079137884323290816;
-
-        coeff[10][1][1][0] = 0;
-        coeff[10][1][1][1] = 0;
-        coeff[10][1][1][2] = 0;
-        coeff[10][1][1][3] = 0;
-        coeff[10][1][1][4] = 0;
-
-        coeff[10][2][0][0] = 151070474438347898006188;
-        coeff[10][2][0][1] = 140545516233852444113487;
-        coeff[10][2][0][2] = 148207872154034921691459;
-        coeff[10][2][0][3] = 21270016808265337543434;
-        coeff[10][2][0][4] = 7675079137884323290816;
-
-        coeff[10][2][1][0] = 0;
-        coeff[10][2][1][1] = 0;
-        coeff[10][2][1][2] = 0;
-        coeff[10][2][1][3] = 0;
-        coeff[10][2][1][4] = 0;
-
-        coeff[10][3][0][0] = 151110683138771015150250;
-        coeff[10][3][0][1] = 101672770061349971921567;
-        coeff[10][3][0][2] = 5845403419599137187901;
-        coeff[10][3][0][3] = 110079541992039310225047;
-        coeff[10][3][0][4] = 7675079137884323292337;
-
-        coeff[10][3][1][0] = 0;
-        coeff[10][3][1][1] = 0;
-        coeff[10][3][1][2] = 0;
-        coeff[10][3][1][3] = 0;
-        coeff[10][3][1][4] = 0;
-
-        coeff[10][4][0][0] = 40208700423117144062;
-        coeff[10][4][0][1] = 112242981279326174646352;
-        coeff[10][4][0][2] = 8753258717392862334713;
-        coeff[10][4][0][3] = 88809525183773972681612;
-        coeff[10][4][0][4] = 1521;
-
-        coeff[10][4][1][0] = 0;
-        coeff[10][4][1][1] = 0;
-        coeff[10][4][1][2] = 0;
-        coeff[10][4][1][3] = 0;
-        coeff[10][4][1][4] = 0;
-
-        coeff[10][5][0][0] = 40208700423117144063;
-        coeff[10][5][0][1] = 112242981279326174646352;
-        coeff[10][5][0][2] = 8753258717392862334713;
-        coeff[10][5][0][3] = 88809525183773972681612;
-        coeff[10][5][0][4] = 1521;
-
-        coeff[10][5][1][0] = 0;
-        coeff[10][5][1][1] = 0;
-        coeff[10][5][1][2] = 0;
-        coeff[10][5][1][3] = 0;
-        coeff[10][5][1][4] = 0;
-
-        coeff[11][0][0][0] = 1;
-        coeff[11][0][0][1] = 0;
-        coeff[11][0][0][2] = 0;
-        coeff[11][0][0][3] = 0;
-        coeff[11][0][0][4] = 0;
-
-        coeff[11][0][1][0] = 0;
-        coeff[11][0][1][1] = 0;
-        coeff[11][0][1][2] = 0;
-        coeff[11][0][1][3] = 0;
-        coeff[11][0][1][4] = 0;
-
-        coeff[11][1][0][0] = 33990078542129096261910;
-        coeff[11][1][0][1] = 98582514060874019318780;
-        coeff[11][1][0][2] = 42556846864733134377827;
-        coeff[11][1][0][3] = 75351964045704180477996;
-        coeff[11][1][0][4] = 1681895616428409458164;
-
-        coeff[11][1][1][0] = 117120604596641918888341;
-        coeff[11][1][1][1] = 3090256000475952602787;
-        coeff[11][1][1][2] = 114404284006694649648346;
-        coeff[11][1][1][3] = 34727577946335129747050;
-        coeff[11][1][1][4] = 5993183521455913834173;
-
-        coeff[11][2][0][0] = 0;
-        coeff[11][2][0][1] = 0;
-        coeff[11][2][0][2] = 0;
-        coeff[11][2][0][3] = 0;
-        coeff[11][2][0][4] = 0;
-
-        coeff[11][2][1][0] = 40208700423117144062;
-        coeff[11][2][1][1] = 112242981279326174646352;
-        coeff[11][2][1][2] = 8753258717392862334713;
-        coeff[11][2][1][3] = 88809525183773972681612;
-        coeff[11][2][1][4] = 1521;
-
-        coeff[11][3][0][0] = 122983429001812882742946;
-        coeff[11][3][0][1] = 80089057332764444586815;
-        coeff[11][3][0][2] = 105297218314245487796861;
-        coeff[11][3][0][3] = 92244217964995284597723;
-        coeff[11][3][0][4] = 5702367318890391334446;
-
-        coeff[11][3][1][0] = 122983429001812882742946;
-        coeff[11][3][1][1] = 80089057332764444586815;
-        coeff[11][3][1][2] = 105297218314245487796861;
-        coeff[11][3][1][3] = 92244217964995284597723;
-        coeff[11][3][1][4] = 5702367318890391334446;
-
-        coeff[11][4][0][0] = 40208700423117144063;
-        coeff[11][4][0][1] = 112242981279326174646352;
-        coeff[11][4][0][2] = 8753258717392862334713;
-        coeff[11][4][0][3] = 88809525183773972681612;
-        coeff[11][4][0][4] = 1521;
-
-        coeff[11][4][1][0] = 0;
-        coeff[11][4][1][1] = 0;
-        coeff[11][4][1][2] = 0;
-        coeff[11][4][1][3] = 0;
-        coeff[11][4][1][4] = 0;
-
-        coeff[11][5][0][0] = 5857780092113332166584;
-        coeff[11][5][0][1] = 27555843941809817067324;
-        coeff[11][5][0][2] = 147854065178978622174689;
-        coeff[11][5][0][3] = 16480454558870818237447;
-        coeff[11][5][0][4] = 7384262935318800792611;
-
-        coeff[11][5][1][0] = 145252903046657682983667;
-        coeff[11][5][1][1] = 74116926119540154854243;
-        coeff[11][5][1][2] = 9107065692449161851484;
-        coeff[11][5][1][3] = 93599087433168491987599;
-        coeff[11][5][1][4] = 290816202565522499726;
-    }
-    if (n == 55 && k == 7) {
-        coeff[0][0][0][0] = 1;
-        coeff[0][0][0][1] = 0;
-        coeff[0][0][0][2] = 0;
-        coeff[0][0][0][3] = 0;
-        coeff[0][0][0][4] = 0;
-        coeff[0][0][0][5] = 0;
-        coeff[0][0][0][6] = 0;
-
-        coeff[0][0][1][0] = 0;
-        coeff[0][0][1][1] = 0;
-        coeff[0][0][1][2] = 0;
-        coeff[0][0][1][3] = 0;
-        coeff[0][0][1][4] = 0;
-        coeff[0][0][1][5] = 0;
-        coeff[0][0][1][6] = 0;
-
-        coeff[0][1][0][0] = 1;
-        coeff[0][1][0][1] = 0;
-        coeff[0][1][0][2] = 0;
-        coeff[0][1][0][3] = 0;
-        coeff[0][1][0][4] = 0;
-        coeff[0][1][0][5] = 0;
-        coeff[0][1][0][6] = 0;
-
-        coeff[0][1][1][0] = 0;
-        coeff[0][1][1][1] = 0;
-        coeff[0][1][1][2] = 0;
-        coeff[0][1][1][3] = 0;
-        coeff[0][1][1][4] = 0;
-        coeff[0][1][1][5] = 0;
-        coeff[0][1][1][6] = 0;
-
-        coeff[0][2][0][0] = 1;
-        coeff[0][2][0][1] = 0;
-        coeff[0][2][0][2] = 0;
-        coeff[0][2][0][3] = 0;
-        coeff[0][2][0][4] = 0;
-        coeff[0][2][0][5] = 0;
-        coeff[0][2][0][6] = 0;
-
-        coeff[0][2][1][0] = 0;
-        coeff[0][2][1][1] = 0;
-        coeff[0][2][1][2] = 0;
-        coeff[0][2][1][3] = 0;
-        coeff[0][2][1][4] = 0;
-        coeff[0][2][1][5] = 0;
-        coeff[0][2][1][6] = 0;
-
-        coeff[0][3][0][0] = 1;
-        coeff[0][3][0][1] = 0;
-        coeff[0][3][0][2] = 0;
-        coeff[0][3][0][3] = 0;
-        coeff[0][3][0][4] = 0;
-        coeff[0][3][0][5] = 0;
-        coeff[0][3][0][6] = 0;
-
-        coeff[0][3][1][0] = 0;
-        coeff[0][3][1][1] = 0;
-        coeff[0][3][1][2] = 0;
-        coeff[0][3][1][3] = 0;
-        coeff[0][3][1][4] = 0;
-        coeff[0][3][1][5] = 0;
-        coeff[0][3][1][6] = 0;
-
-        coeff[0][4][0][0] = 1;
-        coeff[0][4][0][1] = 0;
-        coeff[0][4][0][2] = 0;
-        coeff[0][4][0][3] = 0;
-        coeff[0][4][0][4] = 0;
-        coeff[0][4][0][5] = 0;
-        coeff[0][4][0][6] = 0;
-
-        coeff[0][4][1][0] = 0;
-        coeff[0][4][1][1] = 0;
-        coeff[0][4][1][2] = 0;
-        coeff[0][4][1][3] = 0;
-        coeff[0][4][1][4] = 0;
-        coeff[0][4][1][5] = 0;
-        coeff[0][4][1][6] = 0;
-
-        coeff[0][5][0][0] = 1;
-        coeff[0][5][0][1] = 0;
-        coeff[0][5][0][2] = 0;
-        coeff[0][5][0][3] = 0;
-        coeff[0][5][0][4] = 0;
-        coeff[0][5][0][5] = 0;
-        coeff[0][5][0][6] = 0;
-
-        coeff[0][5][1][0] = 0;
-        coeff[0][5][1][1] = 0;
-        coeff[0][5][1][2] = 0;
-        coeff[0][5][1][3] = 0;
-        coeff[0][5][1][4] = 0;
-        coeff[0][5][1][5] = 0;
-        coeff[0][5][1][6] = 0;
-
-        coeff[1][0][0][0] = 1;
-        coeff[1][0][0][1] = 0;
-        coeff[1][0][0][2] = 0;
-        coeff[1][0][0][3] = 0;
-        coeff[1][0][0][4] = 0;
-        coeff[1][0][0][5] = 0;
-        coeff[1][0][0][6] = 0;
-
-        coeff[1][0][1][0] = 0;
-        coeff[1][0][1][1] = 0;
-        coeff[1][0][1][2] = 0;
-        coeff[1][0][1][3] = 0;
-        coeff[1][0][1][4] = 0;
-        coeff[1][0][1][5] = 0;
-        coeff[1][0][1][6] = 0;
-
-        coeff[1][1][0][0] = 2099988056465336;
-        coeff[1][1][0][1] = 20964146866715418;
-        coeff[1][1][0][2] = 26479447919286778;
-        coeff[1][1][0][3] = 28687334188327454;
-        coeff[1][1][0][4] = 18245231482781651;
-        coeff[1][1][0][5] = 21665078698214405;
-        coeff[1][1][0][6] = 1760545476751041;
-
-        coeff[1][1][1][0] = 33647333985766131;
-        coeff[1][1][1][1] = 15061775342732377;
-        coeff[1][1][1][2] = 10634308716634293;
-        coeff[1][1][1][3] = 15267386808624246;
-        coeff[1][1][1][4] = 34335022074067067;
-        coeff[1][1][1][5] = 1778035881690211;
-        coeff[1][1][1][6] = 69335985795384;
-
-        coeff[1][2][0][0] = 0;
-        coeff[1][2][0][1] = 0;
-        coeff[1][2][0][2] = 0;
-        coeff[1][2][0][3] = 0;
-        coeff[1][2][0][4] = 0;
-        coeff[1][2][0][5] = 0;
-        coeff[1][2][0][6] = 0;
-
-        coeff[1][2][1][0] = 35184372088875692;
-        coeff[1][2][1][1] = 22472499736345367;
-        coeff[1][2][1][2] = 5698637743850064;
-        coeff[1][2][1][3] = 21300661132716363;
-        coeff[1][2][1][4] = 21929049149954008;
-        coeff[1][2][1][5] = 23430044241153146;
-        coeff[1][2][1][6] = 1829881462546425;
-
-        coeff[1][3][0][0] = 4649817190157321;
-        coeff[1][3][0][1] = 14178090100713872;
-        coeff[1][3][0][2] = 25898210532243870;
-        coeff[1][3][0][3] = 6361890036890480;
-        coeff[1][3][0][4] = 6755281389607612;
-        coeff[1][3][0][5] = 401348527762810;
-        coeff[1][3][0][6] = 470331148861392;
-
-        coeff[1][3][1][0] = 4649817190157321;
-        coeff[1][3][1][1] = 14178090100713872;
-        coeff[1][3][1][2] = 25898210532243870;
-        coeff[1][3][1][3] = 6361890036890480;
-        coeff[1][3][1][4] = 6755281389607612;
-        coeff[1][3][1][5] = 401348527762810;
-        coeff[1][3][1][6] = 470331148861392;
-
-        coeff[1][4][0][0] = 35184372088875693;
-        coeff[1][4][0][1] = 22472499736345367;
-        coeff[1][4][0][2] = 5698637743850064;
-        coeff[1][4][0][3] = 21300661132716363;
-        coeff[1][4][0][4] = 21929049149954008;
-        coeff[1][4][0][5] = 23430044241153146;
-        coeff[1][4][0][6] = 1829881462546425;
-
-        coeff[1][4][1][0] = 0;
-        coeff[1][4][1][1] = 0;
-        coeff[1][4][1][2] = 0;
-        coeff[1][4][1][3] = 0;
-        coeff[1][4][1][4] = 0;
-        coeff[1][4][1][5] = 0;
-        coeff[1][4][1][6] = 0;
-
-        coeff[1][5][0][0] = 7031280223355158;
-        coeff[1][5][0][1] = 35145111776945462;
-        coeff[1][5][0][2] = 15263901815609576;
-        coeff[1][5][0][3] = 27123300247230202;
-        coeff[1][5][0][4] = 8449056334504512;
-        coeff[1][5][0][5] = 34652109665036566;
-        coeff[1][5][0][6] = 400995163066007;
-
-        coeff[1][5][1][0] = 28716041818876309;
-        coeff[1][5][1][1] = 880810432502333;
-        coeff[1][5][1][2] = 21849854820311495;
-        coeff[1][5][1][3] = 16831420749721498;
-        coeff[1][5][1][4] = 8102400203380238;
-        coeff[1][5][1][5] = 24819801933832019;
-        coeff[1][5][1][6] = 1428886299480417;
-
-        coeff[2][0][0][0] = 1;
-        coeff[2][0][0][1] = 0;
-        coeff[2][0][0][2] = 0;
-        coeff[2][0][0][3] = 0;
-        coeff[2][0][0][4] = 0;
-        coeff[2][0][0][5] = 0;
-        coeff[2][0][0][6] = 0;
-
-        coeff[2][0][1][0] = 0;
-        coeff[2][0][1][1] = 0;
-        coeff[2][0][1][2] = 0;
-        coeff[2][0][1][3] = 0;
-        coeff[2][0][1][4] = 0;
-        coeff[2][0][1][5] = 0;
-        coeff[2][0][1][6] = 0;
-
-        coeff[2][1][0][0] = 562949953355775;
-        coeff[2][1][0][1] = 13553422473102428;
-        coeff[2][1][0][2] = 31415118892071007;
-        coeff[2][1][0][3] = 22654059864235337;
-        coeff[2][1][0][4] = 30651204406894710;
-        coeff[2][1][0][5] = 13070338751470;
-        coeff[2][1][0][6] = 0;
-
-        coeff[2][1][1][0] = 0;
-        coeff[2][1][1][1] = 0;
-        coeff[2][1][1][2] = 0;
-        coeff[2][1][1][3] = 0;
-        coeff[2][1][1][4] = 0;
-        coeff[2][1][1][5] = 0;
-        coeff[2][1][1][6] = 0;
-
-        coeff[2][2][0][0] = 562949953355774;
-        coeff[2][2][0][1] = 13553422473102428;
-        coeff[2][2][0][2] = 31415118892071007;
-        coeff[2][2][0][3] = 22654059864235337;
-        coeff[2][2][0][4] = 30651204406894710;
-        coeff[2][2][0][5] = 13070338751470;
-        coeff[2][2][0][6] = 0;
-
-        coeff[2][2][1][0] = 0;
-        coeff[2][2][1][1] = 0;
-        coeff[2][2][1][2] = 0;
-        coeff[2][2][1][3] = 0;
-        coeff[2][2][1][4] = 0;
-        coeff[2][2][1][5] = 0;
-        coeff[2][2][1][6] = 0;
-
-        coeff[2][3][0][0] = 35747322042231466;
-        coeff[2][3][0][1] = 36025922209447795;
-        coeff[2][3][0][2] = 1084959616957103;
-        coeff[2][3][0][3] = 7925923977987733;
-        coeff[2][3][0][4] = 16551456537884751;
-        coeff[2][3][0][5] = 23443114579904617;
-        coeff[2][3][0][6] = 1829881462546425;
-
-        coeff[2][3][1][0] = 0;
-        coeff[2][3][1][1] = 0;
-        coeff[2][3][1][2] = 0;
-        coeff[2][3][1][3] = 0;
-        coeff[2][3][1][4] = 0;
-        coeff[2][3][1][5] = 0;
-        coeff[2][3][1][6] = 0;
-
-        coeff[2][4][0][0] = 35184372088875692;
-        coeff[2][4][0][1] = 22472499736345367;
-        coeff[2][4][0][2] = 5698637743850064;
-        coeff[2][4][0][3] = 21300661132716363;
-        coeff[2][4][0][4] = 21929049149954008;
-        coeff[2][4][0][5] = 23430044241153146;
-        coeff[2][4][0][6] = 1829881462546425;
-
-        coeff[2][4][1][0] = 0;
-        coeff[2][4][1][1] = 0;
-        coeff[2][4][1][2] = 0;
-        coeff[2][4][1][3] = 0;
-        coeff[2][4][1][4] = 0;
-        coeff[2][4][1][5] = 0;
-        coeff[2][4][1][6] = 0;
-
-        coeff[2][5][0][0] = 35184372088875693;
-        coeff[2][5][0][1] = 22472499736345367;
-        coeff[2][5][0][2] = 5698637743850064;
-        coeff[2][5][0][3] = 21300661132716363;
-        coeff[2][5][0][4] = 21929049149954008;
-        coeff[2][5][0][5] = 23430044241153146;
-        coeff[2][5][0][6] = 1829881462546425;
-
-        coeff[2][5][1][0] = 0;
-        coeff[2][5][1][1] = 0;
-        coeff[2][5][1][2] = 0;
-        coeff[2][5][1][3] = 0;
-        coeff[2][5][1][4] = 0;
-        coeff[2][5][1][5] = 0;
-        coeff[2][5][1][6] = 0;
-
-        coeff[3][0][0][0] = 1;
-        coeff[3][0][0][1] = 0;
-        coeff[3][0][0][2] = 0;
-        coeff[3][0][0][3] = 0;
-        coeff[3][0][0][4] = 0;
-        coeff[3][0][0][5] = 0;
-        coeff[3][0][0][6] = 0;
-
-        coeff[3][0][1][0] = 0;
-        coeff[3][0][1][1] = 0;
-        coeff[3][0][1][2] = 0;
-        coeff[3][0][1][3] = 0;
-        coeff[3][0][1][4] = 0;
-        coeff[3][0][1][5] = 0;
-        coeff[3][0][1][6] = 0;
-
-        coeff[3][1][0][0] = 31097504852074146;
-        coeff[3][1][0][1] = 21847832108733923;
-        coeff[3][1][0][2] = 11215546103677201;
-        coeff[3][1][0][3] = 1564033941097252;
-        coeff[3][1][0][4] = 9796175148277139;
-        coeff[3][1][0][5] = 23041766052141807;
-        coeff[3][1][0][6] = 1359550313685033;
-
-        coeff[3][1][1][0] = 4649817190157321;
-        coeff[3][1][1][1] = 14178090100713872;
-        coeff[3][1][1][2] = 25898210532243870;
-        coeff[3][1][1][3] = 6361890036890480;
-        coeff[3][1][1][4] = 6755281389607612;
-        coeff[3][1][1][5] = 401348527762810;
-        coeff[3][1][1][6] = 470331148861392;
-
-        coeff[3][2][0][0] = 0;
-        coeff[3][2][0][1] = 0;
-        coeff[3][2][0][2] = 0;
-        coeff[3][2][0][3] = 0;
-        coeff[3][2][0][4] = 0;
-        coeff[3][2][0][5] = 0;
-        coeff[3][2][0][6] = 0;
-
-        coeff[3][2][1][0] = 1;
-        coeff[3][2][1][1] = 0;
-        coeff[3][2][1][2] = 0;
-        coeff[3][2][1][3] = 0;
-        coeff[3][2][1][4] = 0;
-        coeff[3][2][1][5] = 0;
-        coeff[3][2][1][6] = 0;
-
-        coeff[3][3][0][0] = 31097504852074146;
-        coeff[3][3][0][1] = 21847832108733923;
-        coeff[3][3][0][2] = 11215546103677201;
-        coeff[3][3][0][3] = 1564033941097252;
-        coeff[3][3][0][4] = 9796175148277139;
-        coeff[3][3][0][5] = 23041766052141807;
-        coeff[3][3][0][6] = 1359550313685033;
-
-        coeff[3][3][1][0] = 31097504852074146;
-        coeff[3][3][1][1] = 21847832108733923;
-        coeff[3][3][1][2] = 11215546103677201;
-        coeff[3][3][1][3] = 1564033941097252;
-        coeff[3][3][1][4] = 9796175148277139;
-        coeff[3][3][1][5] = 23041766052141807;
-        coeff[3][3][1][6] = 1359550313685033;
-
-        coeff[3][4][0][0] = 35747322042231466;
-        coeff[3][4][0][1] = 36025922209447795;
-        coeff[3][4][0][2] = 1084959616957103;
-        coeff[3][4][0][3] = 7925923977987733;
-        coeff[3][4][0][4] = 16551456537884751;
-        coeff[3][4][0][5] = 23443114579904617;
-        coeff[3][4][0][6] = 1829881462546425;
-
-        coeff[3][4][1][0] = 0;
-        coeff[3][4][1][1] = 0;
-        coeff[3][4][1][2] = 0;
-        coeff[3][4][1][3] = 0;
-        coeff[3][4][1][4] = 0;
-        coeff[3][4][1][5] = 0;
-        coeff[3][4][1][6] = 0;
-
-        coeff[3][5][0][0] = 4649817190157321;
-        coeff[3][5][0][1] = 14178090100713872;
-        coeff[3][5][0][2] = 25898210532243870;
-        coeff[3][5][0][3] = 6361890036890480;
-        coeff[3][5][0][4] = 6755281389607612;
-        coeff[3][5][0][5] = 401348527762810;
-        coeff[3][5][0][6] = 470331148861392;
-
-        coeff[3][5][1][0] = 31097504852074146;
-        coeff[3][5][1][1] = 21847832108733923;
-        coeff[3][5][1][2] = 11215546103677201;
-        coeff[3][5][1][3] = 1564033941097252;
-        coeff[3][5][1][4] = 9796175148277139;
-        coeff[3][5][1][5] = 23041766052141807;
-        coeff[3][5][1][6] = 1359550313685033;
-
-        coeff[4][0][0][0] = 1;
-        coeff[4][0][0][1] = 0;
-        coeff[4][0][0][2] = 0;
-        coeff[4][0][0][3] = 0;
-        coeff[4][0][0][4] = 0;
-        coeff[4][0][0][5] = 0;
-        coeff[4][0][0][6] = 0;
-
-        coeff[4][0][1][0] = 0;
-        coeff[4][0][1][1] = 0;
-        coeff[4][0][1][2] = 0;
-        coeff[4][0][1][3] = 0;
-        coeff[4][0][1][4] = 0;
-        coeff[4][0][1][5] = 0;
-        coeff[4][0][1][6] = 0;
-
-        coeff[4][1][0][0] = 562949953355774;
-        coeff[4][1][0][1] = 13553422473102428;
-        coeff[4][1][0][2] = 31415118892071007;
-        coeff[4][1][0][3] = 22654059864235337;
-        coeff[4][1][0][4] = 30651204406894710;
-        coeff[4][1][0][5] = 13070338751470;
-        coeff[4][1][0][6] = 0;
-
-        coeff[4][1][1][0] = 0;
-        coeff[4][1][1][1] = 0;
-        coeff[4][1][1][2] = 0;
-        coeff[4][1][1][3] = 0;
-        coeff[4][1][1][4] = 0;
-        coeff[4][1][1][5] = 0;
-        coeff[4][1][1][6] = 0;
-
-        coeff[4][2][0][0] = 35184372088875692;
-        coeff[4][2][0][1] = 22472499736345367;
-        coeff[4][2][0][2] = 5698637743850064;
-        coeff[4][2][0][3] = 21300661132716363;
-        coeff[4][2][0][4] = 21929049149954008;
-        coeff[4][2][0][5] = 23430044241153146;
-        coeff[4][2][0][6] = 1829881462546425;
-
-        coeff[4][2][1][0] = 0;
-        coeff[4][2][1][1] = 0;
-        coeff[4][2][1][2] = 0;
-        coeff[4][2][1][3] = 0;
-        coeff[4][2][1][4] = 0;
-        coeff[4][2][1][5] = 0;
-        coeff[4][2][1][6] = 0;
-
-        coeff[4][3][0][0] = 1;
-        coeff[4][3][0][1] = 0;
-        coeff[4][3][0][2] = 0;
-        coeff[4][3][0][3] = 0;
-        coeff[4][3][0][4] = 0;
-        coeff[4][3][0][5] = 0;
-        coeff[4][3][0][6] = 0;
-
-        coeff[4][3][1][0] = 0;
-        coeff[4][3][1][1] = 0;
-        coeff[4][3][1][2] = 0;
-        coeff[4][3][1][3] = 0;
-        coeff[4][3][1][4] = 0;
-        coeff[4][3][1][5] = 0;
-        coeff[4][3][1][6] = 0;
-
-        coeff[4][4][0][0] = 562949953355774;
-        coeff[4][4][0][1] = 13553422473102428;
-        coeff[4][4][0][2] = 31415118892071007;
-        coeff[4][4][0][3] = 22654059864235337;
-        coeff[4][4][0][4] = 30651204406894710;
-        coeff[4][4][0][5] = 13070338751470;
-        coeff[4][4][0][6] = 0;
-
-        coeff[4][4][1][0] = 0;
-        coeff[4][4][1][1] = 0;
-        coeff[4][4][1][2] = 0;
-        coeff[4][4][1][3] = 0;
-        coeff[4][4][1][4] = 0;
-        coeff[4][4][1][5] = 0;
-        coeff[4][4][1][6] = 0;
-
-        coeff[4][5][0][0] = 35184372088875692;
-        coeff[4][5][0][1] = 22472499736345367;
-        coeff[4][5][0][2] = 5698637743850064;
-        coeff[4][5][0][3] = 21300661132716363;
-        coeff[4][5][0][4] = 21929049149954008;
-        coeff[4][5][0][5] = 23430044241153146;
-        coeff[4][5][0][6] = 1829881462546425;
-
-        coeff[4][5][1][0] = 0;
-        coeff[4][5][1][1] = 0;
-        coeff[4][5][1][2] = 0;
-        coeff[4][5][1][3] = 0;
-        coeff[4][5][1][4] = 0;
-        coeff[4][5][1][5] = 0;
-        coeff[4][5][1][6] = 0;
-
-        coeff[5][0][0][0] = 1;
-        coeff[5][0][0][1] = 0;
-        coeff[5][0][0][2] = 0;
-        coeff[5][0][0][3] = 0;
-        coeff[5][0][0][4] = 0;
-        coeff[5][0][0][5] = 0;
-        coeff[5][0][0][6] = 0;
-
-        coeff[5][0][1][0] = 0;
-        coeff[5][0][1][1] = 0;
-        coeff[5][0][1][2] = 0;
-        coeff[5][0][1][3] = 0;
-        coeff[5][0][1][4] = 0;
-        coeff[5][0][1][5] = 0;
-        coeff[5][0][1][6] = 0;
-
-        coeff[5][1][0][0] = 28716041818876309;
-        coeff[5][1][0][1] = 880810432502333;
-        coeff[5][1][0][2] = 21849854820311495;
-        coeff[5][1][0][3] = 16831420749721498;
-        coeff[5][1][0][4] = 8102400203380238;
-        coeff[5][1][0][5] = 24819801933832019;
-        coeff[5][1][0][6] = 1428886299480417;
-
-        coeff[5][1][1][0] = 7031280223355158;
-        coeff[5][1][1][1] = 35145111776945462;
-        coeff[5][1][1][2] = 15263901815609576;
-        coeff[5][1][1][3] = 27123300247230202;
-        coeff[5][1][1][4] = 8449056334504512;
-        coeff[5][1][1][5] = 34652109665036566;
-        coeff[5][1][1][6] = 400995163066007;
-
-        coeff[5][2][0][0] = 0;
-        coeff[5][2][0][1] = 0;
-        coeff[5][2][0][2] = 0;
-        coeff[5][2][0][3] = 0;
-        coeff[5][2][0][4] = 0;
-        coeff[5][2][0][5] = 0;
-        coeff[5][2][0][6] = 0;
-
-        coeff[5][2][1][0] = 562949953355774;
-        coeff[5][2][1][1] = 13553422473102428;
-        coeff[5][2][1][2] = 31415118892071007;
-        coeff[5][2][1][3] = 22654059864235337;
-        coeff[5][2][1][4] = 30651204406894710;
-        coeff[5][2][1][5] = 13070338751470;
-        coeff[5][2][1][6] = 0;
-
-        coeff[5][3][0][0] = 4649817190157321;
-        coeff[5][3][0][1] = 14178090100713872;
-        coeff[5][3][0][2] = 25898210532243870;
-        coeff[5][3][0][3] = 6361890036890480;
-        coeff[5][3][0][4] = 6755281389607612;
-        coeff[5][3][0][5] = 401348527762810;
-        coeff[5][3][0][6] = 470331148861392;
-
-        coeff[5][3][1][0] = 4649817190157321;
-        coeff[5][3][1][1] = 14178090100713872;
-        coeff[5][3][1][2] = 25898210532243870;
-        coeff[5][3][1][3] = 6361890036890480;
-        coeff[5][3][1][4] = 6755281389607612;
-        coeff[5][3][1][5] = 401348527762810;
-        coeff[5][3][1][6] = 470331148861392;
-
-        coeff[5][4][0][0] = 562949953355775;
-        coeff[5][4][0][1] = 13553422473102428;
-        coeff[5][4][0][2] = 31415118892071007;
-        coeff[5][4][0][3] = 22654059864235337;
-        coeff[5][4][0][4] = 30651204406894710;
-        coeff[5][4][0][5] = 13070338751470;
-        coeff[5][4][0][6] = 0;
-
-        coeff[5][4][1][0] = 0;
-        coeff[5][4][1][1] = 0;
-        coeff[5][4][1][2] = 0;
-        coeff[5][4][1][3] = 0;
-        coeff[5][4][1][4] = 0;
-        coeff[5][4][1][5] = 0;
-        coeff[5][4][1][6] = 0;
-
-        coeff[5][5][0][0] = 33647333985766131;
-        coeff[5][5][0][1] = 15061775342732377;
-        coeff[5][5][0][2] = 10634308716634293;
-        coeff[5][5][0][3] = 15267386808624246;
-        coeff[5][5][0][4] = 34335022074067067;
-        coeff[5][5][0][5] = 1778035881690211;
-        coeff[5][5][0][6] = 69335985795384;
-
-        coeff[5][5][1][0] = 2099988056465336;
-        coeff[5][5][1][1] = 20964146866715418;
-        coeff[5][5][1][2] = 26479447919286778;
-        coeff[5][5][1][3] = 28687334188327454;
-        coeff[5][5][1][4] = 18245231482781651;
-        coeff[5][5][1][5] = 21665078698214405;
-        coeff[5][5][1][6] = 1760545476751041;
-
-        coeff[6][0][0][0] = 1;
-        coeff[6][0][0][1] = 0;
-        coeff[6][0][0][2] = 0;
-        coeff[6][0][0][3] = 0;
-        coeff[6][0][0][4] = 0;
-        coeff[6][0][0][5] = 0;
-        coeff[6][0][0][6] = 0;
-
-        coeff[6][0][1][0] = 0;
-        coeff[6][0][1][1] = 0;
-        coeff[6][0][1][2] = 0;
-        coeff[6][0][1][3] = 0;
-        coeff[6][0][1][4] = 0;
-        coeff[6][0][1][5] = 0;
-        coeff[6][0][1][6] = 0;
-
-        coeff[6][1][0][0] = 35747322042231466;
-        coeff[6][1][0][1] = 36025922209447795;
-        coeff[6][1][0][2] = 1084959616957103;
-        coeff[6][1][0][3] = 7925923977987733;
-        coeff[6][1][0][4] = 16551456537884751;
-        coeff[6][1][0][5] = 23443114579904617;
-        coeff[6][1][0][6] = 1829881462546425;
-
-        coeff[6][1][1][0] = 0;
-        coeff[6][1][1][1] = 0;
-        coeff[6][1][1][2] = 0;
-        coeff[6][1][1][3] = 0;
-        coeff[6][1][1][4] = 0;
-        coeff[6][1][1][5] = 0;
-        coeff[6][1][1][6] = 0;
-
-        coeff[6][2][0][0] = 1;
-        coeff[6][2][0][1] = 0;
-        coeff[6][2][0][2] = 0;
-        coeff[6][2][0][3] = 0;
-        coeff[6][2][0][4] = 0;
-        coeff[6][2][0][5] = 0;
-        coeff[6][2][0][6] = 0;
-
-        coeff[6][2][1][0] = 0;
-        coeff[6][2][1][1] = 0;
-        coeff[6][2][1][2] = 0;
-        coeff[6][2][1][3] = 0;
-        coeff[6][2][1][4] = 0;
-        coeff[6][2][1][5] = 0;
-        coeff[6][2][1][6] = 0;
-
-        coeff[6][3][0][0] = 35747322042231466;
-        coeff[6][3][0][1] = 36025922209447795;
-        coeff[6][3][0][2] = 1084959616957103;
-        coeff[6][3][0][3] = 7925923977987733;
-        coeff[6][3][0][4] = 16551456537884751;
-        coeff[6][3][0][5] = 23443114579904617;
-        coeff[6][3][0][6] = 1829881462546425;
-
-        coeff[6][3][1][0] = 0;
-        coeff[6][3][1][1] = 0;
-        coeff[6][3][1][2] = 0;
-        coeff[6][3][1][3] = 0;
-        coeff[6][3][1][4] = 0;
-        coeff[6][3][1][5] = 0;
-        coeff[6][3][1][6] = 0;
-
-        coeff[6][4][0][0] = 1;
-        coeff[6][4][0][1] = 0;
-        coeff[6][4][0][2] = 0;
-        coeff[6][4][0][3] = 0;
-        coeff[6][4][0][4] = 0;
-        coeff[6][4][0][5] = 0;
-        coeff[6][4][0][6] = 0;
-
-        coeff[6][4][1][0] = 0;
-        coeff[6][4][1][1] = 0;
-        coeff[6][4][1][2] = 0;
-        coeff[6][4][1][3] = 0;
-        coeff[6][4][1][4] = 0;
-        coeff[6][4][1][5] = 0;
-        coeff[6][4][1][6] = 0;
-
-        coeff[6][5][0][0] = 35747322042231466;
-        coeff[6][5][0][1] = 36025922209447795;
-        coeff[6][5][0][2] = 1084959616957103;
-        coeff[6][5][0][3] = 7925923977987733;
-        coeff[6][5][0][4] = 16551456537884751;
-        coeff[6][5][0][5] = 23443114579904617;
-        coeff[6][5][0][6] = 1829881462546425;
-
-        coeff[6][5][1][0] = 0;
-        coeff[6][5][1][1] = 0;
-        coeff[6][5][1][2] = 0;
-        coeff[6][5][1][3] = 0;
-        coeff[6][5][1][4] = 0;
-        coeff[6][5][1][5] = 0;
-        coeff[6][5][1][6] = 0;
-
-        coeff[7][0][0][0] = 1;
-        coeff[7][0][0][1] = 0;
-        coeff[7][0][0][2] = 0;
-        coeff[7][0][0][3] = 0;
-        coeff[7][0][0][4] = 0;
-        coeff[7][0][0][5] = 0;
-        coeff[7][0][0][6] = 0;
-
-        coeff[7][0][1][0] = 0;
-        coeff[7][0][1][1] = 0;
-        coeff[7][0][1][2] = 0;
-        coeff[7][0][1][3] = 0;
-        coeff[7][0][1][4] = 0;
-        coeff[7][0][1][5] = 0;
-        coeff[7][0][1][6] = 0;
-
-        coeff[7][1][0][0] = 33647333985766131;
-        coeff[7][1][0][1] = 15061775342732377;
-        coeff[7][1][0][2] = 10634308716634293;
-        coeff[7][1][0][3] = 15267386808624246;
-        coeff[7][1][0][4] = 34335022074067067;
-        coeff[7][1][0][5] = 1778035881690211;
-        coeff[7][1][0][6] = 69335985795384;
-
-        coeff[7][1][1][0] = 2099988056465336;
-        coeff[7][1][1][1] = 20964146866715418;
-        coeff[7][1][1][2] = 26479447919286778;
-        coeff[7][1][1][3] = 28687334188327454;
-        coeff[7][1][1][4] = 18245231482781651;
-        coeff[7][1][1][5] = 21665078698214405;
-        coeff[7][1][1][6] = 1760545476751041;
-
-        coeff[7][2][0][0] = 0;
-        coeff[7][2][0][1] = 0;
-        coeff[7][2][0][2] = 0;
-        coeff[7][2][0][3] = 0;
-        coeff[7][2][0][4] = 0;
-        coeff[7][2][0][5] = 0;
-        coeff[7][2][0][6] = 0;
-
-        coeff[7][2][1][0] = 35184372088875692;
-        coeff[7][2][1][1] = 22472499736345367;
-        coeff[7][2][1][2] = 5698637743850064;
-        coeff[7][2][1][3] = 21300661132716363;
-        coeff[7][2][1][4] = 21929049149954008;
-        coeff[7][2][1][5] = 23430044241153146;
-        coeff[7][2][1][6] = 1829881462546425;
-
-        coeff[7][3][0][0] = 31097504852074146;
-        coeff[7][3][0][1] = 21847832108733923;
-        coeff[7][3][0][2] = 11215546103677201;
-        coeff[7][3][0][3] = 1564033941097252;
-        coeff[7][3][0][4] = 9796175148277139;
-        coeff[7][3][0][5] = 23041766052141807;
-        coeff[7][3][0][6] = 1359550313685033;
-
-        coeff[7][3][1][0] = 31097504852074146;
-        coeff[7][3][1][1] = 21847832108733923;
-        coeff[7][3][1][2] = 11215546103677201;
-        coeff[7][3][1][3] = 1564033941097252;
-        coeff[7][3][1][4] = 9796175148277139;
-        coeff[7][3][1][5] = 23041766052141807;
-        coeff[7][3][1][6] = 1359550313685033;
-
-        coeff[7][4][0][0] = 35184372088875693;
-        coeff[7][4][0][1] = 22472499736345367;
-        coeff[7][4][0][2] = 5698637743850064;
-        coeff[7][4][0][3] = 21300661132716363;
-        coeff[7][4][0][4] = 21929049149954008;
-        coeff[7][4][0][5] = 23430044241153146;
-        coeff[7][4][0][6] = 1829881462546425;
-
-        coeff[7][4][1][0] = 0;
-        coeff[7][4][1][1] = 0;
-        coeff[7][4][1][2] = 0;
-        coeff[7][4][1][3] = 0;
-        coeff[7][4][1][4] = 0;
-        coeff[7][4][1][5] = 0;
-        coeff[7][4][1][6] = 0;
-
-        coeff[7][5][0][0] = 28716041818876309;
-        coeff[7][5][0][1] = 880810432502333;
-        coeff[7][5][0][2] = 21849854820311495;
-        coeff[7][5][0][3] = 16831420749721498;
-        coeff[7][5][0][4] = 8102400203380238;
-        coeff[7][5][0][5] = 24819801933832019;
-        coeff[7][5][0][6] = 1428886299480417;
-
-        coeff[7][5][1][0] = 7031280223355158;
-        coeff[7][5][1][1] = 35145111776945462;
-        coeff[7][5][1][2] = 15263901815609576;
-        coeff[7][5][1][3] = 27123300247230202;
-        coeff[7][5][1][4] = 8449056334504512;
-        coeff[7][5][1][5] = 34652109665036566;
-        coeff[7][5][1][6] = 400995163066007;
-
-        coeff[8][0][0][0] = 1;
-        coeff[8][0][0][1] = 0;
-        coeff[8][0][0][2] = 0;
-        coeff[8][0][0][3] = 0;
-        coeff[8][0][0][4] = 0;
-        coeff[8][0][0][5] = 0;
-        coeff[8][0][0][6] = 0;
-
-        coeff[8][0][1][0] = 0;
-        coeff[8][0][1][1] = 0;
-        coeff[8][0][1][2] = 0;
-        coeff[8][0][1][3] = 0;
-        coeff[8][0][1][4] = 0;
-        coeff[8][0][1][5] = 0;
-        coeff[8][0][1][6] = 0;
-
-        coeff[8][1][0][0] = 35184372088875692;
-        coeff[8][1][0][1] = 22472499736345367;
-        coeff[8][1][0][2] = 5698637743850064;
-        coeff[8][1][0][3] = 21300661132716363;
-        coeff[8][1][0][4] = 21929049149954008;
-        coeff[8][1][0][5] = 23430044241153146;
-        coeff[8][1][0][6] = 1829881462546425;
-
-        coeff[8][1][1][0] = 0;
-        coeff[8][1][1][1] = 0;
-        coeff[8][1][1][2] = 0;
-        coeff[8][1][1][3] = 0;
-        coeff[8][1][1][4] = 0;
-        coeff[8][1][1][5] = 0;
-        coeff[8][1][1][6] = 0;
-
-        coeff[8][2][0][0] = 562949953355774;
-        coeff[8][2][0][1] = 13553422473102428;
-        coeff[8][2][0][2] = 31415118892071007;
-        coeff[8][2][0][3] = 22654059864235337;
-        coeff[8][2][0][4] = 30651204406894710;
-        coeff[8][2][0][5] = 13070338751470;
-        coeff[8][2][0][6] = 0;
-
-        coeff[8][2][1][0] = 0;
-        coeff[8][2][1][1] = 0;
-        coeff[8][2][1][2] = 0;
-        coeff[8][2][1][3] = 0;
-        coeff[8][2][1][4] = 0;
-        coeff[8][2][1][5] = 0;
-        coeff[8][2][1][6] = 0;
-
-        coeff[8][3][0][0] = 1;
-        coeff[8][3][0][1] = 0;
-        coeff[8][3][0][2] = 0;
-        coeff[8][3][0][3] = 0;
-        coeff[8][3][0][4] = 0;
-        coeff[8][3][0][5] = 0;
-        coeff[8][3][0][6] = 0;
-
-        coeff[8][3][1][0] = 0;
-        coeff[8][3][1][1] = 0;
-        coeff[8][3][1][2] = 0;
-        coeff[8][3][1][3] = 0;
-        coeff[8][3][1][4] = 0;
-        coeff[8][3][1][5] = 0;
-        coeff[8][3][1][6] = 0;
-
-        coeff[8][4][0][0] = 35184372088875692;
-        coeff[8][4][0][1] = 22472499736345367;
-        coeff[8][4][0][2] = 5698637743850064;
-        coeff[8][4][0][3] = 21300661132716363;
-        coeff[8][4][0][4] = 21929049149954008;
-        coeff[8][4][0][5] = 23430044241153146;
-        coeff[8][4][0][6] = 1829881462546425;
-
-        coeff[8][4][1][0] = 0;
-        coeff[8][4][1][1] = 0;
-        coeff[8][4][1][2] = 0;
-        coeff[8][4][1][3] = 0;
-        coeff[8][4][1][4] = 0;
-        coeff[8][4][1][5] = 0;
-        coeff[8][4][1][6] = 0;
-
-        coeff[8][5][0][0] = 562949953355774;
-        coeff[8][5][0][1] = 13553422473102428;
-        coeff[8][5][0][2] = 31415118892071007;
-        coeff[8][5][0][3] = 22654059864235337;
-        coeff[8][5][0][4] = 30651204406894710;
-        coeff[8][5][0][5] = 13070338751470;
-        coeff[8][5][0][6] = 0;
-
-        coeff[8][5][1][0] = 0;
-        coeff[8][5][1][1] = 0;
-        coeff[8][5][1][2] = 0;
-        coeff[8][5][1][3] = 0;
-        coeff[8][5][1][4] = 0;
-        coeff[8][5][1][5] = 0;
-        coeff[8][5][1][6] = 0;
-
-        coeff[9][0][0][0] = 1;
-        coeff[9][0][0][1] = 0;
-        coeff[9][0][0][2] = 0;
-        coeff[9][0][0][3] = 0;
-        coeff[9][0][0][4] = 0;
-        coeff[9][0][0][5] = 0;
-        coeff[9][0][0][6] = 0;
-
-        coeff[9][0][1][0] = 0;
-        coeff[9][0][1][1] = 0;
-        coeff[9][0][1][2] = 0;
-        coeff[9][0][1][3] = 0;
-        coeff[9][0][1][4] = 0;
-        coeff[9][0][1][5] = 0;
-        coeff[9][0][1][6] = 0;
-
-        coeff[9][1][0][0] = 4649817190157321;
-        coeff[9][1][0][1] = 14178090100713872;
-        coeff[9][1][0][2] = 25898210532243870;
-        coeff[9][1][0][3] = 6361890036890480;
-        coeff[9][1][0][4] = 6755281389607612;
-        coeff[9][1][0][5] = 401348527762810;
-        coeff[9][1][0][6] = 470331148861392;
-
-        coeff[9][1][1][0] = 31097504852074146;
-        coeff[9][1][1][1] = 21847832108733923;
-        coeff[9][1][1][2] = 11215546103677201;
-        coeff[9][1][1][3] = 1564033941097252;
-        coeff[9][1][1][4] = 9796175148277139;
-        coeff[9][1][1][5] = 23041766052141807;
-        coeff[9][1][1][6] = 1359550313685033;
-
-        coeff[9][2][0][0] = 0;
-        coeff[9][2][0][1] = 0;
-        coeff[9][2][0][2] = 0;
-        coeff[9][2][0][3] = 0;
-        coeff[9][2][0][4] = 0;
-        coeff[9][2][0][5] = 0;
-        coeff[9][2][0][6] = 0;
-
-        coeff[9][2][1][0] = 1;
-        coeff[9][2][1][1] = 0;
-        coeff[9][2][1][2] = 0;
-        coeff[9][2][1][3] = 0;
-        coeff[9][2][1][4] = 0;
-        coeff[9][2][1][5] = 0;
-        coeff[9][2][1][6] = 0;
-
-        coeff[9][3][0][0] = 4649817190157321;
-        coeff[9][3][0][1] = 14178090100713872;
-        coeff[9][3][0][2] = 25898210532243870;
-        coeff[9][3][0][3] = 6361890036890480;
-        coeff[9][3][0][4] = 6755281389607612;
-        coeff[9][3][0][5] = 401348527762810;
-        coeff[9][3][0][6] = 470331148861392;
-
-        coeff[9][3][1][0] = 4649817190157321;
-        coeff[9][3][1][1] = 14178090100713872;
-        coeff[9][3][1][2] = 25898210532243870;
-        coeff[9][3][1][3] = 6361890036890480;
-        coeff[9][3][1][4] = 6755281389607612;
-        coeff[9][3][1][5] = 401348527762810;
-        coeff[9][3][1][6] = 470331148861392;
-
-        coeff[9][4][0][0] = 35747322042231466;
-        coeff[9][4][0][1] = 36025922209447795;
-        coeff[9][4][0][2] = 1084959616957103;
-        coeff[9][4][0][3] = 7925923977987733;
-        coeff[9][4][0][4] = 16551456537884751;
-        coeff[9][4][0][5] = 23443114579904617;
-        coeff[9][4][0][6] = 1829881462546425;
-
-        coeff[9][4][1][0] = 0;
-        coeff[9][4][1][1] = 0;
-        coeff[9][4][1][2] = 0;
-        coeff[9][4][1][3] = 0;
-        coeff[9][4][1][4] = 0;
-        coeff[9][4][1][5] = 0;
-        coeff[9][4][1][6] = 0;
-
-        coeff[9][5][0][0] = 31097504852074146;
-        coeff[9][5][0][1] = 21847832108733923;
-        coeff[9][5][0][2] = 11215546103677201;
-        coeff[9][5][0][3] = 1564033941097252;
-        coeff[9][5][0][4] = 9796175148277139;
-        coeff[9][5][0][5] = 23041766052141807;
-        coeff[9][5][0][6] = 1359550313685033;
-
-        coeff[9][5][1][0] = 4649817190157321;
-        coeff[9][5][1][1] = 14178090100713872;
-        coeff[9][5][1][2] = 25898210532243870;
-        coeff[9][5][1][3] = 6361890036890480;
-        coeff[9][5][1][4] = 6755281389607612;
-        coeff[9][5][1][5] = 401348527762810;
-        coeff[9][5][1][6] = 470331148861392;
-
-        coeff[10][0][0][0] = 1;
-        coeff[10][0][0][1] = 0;
-        coeff[10][0][0][2] = 0;
-        coeff[10][0][0][3] = 0;
-        coeff[10][0][0][4] = 0;
-        coeff[10][0][0][5] = 0;
-        coeff[10][0][0][6] = 0;
-
-        coeff[10][0][1][0] = 0;
-        coeff[10][0][1][1] = 0;
-        coeff[10][0][1][2] = 0;
-        coeff[10][0][1][3] = 0;
-        coeff[10][0][1][4] = 0;
-        coeff[10][0][1][5] = 0;
-        coeff[10][0][1][6] = 0;
-
-        coeff[10][1][0][0] = 35184372088875693;
-        coeff[10][1][0][1] = 22472499736345367;
-        coeff[10][1][0][2] = 5698637743850064;
-        coeff[10][1][0][3] = 21300661132716363;
-        coeff[10][1][0][4] = 21929049149954008;
-        coeff[10][1][0][5] = 23430044241153146;
-        coeff[10][1][0][6] = 1829881462546425;
-
-        coeff[10][1][1][0] = 0;
-        coeff[10][1][1][1] = 0;
-        coeff[10][1][1][2] = 0;
-        coeff[10][1][1][3] = 0;
-        coeff[10][1][1][4] = 0;
-        coeff[10][1][1][5] = 0;
-        coeff[10][1][1][6] = 0;
-
-        coeff[10][2][0][0] = 35184372088875692;
-        coeff[10][2][0][1] = 22472499736345367;
-        coeff[10][2][0][2] = 5698637743850064;
-        coeff[10][2][0][3] = 21300661132716363;
-        coeff[10][2][0][4] = 21929049149954008;
-        coeff[10][2][0][5] = 23430044241153146;
-        coeff[10][2][0][6] = 1829881462546425;
-
-        coeff[10][2][1][0] = 0;
-        coeff[10][2][1][1] = 0;
-        coeff[10][2][1][2] = 0;
-        coeff[10][2][1][3] = 0;
-        coeff[10][2][1][4] = 0;
-        coeff[10][2][1][5] = 0;
-        coeff[10][2][1][6] = 0;
-
-        coeff[10][3][0][0] = 35747322042231466;
-        coeff[10][3][0][1] = 36025922209447795;
-        coeff[10][3][0][2] = 1084959616957103;
-        coeff[10][3][0][3] = 7925923977987733;
-        coeff[10][3][0][4] = 16551456537884751;
-        coeff[10][3][0][5] = 23443114579904617;
-        coeff[10][3][0][6] = 1829881462546425;
-
-        coeff[10][3][1][0] = 0;
-        coeff[10][3][1][1] = 0;
-        coeff[10][3][1][2] = 0;
-        coeff[10][3][1][3] = 0;
-        coeff[10][3][1][4] = 0;
-        coeff[10][3][1][5] = 0;
-        coeff[10][3][1][6] = 0;
-
-        coeff[10][4][0][0] = 562949953355774;
-        coeff[10][4][0][1] = 13553422473102428;
-        coeff[10][4][0][2] = 31415118892071007;
-        coeff[10][4][0][3] = 22654059864235337;
-        coeff[10][4][0][4] = 30651204406894710;
-        coeff[10][4][0][5] = 13070338751470;
-        coeff[10][4][0][6] = 0;
-
-        coeff[10][4][1][0] = 0;
-        coeff[10][4][1][1] = 0;
-        coeff[10][4][1][2] = 0;
-        coeff[10][4][1][3] = 0;
-        coeff[10][4][1][4] = 0;
-        coeff[10][4][1][5] = 0;
-        coeff[10][4][1][6] = 0;
-
-        coeff[10][5][0][0] = 562949953355775;
-        coeff[10][5][0][1] = 13553422473102428;
-        coeff[10][5][0][2] = 31415118892071007;
-        coeff[10][5][0][3] = 22654059864235337;
-        coeff[10][5][0][4] = 30651204406894710;
-        coeff[10][5][0][5] = 13070338751470;
-        coeff[10][5][0][6] = 0;
-
-        coeff[10][5][1][0] = 0;
-        coeff[10][5][1][1] = 0;
-        coeff[10][5][1][2] = 0;
-        coeff[10][5][1][3] = 0;
-        coeff[10][5][1][4] = 0;
-        coeff[10][5][1][5] = 0;
-        coeff[10][5][1][6] = 0;
-
-        coeff[11][0][0][0] = 1;
-        coeff[11][0][0][1] = 0;
-        coeff[11][0][0][2] = 0;
-        coeff[11][0][0][3] = 0;
-        coeff[11][0][0][4] = 0;
-        coeff[11][0][0][5] = 0;
-        coeff[11][0][0][6] = 0;
-
-        coeff[11][0][1][0] = 0;
-        coeff[11][0][1][1] = 0;
-        coeff[11][0][1][2] = 0;
-        coeff[11][0][1][3] = 0;
-        coeff[11][0][1][4] = 0;
-        coeff[11][0][1][5] = 0;
-        coeff[11][0][1][6] = 0;
-
-        coeff[11][1][0][0] = 7031280223355158;
-        coeff[11][1][0][1] = 35145111776945462;
-        coeff[11][1][0][2] = 15263901815609576;
-        coeff[11][1][0][3] = 27123300247230202;
-        coeff[11][1][0][4] = 8449056334504512;
-        coeff[11][1][0][5] = 34652109665036566;
-        coeff[11][1][0][6] = 400995163066007;
-
-        coeff[11][1][1][0] = 28716041818876309;
-        coeff[11][1][1][1] = 880810432502333;
-        coeff[11][1][1][2] = 21849854820311495;
-        coeff[11][1][1][3] = 16831420749721498;
-        coeff[11][1][1][4] = 8102400203380238;
-        coeff[11][1][1][5] = 24819801933832019;
-        coeff[11][1][1][6] = 1428886299480417;
-
-        coeff[11][2][0][0] = 0;
-        coeff[11][2][0][1] = 0;
-        coeff[11][2][0][2] = 0;
-        coeff[11][2][0][3] = 0;
-        coeff[11][2][0][4] = 0;
-        coeff[11][2][0][5] = 0;
-        coeff[11][2][0][6] = 0;
-
-        coeff[11][2][1][0] = 562949953355774;
-        coeff[11][2][1][1] = 13553422473102428;
-        coeff[11][2][1][2] = 31415118892071007;
-        coeff[11][2][1][3] = 22654059864235337;
-        coeff[11][2][1][4] = 30651204406894710;
-        coeff[11][2][1][5] = 13070338751470;
-        coeff[11][2][1][6] = 0;
-
-        coeff[11][3][0][0] = 31097504852074146;
-        coeff[11][3][0][1] = 21847832108733923;
-        coeff[11][3][0][2] = 11215546103677201;
-        coeff[11][3][0][3] = 1564033941097252;
-        coeff[11][3][0][4] = 9796175148277139;
-        coeff[11][3][0][5] = 23041766052141807;
-        coeff[11][3][0][6] = 1359550313685033;
-
-        coeff[11][3][1][0] = 31097504852074146;
-        coeff[11][3][1][1] = 21847832108733923;
-        coeff[11][3][1][2] = 11215546103677201;
-        coeff[11][3][1][3] = 1564033941097252;
-        coeff[11][3][1][4] = 9796175148277139;
-        coeff[11][3][1][5] = 23041766052141807;
-        coeff[11][3][1][6] = 1359550313685033;
-
-        coeff[11][4][0][0] = 562949953355775;
-        coeff[11][4][0][1] = 13553422473102428;
-        coeff[11][4][0][2] = 31415118892071007;
-        coeff[11][4][0][3] = 22654059864235337;
-        coeff[11][4][0][4] = 30651204406894710;
-        coeff[11][4][0][5] = 13070338751470;
-        coeff[11][4][0][6] = 0;
-
-        coeff[11][4][1][0] = 0;
-        coeff[11][4][1][1] = 0;
-        coeff[11][4][1][2] = 0;
-        coeff[11][4][1][3] = 0;
-        coeff[11][4][1][4] = 0;
-        coeff[11][4][1][5] = 0;
-        coeff[11][4][1][6] = 0;
-
-        coeff[11][5][0][0] = 2099988056465336;
-        coeff[11][5][0][1] = 20964146866715418;
-        coeff[11][5][0][2] = 26479447919286778;
-        coeff[11][5][0][3] = 28687334188327454;
-        coeff[11][5][0][4] = 18245231482781651;
-        coeff[11][5][0][5] = 21665078698214405;
-        coeff[11][5][0][6] = 1760545476751041;
-
-        coeff[11][5][1][0] = 33647333985766131;
-        coeff[11][5][1][1] = 15061775342732377;
-        coeff[11][5][1][2] = 10634308716634293;
-        coeff[11][5][1][3] = 15267386808624246;
-        coeff[11][5][1][4] = 34335022074067067;
-        coeff[11][5][1][5] = 1778035881690211;
-        coeff[11][5][1][6] = 69335985795384;
-    }
-    return coeff;
+// coeff[j][i] represents an element in F_q^2
+// F_q^12 = F_q^2[w] / (w^6 - (u+1))
+// Apply Frobenius j times to w^i: (w^i)^(q^j) = coeff[j][i] * w^i
+template<std::size_t n, std::size_t k>
+constexpr const auto &get_Fp12_frobenius() {
+    return ethereum::consensus_proof::native::bls12_381_registers<n, k>::fp12_frobenius;
 }
@@ -32,7 +32,7 @@ void OptSimpleSWU2() {
     output out[2][2][k];
 //signal output isInfinity; optimized simple SWU should never return point at infinity, exceptional case still returns a normal point
 
-    var p[50] = get_BLS12_381_prime(n, k);
+    const auto &p = get_BLS12_381_prime<n, k>();
 
     var
     a[2] = [0, 240];
@@ -177,7 +177,7 @@ since division is cheap in circom
     var sqrt_candidate[2][50] = find_Fp2_exp(n, k, gX0.out, p, c2[0]);
 // if gX0 is a square, square root must be sqrt_candidate * (8th-root of unity)
 // -1 is a square in Fp2 (because p^2 - 1 is even) so we only need to check half of the 8th roots of unity
-    var roots[4][2][50] = get_roots_of_unity(n, k);
+    const auto &roots = get_roots_of_unity<n, k>();
     var sqrt_witness[2][2][50];
     for (var i = 0; i < 2; i++) {
         for (var j = 0; j < 2; j++) {
@@ -199,7 +199,7 @@ since division is cheap in circom
     isSquare * (1 - isSquare) == = 0;
 
     var is_square1 = 0;
-    var etas[4][2][50] = get_etas(n, k);
+    const auto &etas = get_etas<n, k>();
 // find square root of gX1
 // square root of gX1 must be = sqrt_candidate * t^3 * eta
 // for one of four precomputed values of eta
@@ -309,10 +309,10 @@ out[2][2][k];
 signal output
 isInfinity;
 
-var p[50] = get_BLS12_381_prime(n, k);
+const auto &p = get_BLS12_381_prime<n, k>();
 
 // load coefficients of the isogeny (precomputed)
-var coeffs[4][4][2][50] = get_iso3_coeffs(n, k);
+const auto &coeffs = get_iso3_coeffs<n, k>();
 
 // x = x_num / x_den
 // y = y' * y_num / y_den
@@ -719,13 +719,13 @@ out[2][2][k];
 signal output
 isInfinity;
 
-var p[50] = get_BLS12_381_prime(n, k);
+const auto &p = get_BLS12_381_prime<n, k>();
 var x_abs = BLS12381_PARAMETER; // this is abs(x). remember x is negative!
 var a[2] =
 [0,0];
 var b[2] =
 [4,4];
-var dummy_point[2][2][50] = get_generator_G2(n, k);
+const auto &dummy_point = get_generator_G2<n, k>();
 
 // Output: [|x|^2 + |x| - 1]*P + [-|x|-1]*psi(P) + psi2(2*P)
 //       = |x| * (|x|*P + P - psi(P)) - P -psi(P) + psi2(2*P)
@@ -909,7 +909,7 @@ out[2][2][k];
 signal output
 isInfinity;
 
-var p[50] = get_BLS12_381_prime(n, k);
+const auto &p = get_BLS12_381_prime<n, k>();
 
 component Qp[2];
 for(
@@ -999,7 +999,7 @@ template SubgroupCheckG2(n, k
 signal input
 in[2][2][k];
 
-var p[50] = get_BLS12_381_prime(n, k);
+const auto &p = get_BLS12_381_prime<n, k>();
 var x_abs = BLS12381_PARAMETER;
 
 component is_on_curve = PointOnCurveFp2(n, k,[0, 0],
@@ -1070,7 +1070,7 @@ template SubgroupCheckG1(n, k
 signal input
 in[2][k];
 
-var p[50] = get_BLS12_381_prime(n, k);
+const auto &p = get_BLS12_381_prime<n, k>();
 var x_abs = BLS12381_PARAMETER;
 var b = 4;
 
@@ -1154,7 +1154,7 @@ template PointOnBLSCurveNoCheck(n, k
 ){
 signal input
 in[2][k];
-var p[50] = get_BLS12_381_prime(n, k);
+const auto &p = get_BLS12_381_prime<n, k>();
 var x_abs = BLS12381_PARAMETER;
 var b = 4;
 component is_on_curve = PointOnCurve(n, k, 0, b, p);
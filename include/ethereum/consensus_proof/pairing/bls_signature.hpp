@@ -13,9 +13,9 @@ std::size_t CoreVerifyPubkeyG1NoCheck(const std::array<std::array<std::size_t, 2
                                       const std::array<std::array<std::array<std::size_t, 2>, 2>, k> &Hm) {
     std::size_t out;
 
-    std::size_t q[50] = get_BLS12_381_prime(n, k);
+    const auto &q = get_BLS12_381_prime<n, k>();
     std::size_t x = BLS12381_PARAMETER;
-    std::size_t g1[2][50] = get_generator_G1(n, k);
+    const auto &g1 = get_generator_G1<n, k>();
 
     signal neg_s[2][2][k];
     component neg[2];
@@ -30,7 +30,8 @@ std::size_t CoreVerifyPubkeyG1NoCheck(const std::array<std::array<std::size_t, 2
         }
     }
 
-    component miller = MillerLoopFp2Two(n, k,[4, 4], x, q);
+    // the generator of G1 is a constant, its line evaluations are linear
+    component miller = MillerLoopFp2TwoFixedQ0(n, k,[4, 4], x, q, g1);
     for (std::size_t i = 0; i < 2; i++) {
         for (std::size_t j = 0; j < 2; j++) {
             for (std::size_t idx = 0; idx < k; idx++) {
@@ -41,8 +42,7 @@ std::size_t CoreVerifyPubkeyG1NoCheck(const std::array<std::array<std::size_t, 2
     }
     for (std::size_t i = 0; i < 2; i++) {
         for (std::size_t idx = 0; idx < k; idx++) {
-            miller.Q[0][i][idx] = g1[i][idx];
-            miller.Q[1][i][idx] = pubkey[i][idx];
+            miller.Q[i][idx] = pubkey[i][idx];
         }
     }
 
@@ -86,7 +86,7 @@ void CoreVerifyPubkeyG1() {
     signal
     input hash[2][2][k];
 
-    std::size_t q[50] = get_BLS12_381_prime(n, k);
+    const auto &q = get_BLS12_381_prime<n, k>();
 
     component lt[10];
     // check all len k input arrays are correctly formatted bigints < q (BigLessThan calls Num2Bits)
@@ -201,9 +201,11 @@ function find_Fp2_diff(n, k, a, b, p){
 // k * n <= 400
 // p is a prime
 // computes a^e in Fp2
+// Sliding window of 5 bits as in mod_exp: for e = (p^2 + 7) / 16 of OptSimpleSWU2 about 140
+// multiplications instead of 365, the squarings are unchanged
 function find_Fp2_exp(n, k, a, p, e){
     std::size_t eBits[800]; // length is (2k-1) * n
-    std::size_t bitLength;
+    std::size_t bitLength = 0;
     for (int i = 0; i < 2*k; i++) {
         for (std::size_t j = 0; j < n; j++) {
             eBits[j + n * i] = (e[i] >> j) & 1;
@@ -218,15 +220,43 @@ function find_Fp2_exp(n, k, a, p, e){
         out[1][i] = 0;
     }
     out[0][0] = 1;
+    if (bitLength == 0)
+        return out;
 
-    // repeated squaring
-    for(std::size_t i = bitLength-1; i >= 0; i--) {
-        // multiply by a if bit is 0
-        if (eBits[i] == 1)
-            out = find_Fp2_product(n, k, out, a, p);
-        // square, unless we're at the end
-        if (i > 0)
+    // oddPowers[i] = a^{2i + 1}
+    std::size_t oddPowers[16][2][50];
+    std::size_t aSq[2][50] = find_Fp2_product(n, k, a, a, p);
+    oddPowers[0] = a;
+    for(std::size_t i = 1; i < 16; i++)
+        oddPowers[i] = find_Fp2_product(n, k, oddPowers[i-1], aSq, p);
+
+    // bits [0, i) of e are left
+    std::size_t started = 0;
+    for(std::size_t i = bitLength; i > 0;) {
+        if (eBits[i-1] == 0) {
             out = find_Fp2_product(n, k, out, out, p);
+            i--;
+        } else {
+            // window [j, i) of at most 5 bits, ending in a set bit
+            std::size_t j = 0;
+            if (i > 5)
+                j = i - 5;
+            while (eBits[j] == 0)
+                j++;
+            std::size_t digit = 0;
+            for(std::size_t b = i; b > j; b--) {
+                digit = 2 * digit + eBits[b-1];
+                if (started == 1)
+                    out = find_Fp2_product(n, k, out, out, p);
+            }
+            if (started == 0) {
+                out = oddPowers[digit / 2];
+                started = 1;
+            } else {
+                out = find_Fp2_product(n, k, out, oddPowers[digit / 2], p);
+            }
+            i = j;
+        }
     }
     return out;
 }
@@ -11,8 +11,8 @@ template<std::size_t n, std::size_t k, std::size_t power> void Fp12FrobeniusMap(
     signal input in[6][2][k];
     signal output out[6][2][k];
 
-    std::size_t p[50] = get_BLS12_381_prime(n, k);
-    std::size_t FP12_FROBENIUS_COEFFICIENTS[12][6][2][20] = get_Fp12_frobenius(n, k);
+    const auto &p = get_BLS12_381_prime<n, k>();
+    const auto &FP12_FROBENIUS_COEFFICIENTS = get_Fp12_frobenius<n, k>();
     std::size_t pow = power % 12;
  
     component in_frob[6]; 
@@ -270,6 +270,89 @@ template SignedFp12MultiplyNoCarry(n, k, m_out){
         out[i][j][idx] <== mult.out[i][j][idx]; 
 }
 
+// Karatsuba over u version of SignedFp12MultiplyNoCarryUnequal: with
+//     t0 = a0 b0, t1 = a1 b1, t2 = (a0 + a1)(b0 + b1)
+// ab = (t0 - t1) + (t2 - t0 - t1) u, three 2D products instead of four
+// The real and imaginary parts are
+//     * length 6 vectors with ka+kb-1 registers abs val < B_a * B_b * 6 * min(ka, kb) * (8 + 6 XI0)
+// m_out is the expected max number of bits in the output registers
+template SignedFp12MultiplyNoCarryKaratsubaUnequal(n, ka, kb, m_out){
+    std::size_t l = 6;
+    std::size_t XI0 = 1;
+    signal input a[l][2][ka];
+    signal input b[l][2][kb];
+    signal output out[l][2][ka + kb -1];
+
+    component t0 = BigMultShortLong2DUnequal(n, ka, kb, l, l);
+    component t1 = BigMultShortLong2DUnequal(n, ka, kb, l, l);
+    component t2 = BigMultShortLong2DUnequal(n, ka, kb, l, l);
+
+    for (int i = 0; i < l; i ++) {
+        for (std::size_t j = 0; j < ka; j ++) {
+            t0.a[i][j] <== a[i][0][j];
+            t1.a[i][j] <== a[i][1][j];
+            t2.a[i][j] <== a[i][0][j] + a[i][1][j];
+        }
+        for (std::size_t j = 0; j < kb; j ++) {
+            t0.b[i][j] <== b[i][0][j];
+            t1.b[i][j] <== b[i][1][j];
+            t2.b[i][j] <== b[i][0][j] + b[i][1][j];
+        }
+    }
+
+    // X[][0] = t0 - t1
+    // X[][1] = t2 - t0 - t1
+    signal X[2 * l - 1][2][ka + kb - 1];
+    for (int i = 0; i < 2 * l - 1; i++) {
+        for (std::size_t j = 0; j < ka + kb - 1; j++) {
+            X[i][0][j] <== t0.out[i][j] - t1.out[i][j];
+            X[i][1][j] <== t2.out[i][j] - t0.out[i][j] - t1.out[i][j];
+        }
+    }
+
+    for (int i = 0; i < l; i++)for (std::size_t j = 0; j < ka + kb - 1; j++) {
+        if (i < l - 1) {
+            out[i][0][j] <== X[i][0][j] + X[l + i][0][j]*XI0 - X[l + i][1][j];
+            out[i][1][j] <== X[i][1][j] + X[l + i][0][j]     + X[l + i][1][j]*XI0;
+        } else {
+            out[i][0][j] <== X[i][0][j];
+            out[i][1][j] <== X[i][1][j];
+        }
+    }
+}
+
+// a^2 for a = a0 + a1 u with a0, a1 degree 5 polynomials in w, two 2D products:
+//     a^2 = (a0 + a1)(a0 - a1) + (2 a0) a1 u
+// a has registers in (-B, B); the real and imaginary parts are
+//     * length 6 vectors with 2k-1 registers abs val < B^2 * 6 * k * (6 + 4 XI0)
+// m_out is the expected max number of bits in the output registers
+template SignedFp12SquareNoCarry(n, k, m_out){
+    std::size_t l = 6;
+    std::size_t XI0 = 1;
+    signal input a[l][2][k];
+    signal output out[l][2][2*k-1];
+
+    component real = BigMultShortLong2D(n, k, l);
+    component imag = BigMultShortLong2D(n, k, l);
+
+    for (int i = 0; i < l; i ++)for (std::size_t j = 0; j < k; j ++) {
+        real.a[i][j] <== a[i][0][j] + a[i][1][j];
+        real.b[i][j] <== a[i][0][j] - a[i][1][j];
+        imag.a[i][j] <== 2*a[i][0][j];
+        imag.b[i][j] <== a[i][1][j];
+    }
+
+    for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2*k-1; j++) {
+        if (i < l - 1) {
+            out[i][0][j] <== real.out[i][j] + real.out[l + i][j]*XI0 - imag.out[l + i][j];
+            out[i][1][j] <== imag.out[i][j] + real.out[l + i][j]     + imag.out[l + i][j]*XI0;
+        } else {
+            out[i][0][j] <== real.out[i][j];
+            out[i][1][j] <== imag.out[i][j];
+        }
+    }
+}
+
 // m_out is the expected max number of bits in the output registers
 template Fp12Compress(n, k, m, p, m_out){
     std::size_t l = 6;
@@ -345,6 +428,7 @@ template<std::size_t n, std::size_t k, std::size_t overflow, std::size_t p> void
 // version of Fp12Multiply that uses the prime reduction trick
 // takes longer to compile
 // assumes p has k registers with kth register nonzero
+// the product is SignedFp12MultiplyNoCarryKaratsubaUnequal, same out as the schoolbook one
 template<std::size_t n, std::size_t k, std::size_t p> void Fp12Multiply() {
     std::size_t l = 6;
     std::size_t XI0 = 1;
@@ -353,20 +437,27 @@ template<std::size_t n, std::size_t k, std::size_t p> void Fp12Multiply() {
     
     signal output out[l][2][k];
 
-    std::size_t LOGK2 = log_ceil(6*k*k*(2+XI0));
-    component no_carry = SignedFp12MultiplyNoCarryCompress(n, k, p, n, 3*n + LOGK2);
-    // registers abs val < 2^{3n} * 6*(2 + XI0) * k^2 )
+    std::size_t LOGK1 = log_ceil(6*k*(8+6*XI0));
+    std::size_t LOGK2 = log_ceil(6*k*k*(8+6*XI0));
+    component no_carry = SignedFp12MultiplyNoCarryKaratsubaUnequal(n, k, k, 2*n + LOGK1);
+    // 6 x 2 x 2k-1 registers abs val < 2^{2n} * 6 * k * (8 + 6 XI0)
     for (int i = 0; i < l; i++)for(std::size_t j = 0; j < 2; j++){
         for (std::size_t idx = 0; idx < k; idx++) {
             no_carry.a[i][j][idx] <== a[i][j][idx];
             no_carry.b[i][j][idx] <== b[i][j][idx];
         }
     }
+    component reduce = Fp12Compress(n, k, k-1, p, 3*n + LOGK2);
+    // registers abs val < 2^{3n} * 6 * (8 + 6 XI0) * k^2
+    for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2; j++)
+        for (std::size_t idx = 0; idx < 2 * k - 1; idx++)
+            reduce.in[i][j][idx] <== no_carry.out[i][j][idx];
+
     component carry_mod;
     carry_mod = SignedFp12CarryModP(n, k, 3*n + LOGK2, p);
     for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2; j++)
         for (std::size_t idx = 0; idx < k; idx++)
-		    carry_mod.in[i][j][idx] <== no_carry.out[i][j][idx];
+		    carry_mod.in[i][j][idx] <== reduce.out[i][j][idx];
         
     
     for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2; j++)
@@ -374,25 +465,32 @@ template<std::size_t n, std::size_t k, std::size_t p> void Fp12Multiply() {
             out[i][j][idx] <== carry_mod.out[i][j][idx];
 }
 
-// unoptimized squaring, just takes two elements of Fp12 and multiplies them
+// squaring with SignedFp12SquareNoCarry, two 2D products instead of the four of Fp12Multiply
 template<std::size_t n, std::size_t k, std::size_t p> void Fp12Square() {
-    signal input in[6][2][k];
-    signal output out[6][2][k];
+    std::size_t l = 6;
+    std::size_t XI0 = 1;
+    signal input in[l][2][k];
+    signal output out[l][2][k];
 
-    // for now just use plain multiplication, this can be optimized later
-    component square = Fp12Multiply(n, k, p);
-    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<k; j++){
-        square.a[i][0][j] <== in[i][0][j];
-        square.a[i][1][j] <== in[i][1][j];
-    
-        square.b[i][0][j] <== in[i][0][j];
-        square.b[i][1][j] <== in[i][1][j];
-    }
+    std::size_t LOGK1 = log_ceil(6*k*(6+4*XI0));
+    std::size_t LOGK2 = log_ceil(6*k*k*(6+4*XI0));
+    component no_carry = SignedFp12SquareNoCarry(n, k, 2*n + LOGK1);
+    // 6 x 2 x 2k-1 registers abs val < 2^{2n} * 6 * k * (6 + 4 XI0)
+    for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2; j++)for (std::size_t idx = 0; idx < k; idx++)
+        no_carry.a[i][j][idx] <== in[i][j][idx];
 
-    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<k; j++){
-        out[i][0][j] <== square.out[i][0][j];
-        out[i][1][j] <== square.out[i][1][j];
-    }
+    component reduce = Fp12Compress(n, k, k-1, p, 3*n + LOGK2);
+    // registers abs val < 2^{3n} * 6 * (6 + 4 XI0) * k^2
+    for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2; j++)
+        for (std::size_t idx = 0; idx < 2 * k - 1; idx++)
+            reduce.in[i][j][idx] <== no_carry.out[i][j][idx];
+
+    component carry_mod = SignedFp12CarryModP(n, k, 3*n + LOGK2, p);
+    for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2; j++)for (std::size_t idx = 0; idx < k; idx++)
+        carry_mod.in[i][j][idx] <== reduce.out[i][j][idx];
+
+    for (int i = 0; i < l; i++)for (std::size_t j = 0; j < 2; j++)for (std::size_t idx = 0; idx < k; idx++)
+        out[i][j][idx] <== carry_mod.out[i][j][idx];
 }
 
 
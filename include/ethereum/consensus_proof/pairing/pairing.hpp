@@ -873,6 +873,213 @@ template<std::size_t n, std::size_t k, std::size_t kg, std::size_t overflowg, st
         out[i][j][idx] <== carry.out[i][j][idx];
 }
 
+// Same as SignedLineFunctionEqualNoCarryFp2 for a fixed point Q = (X, Y):
+// Q is a 2 x k array of constants, so -3 x^2 X and 2 y Y are linear combinations of
+// the registers of P and add no constraints. Used for the generator of G1 in
+// MillerLoopFp2TwoFixedQ0.
+// If P has registers in [0, B), out has registers abs val < 12k^2*B^3
+template SignedLineFunctionEqualNoCarryFp2FixedQ(n, k, m_out, Q){
+    signal input P[2][2][k];
+    signal output out[6][2][3*k-2];
+
+    component x_sq3 = BigMultShortLong2D(n, k, 2); // 2k-1 registers in [0, 6*k*2^{2n} )
+    for(std::size_t i=0; i<2; i++){
+        for(std::size_t j = 0; j < k; j ++) {
+            x_sq3.a[i][j] <== 3*P[0][i][j];
+            x_sq3.b[i][j] <== P[0][i][j];
+        }
+    }
+
+    component x_cu3 = BigMultShortLong2DUnequal(n, 2*k-1, k, 2, 2);
+    for (int i = 0; i < 2*k-1; i ++) {
+        if (i < k) {
+            x_cu3.b[0][i] <== P[0][0][i];
+            x_cu3.b[1][i] <== P[0][1][i];
+        }
+        x_cu3.a[0][i] <== x_sq3.out[0][i] - x_sq3.out[2][i];
+        x_cu3.a[1][i] <== x_sq3.out[1][i];
+    }
+
+    component y_sq2 = BigMultShortLong2D(n, k, 2); // 2k-1 registers in [0, 6*k*2^{2n} )
+    for(std::size_t i=0; i<2; i++){
+        for(std::size_t j = 0; j < k; j ++) {
+            y_sq2.a[i][j] <== 2*P[1][i][j];
+            y_sq2.b[i][j] <== P[1][i][j];
+        }
+    }
+
+    for(std::size_t idx=0; idx<3*k-2; idx++){
+        out[1][0][idx] <== 0;
+        out[1][1][idx] <== 0;
+        out[4][0][idx] <== 0;
+        out[4][1][idx] <== 0;
+        out[5][0][idx] <== 0;
+        out[5][1][idx] <== 0;
+
+        if (idx < 2*k-1) {
+            out[0][0][idx] <== x_cu3.out[0][idx] - x_cu3.out[2][idx] - y_sq2.out[0][idx] + y_sq2.out[2][idx];
+            out[0][1][idx] <== x_cu3.out[1][idx] - y_sq2.out[1][idx];
+        }
+        else {
+            out[0][0][idx] <== x_cu3.out[0][idx] - x_cu3.out[2][idx];
+            out[0][1][idx] <== x_cu3.out[1][idx];
+        }
+
+        // (3x^2) * (-X), 3k-2 registers abs val < 6k^2 * 2^{3n}
+        std::size_t xmult0 = 0;
+        std::size_t xmult1 = 0;
+        for(std::size_t j=0; j<2*k-1; j++)if(j <= idx && idx - j < k){
+            xmult0 -= (x_sq3.out[0][j] - x_sq3.out[2][j]) * Q[0][idx - j];
+            xmult1 -= x_sq3.out[1][j] * Q[0][idx - j];
+        }
+        out[2][0][idx] <== xmult0;
+        out[2][1][idx] <== xmult1;
+
+        // (2y) * Y, 2k-1 registers abs val < 2k * 2^{2n}
+        std::size_t ymult0 = 0;
+        std::size_t ymult1 = 0;
+        for(std::size_t j=0; j<k; j++)if(j <= idx && idx - j < k){
+            ymult0 += 2*P[1][0][j] * Q[1][idx - j];
+            ymult1 += 2*P[1][1][j] * Q[1][idx - j];
+        }
+        out[3][0][idx] <== ymult0;
+        out[3][1][idx] <== ymult1;
+    }
+}
+
+// Same as SignedLineFunctionUnequalNoCarryFp2 for a fixed point Q = (X, Y) given as a
+// 2 x k array of constants: (y_1 - y_2) X and (x_2 - x_1) Y are linear in P
+// If P has registers in [0, B), out has registers abs val < 2k * B^2
+template SignedLineFunctionUnequalNoCarryFp2FixedQ(n, k, m_out, Q){
+    signal input P[2][2][2][k];
+    signal output out[6][2][2*k-1];
+
+    component x1y2 = BigMultShortLong2D(n, k, 2); // 2k-1 registers in [0, 2k*B^2)
+    component x2y1 = BigMultShortLong2D(n, k, 2);
+    for(std::size_t i = 0; i < 2; i ++) {
+        for(std::size_t j=0; j<k; j++){
+            x1y2.a[i][j] <== P[0][0][i][j];
+            x1y2.b[i][j] <== P[1][1][i][j];
+
+            x2y1.a[i][j] <== P[1][0][i][j];
+            x2y1.b[i][j] <== P[0][1][i][j];
+        }
+    }
+
+    for(std::size_t idx=0; idx<2*k-1; idx++){
+        out[0][0][idx] <== 0;
+        out[0][1][idx] <== 0;
+        out[2][0][idx] <== 0;
+        out[2][1][idx] <== 0;
+        out[5][0][idx] <== 0;
+        out[5][1][idx] <== 0;
+
+        out[1][0][idx] <== x1y2.out[0][idx] - x2y1.out[0][idx] - x1y2.out[2][idx] + x2y1.out[2][idx];
+        out[1][1][idx] <== x1y2.out[1][idx] - x2y1.out[1][idx];
+
+        std::size_t xmult0 = 0;
+        std::size_t xmult1 = 0;
+        std::size_t ymult0 = 0;
+        std::size_t ymult1 = 0;
+        for(std::size_t j=0; j<k; j++)if(j <= idx && idx - j < k){
+            xmult0 += (P[0][1][0][j] - P[1][1][0][j]) * Q[0][idx - j];
+            xmult1 += (P[0][1][1][j] - P[1][1][1][j]) * Q[0][idx - j];
+            ymult0 += (P[1][0][0][j] - P[0][0][0][j]) * Q[1][idx - j];
+            ymult1 += (P[1][0][1][j] - P[0][0][1][j]) * Q[1][idx - j];
+        }
+        out[3][0][idx] <== xmult0;
+        out[3][1][idx] <== xmult1;
+        out[4][0][idx] <== ymult0;
+        out[4][1][idx] <== ymult1;
+    }
+}
+
+// LineFunctionEqualFp2 for a fixed point Q given as a 2 x k array of constants
+template<std::size_t n, std::size_t k, std::size_t q, std::size_t Q> void LineFunctionEqualFp2FixedQ() {
+    signal input P[2][2][k];
+
+    signal output out[6][2][k];
+
+    std::size_t LOGK2 = log_ceil(12*k*k + 1);
+    component nocarry = SignedLineFunctionEqualNoCarryFp2FixedQ(n, k, 3*n + LOGK2, Q);
+    for (int i = 0; i < 2; i++) {
+        for (std::size_t j = 0; j < 2; j ++) {
+            for (std::size_t idx = 0; idx < k; idx++) {
+                nocarry.P[i][j][idx] <== P[i][j][idx];
+            }
+        }
+    }
+
+    std::size_t LOGK3 = log_ceil((2*k-1)*12*k*k + 1);
+    component reduce[6][4];
+    for (int i = 0; i < 6; i++) {
+        for (std::size_t j = 0; j < 2; j++) {
+            reduce[i][j] = PrimeReduce(n, k, 2 * k - 2, q, 4 * n + LOGK3);
+        }
+
+        for (std::size_t j = 0; j < 2; j++) {
+            for (std::size_t idx = 0; idx < 3 * k - 2; idx++) {
+                reduce[i][j].in[idx] <== nocarry.out[i][j][idx];
+            }
+        }
+    }
+
+    // max overflow register size is (2k - 1) * 12k^2 * 2^{4n}
+    component carry = SignedFp12CarryModP(n, k, 4 * n + LOGK3, q);
+    for (int i = 0; i < 6; i++) {
+        for (std::size_t j = 0; j < 2; j++) {
+            for (std::size_t idx = 0; idx < k; idx++) {
+                carry.in[i][j][idx] <== reduce[i][j].out[idx];
+            }
+        }
+    }
+
+    for (int i = 0; i < 6; i++) {
+        for (std::size_t j = 0; j < 2; j++) {
+            for (std::size_t idx = 0; idx < k; idx++) {
+            out[i][j][idx] <== carry.out[i][j][idx];
+            }
+        }
+    }
+}
+
+// Fp12MultiplyWithLineUnequalFp2 for a fixed point Q given as a 2 x k array of constants
+template<std::size_t n, std::size_t k, std::size_t kg, std::size_t overflowg, std::size_t q, std::size_t Q> void Fp12MultiplyWithLineUnequalFp2FixedQ(){
+    signal input g[6][2][kg];
+    signal input P[2][2][2][k];
+    signal output out[6][2][k];
+
+    std::size_t XI0 = 1;
+    std::size_t LOGK1 = log_ceil(12*k);
+    std::size_t LOGK2 = log_ceil(12*k * min(kg, 2*k-1) * 6 * (2+XI0) );
+    std::size_t LOGK3 = log_ceil( 12*k * min(kg, 2*k-1) * 6 * (2+XI0) * (k + kg - 1) );
+    assert( overflowg + 3*n + LOGK3 < 251 );
+
+    component line = SignedLineFunctionUnequalNoCarryFp2FixedQ(n, k, 2*n + LOGK1, Q); // 6 x 2 x 2k - 1 registers in [0, 12k 2^{2n})
+    for(std::size_t i=0; i<2; i++)for(std::size_t j=0; j<2; j++)for(std::size_t l=0; l<2; l++)for(std::size_t idx=0; idx<k; idx++)
+        line.P[i][j][l][idx] <== P[i][j][l][idx];
+
+    component mult = SignedFp12MultiplyNoCarryUnequal(n, kg, 2*k - 1, overflowg + 2*n + LOGK2); // 6 x 2 x (2k + kg - 2) registers abs val < 12k * min(kg, 2k - 1) * 6 * (2+XI0)* 2^{overflowg + 2n}
+
+    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<kg; idx++)
+        mult.a[i][j][idx] <== g[i][j][idx];
+    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<2*k-1; idx++)
+        mult.b[i][j][idx] <== line.out[i][j][idx];
+
+
+    component reduce = Fp12Compress(n, k, k + kg - 2, q, overflowg + 3*n + LOGK3); // 6 x 2 x k registers abs val < 12 k * min(kg, 2k - 1) * 6*(2+XI0) * (k + kg - 1) *  2^{overflowg + 3n}
+    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<2*k + kg - 2; idx++)
+        reduce.in[i][j][idx] <== mult.out[i][j][idx];
+
+    component carry = SignedFp12CarryModP(n, k, overflowg + 3*n + LOGK3, q);
+
+    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+        carry.in[i][j][idx] <== reduce.out[i][j][idx];
+
+    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+        out[i][j][idx] <== carry.out[i][j][idx];
+}
+
 // Assuming curve is of form Y^2 = X^3 + b for now (a = 0) for better register bounds 
 // b is complex
 // Inputs:
@@ -1158,6 +1365,341 @@ template<std::size_t n, std::size_t k, std::size_t b, std::size_t x, std::size_t
         out[l][j][idx] <== f[0][l][j][idx];
 }
 
+// MillerLoopFp2Two with Q[0] fixed to the constant Q0 (a 2 x k array), as for the
+// generator of G1 in CoreVerifyPubkeyG1NoCheck. The lines through R[i][0] and P[0] are
+// evaluated at Q0 with LineFunctionEqualFp2FixedQ / Fp12MultiplyWithLineUnequalFp2FixedQ,
+// where the products with the coordinates of Q0 are linear. out and every f[i], R[i]
+// are the same as for MillerLoopFp2Two with Q = [Q0, Q].
+// Inputs:
+//  P is 2 x 2 x 2 x k array where P[i] = (x_i, y_i) is a point in E[r](Fq2)
+//  Q is 2 x k array representing point (X_1, Y_1) in E(Fq)
+// Output:
+//  out = f_x(P_0,Q0) f_x(P_1, Q) is 6 x 2 x k
+template<std::size_t n, std::size_t k, std::size_t b, std::size_t x, std::size_t q, std::size_t Q0> void MillerLoopFp2TwoFixedQ0(){
+    signal input P[2][2][2][k];
+    signal input Q[2][k];
+
+    signal output out[6][2][k];
+
+    std::size_t LOGK = log_ceil(k);
+    std::size_t XI0 = 1;
+    std::size_t LOGK2 = log_ceil(36*(2+XI0)*(2+XI0) * k*k);
+    std::size_t LOGK3 = log_ceil(36*(2+XI0)*(2+XI0) * k*k*(2*k-1));
+    assert( 4*n + LOGK3 < 251 );
+
+    std::size_t Bits[250]; // length is k * n
+    std::size_t BitLength;
+    std::size_t SigBits=0;
+    for (int i = 0; i < 250; i++) {
+        Bits[i] = (x >> i) & 1;
+        if(Bits[i] == 1){
+            SigBits++;
+            BitLength = i + 1;
+        }
+    }
+
+    signal R[BitLength][2][2][2][k];
+    signal f[BitLength][6][2][k];
+
+    component Pdouble[BitLength][2];
+    component fdouble_0[BitLength];
+    component fdouble[BitLength];
+    component square[BitLength];
+    component line0[BitLength];
+    component line[BitLength];
+    component compress[BitLength];
+    component nocarry[BitLength];
+    component Padd[SigBits][2];
+    component fadd0[SigBits];
+    component fadd[SigBits];
+    std::size_t curid=0;
+
+    for(std::size_t i=BitLength - 1; i>=0; i--){
+        if( i == BitLength - 1 ){
+            // f = 1
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                if(l==0 && j==0 && idx==0)
+                    f[i][l][j][idx] <== 1;
+                else
+                    f[i][l][j][idx] <== 0;
+            }
+            for(std::size_t idP=0; idP<2; idP++)
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                    R[i][idP][j][l][idx] <== P[idP][j][l][idx];
+        }else{
+            // compute fdouble[i] = (f[i+1]^2 * l_{R[i+1][0], R[i+1][0]}(Q0)) * l_{R[i+1][1], R[i+1][1]}(Q)
+            square[i] = SignedFp12MultiplyNoCarry(n, k, 2*n + 4 + LOGK); // 6 x 2 x 2k-1 registers in [0, 6 * k * (2+XI0) * 2^{2n} )
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                square[i].a[l][j][idx] <== f[i+1][l][j][idx];
+                square[i].b[l][j][idx] <== f[i+1][l][j][idx];
+            }
+            // the line for R[i+1][0] is evaluated at the constant Q0
+            line0[i] = LineFunctionEqualFp2FixedQ(n, k, q, Q0); // 6 x 2 x k registers in [0, 2^n)
+            for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                line0[i].P[j][l][idx] <== R[i+1][0][j][l][idx];
+            line[i] = LineFunctionEqualFp2(n, k, q); // 6 x 2 x k registers in [0, 2^n)
+            for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                line[i].P[j][l][idx] <== R[i+1][1][j][l][idx];
+            for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                line[i].Q[j][idx] <== Q[j][idx];
+
+            for(std::size_t idP=0; idP<2; idP++){
+                Pdouble[i][idP] = EllipticCurveDoubleFp2(n, k, [0,0], b, q);
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                    Pdouble[i][idP].in[j][l][idx] <== R[i+1][idP][j][l][idx];
+            }
+
+            nocarry[i] = SignedFp12MultiplyNoCarryUnequal(n, 2*k-1, k, 3*n + LOGK2); // 6 x 2 x 3k-2 registers < (6 * (2+XI0))^2 * k^2 * 2^{3n} )
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++){
+                for(std::size_t idx=0; idx<2*k-1; idx++)
+                    nocarry[i].a[l][j][idx] <== square[i].out[l][j][idx];
+                for(std::size_t idx=0; idx<k; idx++)
+                    nocarry[i].b[l][j][idx] <== line0[i].out[l][j][idx];
+            }
+
+            compress[i] = Fp12Compress(n, k, 2*k-2, q, 4*n + LOGK3); // 6 x 2 x k registers < (6 * (2+ XI0))^2 * k^2 * (2k-1) * 2^{4n} )
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<3*k-2; idx++)
+                compress[i].in[l][j][idx] <== nocarry[i].out[l][j][idx];
+
+            fdouble_0[i] = SignedFp12CarryModP(n, k, 4*n + LOGK3, q);
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                fdouble_0[i].in[l][j][idx] <== compress[i].out[l][j][idx];
+
+            fdouble[i] = Fp12Multiply(n, k, q);
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                fdouble[i].a[l][j][idx] <== fdouble_0[i].out[l][j][idx];
+                fdouble[i].b[l][j][idx] <== line[i].out[l][j][idx];
+            }
+
+            if(Bits[i] == 0){
+                for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                    f[i][l][j][idx] <== fdouble[i].out[l][j][idx];
+                for(std::size_t idP=0; idP<2; idP++)
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                        R[i][idP][j][l][idx] <== Pdouble[i][idP].out[j][l][idx];
+            }else{
+                fadd0[curid] = Fp12MultiplyWithLineUnequalFp2FixedQ(n, k, k, n, q, Q0);
+                for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                    fadd0[curid].g[l][j][idx] <== fdouble[i].out[l][j][idx];
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++){
+                    fadd0[curid].P[0][j][l][idx] <== Pdouble[i][0].out[j][l][idx];
+                    fadd0[curid].P[1][j][l][idx] <== P[0][j][l][idx];
+                }
+
+                fadd[curid] = Fp12MultiplyWithLineUnequalFp2(n, k, k, n, q);
+                for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                    fadd[curid].g[l][j][idx] <== fadd0[curid].out[l][j][idx];
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++){
+                    fadd[curid].P[0][j][l][idx] <== Pdouble[i][1].out[j][l][idx];
+                    fadd[curid].P[1][j][l][idx] <== P[1][j][l][idx];
+                }
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                    fadd[curid].Q[j][idx] <== Q[j][idx];
+
+                for(std::size_t idP=0; idP<2; idP++){
+                    // Padd[curid][idP] = Pdouble[i][idP] + P[idP]
+                    Padd[curid][idP] = EllipticCurveAddUnequalFp2(n, k, q);
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++){
+                        Padd[curid][idP].a[j][l][idx] <== Pdouble[i][idP].out[j][l][idx];
+                        Padd[curid][idP].b[j][l][idx] <== P[idP][j][l][idx];
+                    }
+
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                        R[i][idP][j][l][idx] <== Padd[curid][idP].out[j][l][idx];
+
+                }
+                for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                    f[i][l][j][idx] <== fadd[curid].out[l][j][idx];
+
+                curid++;
+            }
+        }
+    }
+    for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+        out[l][j][idx] <== f[0][l][j][idx];
+}
+
+// Generalisation of MillerLoopFp2Two to M pairs: f is squared once per iteration and
+// then multiplied by the line of every pair in turn, so the squaring chain is shared.
+// Inputs:
+//  P is M x 2 x 2 x k array where P[i] = (x_i, y_i) is a point in E[r](Fq2)
+//  Q is M x 2 x k array representing points (X_i, Y_i) in E(Fq)
+// Output:
+//  out = f_x(P_0,Q_0) * ... * f_x(P_{M-1}, Q_{M-1}) is 6 x 2 x k
+// Assume:
+//  M >= 1, and the same as for MillerLoopFp2Two for every pair
+template<std::size_t n, std::size_t k, std::size_t b, std::size_t x, std::size_t q, std::size_t M> void MillerLoopFp2Many(){
+    signal input P[M][2][2][k];
+    signal input Q[M][2][k];
+
+    signal output out[6][2][k];
+
+    std::size_t LOGK = log_ceil(k);
+    std::size_t XI0 = 1;
+    std::size_t LOGK2 = log_ceil(36*(2+XI0)*(2+XI0) * k*k);
+    std::size_t LOGK3 = log_ceil(36*(2+XI0)*(2+XI0) * k*k*(2*k-1));
+    assert( 4*n + LOGK3 < 251 );
+
+    std::size_t Bits[250]; // length is k * n
+    std::size_t BitLength;
+    std::size_t SigBits=0;
+    for (int i = 0; i < 250; i++) {
+        Bits[i] = (x >> i) & 1;
+        if(Bits[i] == 1){
+            SigBits++;
+            BitLength = i + 1;
+        }
+    }
+
+    signal R[BitLength][M][2][2][k];
+    signal f[BitLength][6][2][k];
+
+    component Pdouble[BitLength][M];
+    component fdouble_0[BitLength];
+    component fdouble[BitLength][M];
+    component square[BitLength];
+    component line[BitLength][M];
+    component compress[BitLength];
+    component nocarry[BitLength];
+    component Padd[SigBits][M];
+    component fadd[SigBits][M];
+    std::size_t curid=0;
+
+    for(std::size_t i=BitLength - 1; i>=0; i--){
+        if( i == BitLength - 1 ){
+            // f = 1
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                if(l==0 && j==0 && idx==0)
+                    f[i][l][j][idx] <== 1;
+                else
+                    f[i][l][j][idx] <== 0;
+            }
+            for(std::size_t idP=0; idP<M; idP++)
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                    R[i][idP][j][l][idx] <== P[idP][j][l][idx];
+        }else{
+            // compute fdouble[i][M-1] = f[i+1]^2 * l_{R[i+1][0], R[i+1][0]}(Q[0]) * ... * l_{R[i+1][M-1], R[i+1][M-1]}(Q[M-1])
+            square[i] = SignedFp12MultiplyNoCarry(n, k, 2*n + 4 + LOGK); // 6 x 2 x 2k-1 registers in [0, 6 * k * (2+XI0) * 2^{2n} )
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                square[i].a[l][j][idx] <== f[i+1][l][j][idx];
+                square[i].b[l][j][idx] <== f[i+1][l][j][idx];
+            }
+            for(std::size_t idP=0; idP<M; idP++){
+                line[i][idP] = LineFunctionEqualFp2(n, k, q); // 6 x 2 x k registers in [0, 2^n)
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                    line[i][idP].P[j][l][idx] <== R[i+1][idP][j][l][idx];
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                    line[i][idP].Q[j][idx] <== Q[idP][j][idx];
+
+                Pdouble[i][idP] = EllipticCurveDoubleFp2(n, k, [0,0], b, q);
+                for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                    Pdouble[i][idP].in[j][l][idx] <== R[i+1][idP][j][l][idx];
+            }
+
+            nocarry[i] = SignedFp12MultiplyNoCarryUnequal(n, 2*k-1, k, 3*n + LOGK2); // 6 x 2 x 3k-2 registers < (6 * (2+XI0))^2 * k^2 * 2^{3n} )
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++){
+                for(std::size_t idx=0; idx<2*k-1; idx++)
+                    nocarry[i].a[l][j][idx] <== square[i].out[l][j][idx];
+                for(std::size_t idx=0; idx<k; idx++)
+                    nocarry[i].b[l][j][idx] <== line[i][0].out[l][j][idx];
+            }
+
+            compress[i] = Fp12Compress(n, k, 2*k-2, q, 4*n + LOGK3); // 6 x 2 x k registers < (6 * (2+ XI0))^2 * k^2 * (2k-1) * 2^{4n} )
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<3*k-2; idx++)
+                compress[i].in[l][j][idx] <== nocarry[i].out[l][j][idx];
+
+            fdouble_0[i] = SignedFp12CarryModP(n, k, 4*n + LOGK3, q);
+            for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                fdouble_0[i].in[l][j][idx] <== compress[i].out[l][j][idx];
+
+            // fdouble[i][0] is fdouble_0[i], the other pairs multiply their line in one by one
+            for(std::size_t idP=1; idP<M; idP++){
+                fdouble[i][idP] = Fp12Multiply(n, k, q);
+                for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                    if(idP == 1)
+                        fdouble[i][idP].a[l][j][idx] <== fdouble_0[i].out[l][j][idx];
+                    else
+                        fdouble[i][idP].a[l][j][idx] <== fdouble[i][idP-1].out[l][j][idx];
+                    fdouble[i][idP].b[l][j][idx] <== line[i][idP].out[l][j][idx];
+                }
+            }
+
+            if(Bits[i] == 0){
+                for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                    if(M == 1)
+                        f[i][l][j][idx] <== fdouble_0[i].out[l][j][idx];
+                    else
+                        f[i][l][j][idx] <== fdouble[i][M-1].out[l][j][idx];
+                }
+                for(std::size_t idP=0; idP<M; idP++)
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                        R[i][idP][j][l][idx] <== Pdouble[i][idP].out[j][l][idx];
+            }else{
+                for(std::size_t idP=0; idP<M; idP++){
+                    fadd[curid][idP] = Fp12MultiplyWithLineUnequalFp2(n, k, k, n, q);
+                    for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++){
+                        if(idP == 0 && M == 1)
+                            fadd[curid][idP].g[l][j][idx] <== fdouble_0[i].out[l][j][idx];
+                        else if(idP == 0)
+                            fadd[curid][idP].g[l][j][idx] <== fdouble[i][M-1].out[l][j][idx];
+                        else
+                            fadd[curid][idP].g[l][j][idx] <== fadd[curid][idP-1].out[l][j][idx];
+                    }
+
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++){
+                        fadd[curid][idP].P[0][j][l][idx] <== Pdouble[i][idP].out[j][l][idx];
+                        fadd[curid][idP].P[1][j][l][idx] <== P[idP][j][l][idx];
+                    }
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                        fadd[curid][idP].Q[j][idx] <== Q[idP][j][idx];
+
+                    // Padd[curid][idP] = Pdouble[i][idP] + P[idP]
+                    Padd[curid][idP] = EllipticCurveAddUnequalFp2(n, k, q);
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++){
+                        Padd[curid][idP].a[j][l][idx] <== Pdouble[i][idP].out[j][l][idx];
+                        Padd[curid][idP].b[j][l][idx] <== P[idP][j][l][idx];
+                    }
+
+                    for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)for(std::size_t l=0; l<2; l++)
+                        R[i][idP][j][l][idx] <== Padd[curid][idP].out[j][l][idx];
+
+                }
+                for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+                    f[i][l][j][idx] <== fadd[curid][M-1].out[l][j][idx];
+
+                curid++;
+            }
+        }
+    }
+    for(std::size_t l=0; l<6; l++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+        out[l][j][idx] <== f[0][l][j][idx];
+}
+
+// Product of M optimal Ate pairings e(P_0, Q_0) * ... * e(P_{M-1}, Q_{M-1}) with a single
+// FinalExponentiate; P in E(Fq2), Q in E(Fq) as for MillerLoopFp2Many
+template<std::size_t n, std::size_t k, std::size_t q, std::size_t M> void PairingProductFp2Many(){
+    signal input P[M][2][2][k];
+    signal input Q[M][2][k];
+    signal output out[6][2][k];
+
+    std::size_t x = BLS12381_PARAMETER;
+
+    component miller = MillerLoopFp2Many(n, k, [4,4], x, q, M);
+    for(std::size_t idP=0; idP<M; idP++){
+        for(std::size_t i=0; i<2; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+            miller.P[idP][i][j][idx] <== P[idP][i][j][idx];
+        for(std::size_t i=0; i<2; i++)for(std::size_t idx=0; idx<k; idx++)
+            miller.Q[idP][i][idx] <== Q[idP][i][idx];
+    }
+
+    component finalexp = FinalExponentiate(n, k, q);
+    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+        finalexp.in[i][j][idx] <== miller.out[i][j][idx];
+
+    for(std::size_t i=0; i<6; i++)for(std::size_t j=0; j<2; j++)for(std::size_t idx=0; idx<k; idx++)
+        out[i][j][idx] <== finalexp.out[i][j][idx];
+}
+
 template<std::size_t n, std::size_t k, std::size_t q> void OptimalAtePairing(){
     signal input P[2][2][k];
     signal input Q[2][k];
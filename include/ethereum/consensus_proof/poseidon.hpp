@@ -1,8 +1,12 @@
 #include <array>
 
+#include <ethereum/consensus_proof/constants.hpp>
+
 /*
  * Helper functions for computing Poseidon commitments to the sync committee's
- * validator public keys.
+ * validator public keys. PoseidonG1Commitment is the one Rotate and Step use;
+ * SYNC_COMMITTEE_POSEIDON_TREE picks between the PoseidonG1Array sponge and
+ * the PoseidonG1Tree of independent per-pubkey leaves.
  */
 
 template<std::size_t LENGTH>
@@ -45,4 +49,80 @@ std::size_t PoseidonG1Array(const std::array<std::array<std::array<std::size_t,
         }
     }
     out = hasher.out;
-}
\ No newline at end of file
+}
+
+template<std::size_t N, std::size_t K>
+std::size_t PoseidonG1Leaf(const std::array<std::array<std::size_t, K>, 2> &pubkey) {
+    static_assert(2 * K <= POSEIDON_TREE_ARITY);
+
+    /* the registers in PoseidonG1Array order, zero padded */
+    component hasher = PoseidonEx(POSEIDON_TREE_ARITY, 1);
+    hasher.initialState = POSEIDON_TREE_LEAF_DOMAIN;
+    for (std::size_t j = 0; j < POSEIDON_TREE_ARITY; j++) {
+        if (j < 2 * K) {
+            hasher.inputs[j] = pubkey[j % 2][j / 2];
+        } else {
+            hasher.inputs[j] = 0;
+        }
+    }
+    out = hasher.out[0];
+}
+
+template<std::size_t LENGTH, std::size_t DEPTH, std::size_t N, std::size_t K>
+std::size_t PoseidonG1Tree(const std::array<std::array<std::array<std::size_t, K>, 2>, LENGTH> &pubkeys) {
+    /* one leaf per pubkey, none of them depends on another */
+    component leaves[LENGTH];
+    std::size_t level[LENGTH];
+    for (int i = 0; i < LENGTH; i++) {
+        leaves[i] = PoseidonG1Leaf(N, K);
+        for (std::size_t j = 0; j < K; j++) {
+            for (std::size_t l = 0; l < 2; l++) {
+                leaves[i].pubkey[l][j] = pubkeys[i][l][j];
+            }
+        }
+        level[i] = leaves[i].out;
+    }
+
+    /* POSEIDON_TREE_ARITY children per node, a short last group is zero padded */
+    std::size_t width = LENGTH;
+    for (std::size_t d = 0; d < DEPTH; d++) {
+        std::size_t parents = (width + POSEIDON_TREE_ARITY - 1) / POSEIDON_TREE_ARITY;
+        component hashers[parents];
+        for (std::size_t p = 0; p < parents; p++) {
+            hashers[p] = PoseidonEx(POSEIDON_TREE_ARITY, 1);
+            hashers[p].initialState = POSEIDON_TREE_NODE_DOMAIN;
+            for (std::size_t c = 0; c < POSEIDON_TREE_ARITY; c++) {
+                if (p * POSEIDON_TREE_ARITY + c < width) {
+                    hashers[p].inputs[c] = level[p * POSEIDON_TREE_ARITY + c];
+                } else {
+                    hashers[p].inputs[c] = 0;
+                }
+            }
+        }
+        for (std::size_t p = 0; p < parents; p++) {
+            level[p] = hashers[p].out[0];
+        }
+        width = parents;
+    }
+    assert(width == 1);
+
+    out = level[0];
+}
+
+template<std::size_t LENGTH, std::size_t N, std::size_t K>
+std::size_t PoseidonG1Commitment(const std::array<std::array<std::array<std::size_t, K>, 2>, LENGTH> &pubkeys) {
+    component hasher;
+    if constexpr (SYNC_COMMITTEE_POSEIDON_TREE) {
+        hasher = PoseidonG1Tree(LENGTH, SYNC_COMMITTEE_POSEIDON_TREE_DEPTH, N, K);
+    } else {
+        hasher = PoseidonG1Array(LENGTH, N, K);
+    }
+    for (int i = 0; i < LENGTH; i++) {
+        for (std::size_t j = 0; j < K; j++) {
+            for (std::size_t l = 0; l < 2; l++) {
+                hasher.pubkeys[i][l][j] = pubkeys[i][l][j];
+            }
+        }
+    }
+    out = hasher.out;
+}
@@ -3,6 +3,9 @@
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/hash/algorithms/hash.hpp>
 
+#include <ethereum/consensus_proof/constants.hpp>
+#include <ethereum/consensus_proof/hash_to_field.hpp>
+
 /*
  * Implements SimpleSerialize (SSZ) according to the Ethereum 2.0. spec for
  * various containers, including BeaconBlockHeader, SyncCommittee, etc.
@@ -62,47 +65,98 @@ std::array<std::size_t, 32> SSZArray(const std::array<std::size_t, numBytes> &in
     return out;
 }
 
+/*
+ * Root of numChunks 32-byte chunks right padded with zero chunks to 2^log2b.
+ * Subtrees made only of padding are the constants SSZ_ZERO_HASHES[layerIdx]
+ * and get no hasher; the last node of an odd layer is hashed against that
+ * constant instead of a padded sibling.
+ */
+template<std::size_t numChunks, std::size_t log2b>
+std::array<std::size_t, 32> SSZArrayPadded(const std::array<std::size_t, numChunks * 32> &in) {
+    static_assert(numChunks >= 1 && numChunks <= (1 << log2b) && log2b <= SSZ_ZERO_HASH_DEPTH);
+
+    std::array<std::size_t, 32> out;
+    std::array<std::array<std::size_t, numChunks * 32>, log2b + 1> nodes;
+    std::size_t width = numChunks;
+
+    for (int i = 0; i < numChunks * 32; i++) {
+        nodes[0][i] = in[i];
+    }
+
+    for (int layerIdx = 0; layerIdx < log2b; layerIdx++) {
+        std::size_t nextWidth = (width + 1) / 2;
+        for (int i = 0; i < nextWidth; i++) {
+            component hasher = Sha256Bytes(64);
+            for (int j = 0; j < 32; j++) {
+                hasher.in[j] = nodes[layerIdx][2 * i * 32 + j];
+                if (2 * i + 1 < width) {
+                    hasher.in[32 + j] = nodes[layerIdx][(2 * i + 1) * 32 + j];
+                } else {
+                    hasher.in[32 + j] = SSZ_ZERO_HASHES[layerIdx][j];
+                }
+            }
+            for (int j = 0; j < 32; j++) {
+                nodes[layerIdx + 1][i * 32 + j] = hasher.out[j];
+            }
+        }
+        width = nextWidth;
+    }
+
+    for (int i = 0; i < 32; i++) {
+        out[i] = nodes[log2b][i];
+    }
+
+    return out;
+}
+
+/*
+ * A pubkey chunk pair is the 48 pubkey bytes and 16 zero bytes, hashed as
+ * one 64-byte message: the zeros are the constant tail of
+ * Sha256BytesFolded, and the second block, made only of SHA-256 padding,
+ * has a constant message schedule. The merkleization above the pubkey roots
+ * is a full SSZArrayPadded.
+ */
 template<std::size_t SYNC_COMMITTEE_SIZE, std::size_t LOG_2_SYNC_COMMITTEE_SIZE, std::size_t G1_POINT_SIZE>
 std::array<std::size_t, 32>
-SSZPhase0SyncCommittee(const std::array<std::array<std::size_t, SYNC_COMMITTEE_SIZE>, G1_POINT_SIZE> &pubkeys,
+SSZPhase0SyncCommittee(const std::array<std::array<std::size_t, G1_POINT_SIZE>, SYNC_COMMITTEE_SIZE> &pubkeys,
                        const std::array<std::size_t, G1_POINT_SIZE> &aggregatePubkey) {
+    static_assert(G1_POINT_SIZE < 64);
 
-    std::array<std::size_t, 32> sszPubkeys;
-    std::array<std::size_t, SYNC_COMMITTEE_SIZE * 64> sszPubkeysIn;
+    std::array<std::size_t, 32> out;
+    std::array<std::size_t, 64 - G1_POINT_SIZE> zeroPadding;
+    for (int i = 0; i < 64 - G1_POINT_SIZE; i++) {
+        zeroPadding[i] = 0;
+    }
 
+    std::array<std::size_t, SYNC_COMMITTEE_SIZE * 32> sszPubkeysIn;
     for (int i = 0; i < SYNC_COMMITTEE_SIZE; i++) {
-        for (int j = 0; j < 64; j++) {
-            if (j < G1_POINT_SIZE) {
-                sszPubkeysIn[i * 64 + j] = pubkeys[i][j];
-            } else {
-                sszPubkeysIn[i * 64 + j] = 0;
-            }
+        std::array<std::size_t, 32> pubkeyRoot =
+            Sha256BytesFolded<0, G1_POINT_SIZE, 64 - G1_POINT_SIZE>(SHA256_IV, pubkeys[i], zeroPadding);
+        for (int j = 0; j < 32; j++) {
+            sszPubkeysIn[i * 32 + j] = pubkeyRoot[j];
         }
     }
 
-    sszPubkeys = SSZArray<SYNC_COMMITTEE_SIZE * 64, LOG_2_SYNC_COMMITTEE_SIZE + 1>(sszPubkeysIn);
+    std::array<std::size_t, 32> sszPubkeys =
+        SSZArrayPadded<SYNC_COMMITTEE_SIZE, LOG_2_SYNC_COMMITTEE_SIZE>(sszPubkeysIn);
 
-    component sszAggregatePubkey = SSZArray(64, 1);
-    for (int i = 0; i < 64; i++) {
-        if (i < G1_POINT_SIZE) {
-            sszAggregatePubkey.in[i] = aggregatePubkey[i];
-        } else {
-            sszAggregatePubkey.in[i] = 0;
-        }
-    }
+    std::array<std::size_t, 32> sszAggregatePubkey =
+        Sha256BytesFolded<0, G1_POINT_SIZE, 64 - G1_POINT_SIZE>(SHA256_IV, aggregatePubkey, zeroPadding);
 
     component hasher = Sha256Bytes(64);
     for (int i = 0; i < 64; i++) {
         if (i < 32) {
-            hasher.in[i] = sszPubkeys.out[i];
+            hasher.in[i] = sszPubkeys[i];
         } else {
-            hasher.in[i] = sszAggregatePubkey.out[i - 32];
+            hasher.in[i] = sszAggregatePubkey[i - 32];
         }
     }
 
     for (int i = 0; i < 32; i++) {
         out[i] = hasher.out[i];
     }
+
+    return out;
 }
 
 std::array<std::size_t, 32> SSZPhase0BeaconBlockHeader(const std::array<std::size_t, 32> &slot,
@@ -113,25 +167,26 @@ std::array<std::size_t, 32> SSZPhase0BeaconBlockHeader(const std::array<std::siz
     std::array<std::size_t, 32> sszPubkeys;
     std::array<std::size_t, SYNC_COMMITTEE_SIZE * 64> sszPubkeysIn;
 
-    component sszBeaconBlockHeader = SSZArray(256, 3);
-    for (int i = 0; i < 256; i++) {
+    // five chunks, the three padding ones fold into SSZ_ZERO_HASHES: 6 hashers instead of 7
+    std::array<std::size_t, 160> sszBeaconBlockHeaderIn;
+    for (int i = 0; i < 160; i++) {
         if (i < 32) {
-            sszBeaconBlockHeader.in[i] = slot[i];
+            sszBeaconBlockHeaderIn[i] = slot[i];
         } else if (i < 64) {
-            sszBeaconBlockHeader.in[i] = proposerIndex[i - 32];
+            sszBeaconBlockHeaderIn[i] = proposerIndex[i - 32];
         } else if (i < 96) {
-            sszBeaconBlockHeader.in[i] = parentRoot[i - 64];
+            sszBeaconBlockHeaderIn[i] = parentRoot[i - 64];
         } else if (i < 128) {
-            sszBeaconBlockHeader.in[i] = stateRoot[i - 96];
-        } else if (i < 160) {
-            sszBeaconBlockHeader.in[i] = bodyRoot[i - 128];
+            sszBeaconBlockHeaderIn[i] = stateRoot[i - 96];
         } else {
-            sszBeaconBlockHeader.in[i] = 0;
+            sszBeaconBlockHeaderIn[i] = bodyRoot[i - 128];
         }
     }
 
+    std::array<std::size_t, 32> sszBeaconBlockHeader = SSZArrayPadded<5, 3>(sszBeaconBlockHeaderIn);
+
     for (int i = 0; i < 32; i++) {
-        out[i] = sszBeaconBlockHeader.out[i];
+        out[i] = sszBeaconBlockHeader[i];
     }
 }
 
@@ -148,7 +148,7 @@
     }
 
     /* VERIFY THE POSEIDON ROOT OF THE SYNC COMMITTEE */
-    component computePoseidonRoot = PoseidonG1Array(SYNC_COMMITTEE_SIZE, N, K);
+    component computePoseidonRoot = PoseidonG1Commitment(SYNC_COMMITTEE_SIZE, N, K);
     for (int i = 0; i < SYNC_COMMITTEE_SIZE; i++) {
         for (std::size_t j = 0; j < K; j++) {
             computePoseidonRoot.pubkeys[i][0][j] = pubkeysBigIntX[i][j];
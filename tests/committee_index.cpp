@@ -0,0 +1,193 @@
+#define BOOST_TEST_MODULE ethereum_consensus_proof_committee_index_test
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/pubkeys.hpp>
+#include <ethereum/consensus_proof/native/committee_index.hpp>
+
+using namespace ethereum::consensus_proof::native;
+
+namespace {
+
+    // An index file in the temporary directory, removed with the fixture
+    struct index_file {
+        std::string path;
+
+        index_file() {
+            static std::size_t counter = 0;
+            path = (std::filesystem::temp_directory_path() /
+                    ("committee_index_test_" + std::to_string(::getpid()) + "_" + std::to_string(counter++)))
+                       .string();
+            std::filesystem::remove(path);
+        }
+
+        ~index_file() {
+            std::filesystem::remove(path);
+        }
+
+        std::size_t size() const {
+            return std::size_t(std::filesystem::file_size(path));
+        }
+    };
+
+    // A committee of eight keys, distinct for each seed
+    committee_index_entry example_entry(std::uint64_t seed) {
+        std::vector<g1_bytes_type> pubkeys;
+        for (std::uint64_t i = 0; i < 8; i++) {
+            pubkeys.push_back(g1_compress(scalar_mul(g1_generator(), 100 * seed + i + 1, fp::zero())));
+        }
+        return make_committee_index_entry(pubkeys, g1_compress(scalar_mul(g1_generator(), seed + 1, fp::zero())));
+    }
+
+    void check_entry(const std::optional<committee_index_entry> &found, const committee_index_entry &expected) {
+        BOOST_REQUIRE(found.has_value());
+        BOOST_TEST((found->ssz_root == expected.ssz_root));
+        BOOST_TEST((found->poseidon_root == expected.poseidon_root));
+        BOOST_TEST((found->pubkeys == expected.pubkeys));
+        BOOST_TEST((found->aggregate_tree.levels == expected.aggregate_tree.levels));
+    }
+
+    void flip_byte(const std::string &path, std::size_t offset) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(std::streamoff(offset));
+        char c = char(file.get());
+        file.seekp(std::streamoff(offset));
+        file.put(char(c ^ 1));
+    }
+
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(committee_index_test_suite)
+
+BOOST_AUTO_TEST_CASE(reopen) {
+    index_file file;
+    std::vector<committee_index_entry> entries = {example_entry(0), example_entry(1)};
+    {
+        committee_index index(file.path);
+        BOOST_TEST(index.size() == 0);
+        for (const committee_index_entry &entry : entries) {
+            index.append(entry);
+        }
+        // an SSZ root already indexed is not appended again
+        std::size_t size = file.size();
+        index.append(entries[0]);
+        BOOST_TEST(file.size() == size);
+        BOOST_TEST(index.size() == 2);
+    }
+
+    committee_index index(file.path);
+    BOOST_TEST(index.size() == 2);
+    for (const committee_index_entry &entry : entries) {
+        check_entry(index.find(entry.ssz_root), entry);
+        check_entry(index.find_by_poseidon(entry.poseidon_root), entry);
+        BOOST_TEST((index.find(entry.ssz_root)->aggregate_pubkey() == entry.aggregate_pubkey()));
+    }
+    BOOST_TEST(!index.find(entries[0].poseidon_root).has_value());
+}
+
+// A record torn by a crash is cut off on the next open, the records before it survive
+BOOST_AUTO_TEST_CASE(truncated_last_record) {
+    index_file file;
+    committee_index_entry first = example_entry(0), second = example_entry(1);
+    std::size_t valid_size;
+    {
+        committee_index index(file.path);
+        index.append(first);
+        valid_size = file.size();
+        index.append(second);
+    }
+
+    for (std::size_t cut : {std::size_t(1), committee_index::RECORD_HEADER_SIZE + 1, file.size() - valid_size - 1}) {
+        std::filesystem::resize_file(file.path, valid_size + cut);
+        {
+            committee_index index(file.path);
+            BOOST_TEST(index.size() == 1);
+            check_entry(index.find(first.ssz_root), first);
+            BOOST_TEST(!index.contains(second.ssz_root));
+        }
+        BOOST_TEST(file.size() == valid_size);
+    }
+
+    // the index appends after the records that survived
+    {
+        committee_index index(file.path);
+        index.append(second);
+    }
+    committee_index index(file.path);
+    BOOST_TEST(index.size() == 2);
+    check_entry(index.find(second.ssz_root), second);
+}
+
+// Each record is checked against the SHA-256 of its payload
+BOOST_AUTO_TEST_CASE(corrupted_last_record) {
+    index_file file;
+    committee_index_entry first = example_entry(0), second = example_entry(1);
+    std::size_t valid_size, full_size;
+    {
+        committee_index index(file.path);
+        index.append(first);
+        valid_size = file.size();
+        index.append(second);
+        full_size = file.size();
+    }
+
+    // the last pubkey of the payload (before the 15 nodes of the tree), then the stored digest
+    flip_byte(file.path, full_size - 16 * committee_index::POINT_SIZE);
+    {
+        committee_index index(file.path);
+        BOOST_TEST(index.size() == 1);
+        check_entry(index.find(first.ssz_root), first);
+        BOOST_TEST(!index.find_by_poseidon(second.poseidon_root).has_value());
+    }
+    BOOST_TEST(file.size() == valid_size);
+
+    {
+        committee_index index(file.path);
+        index.append(second);
+    }
+    flip_byte(file.path, valid_size + 16);
+    {
+        committee_index index(file.path);
+        BOOST_TEST(index.size() == 1);
+    }
+    BOOST_TEST(file.size() == valid_size);
+}
+
+BOOST_AUTO_TEST_CASE(exclusive_lock) {
+    index_file file;
+    {
+        committee_index index(file.path);
+        BOOST_CHECK_THROW(committee_index(file.path), std::system_error);
+        index.append(example_entry(0));
+    }
+    // released with the index
+    committee_index index(file.path);
+    BOOST_TEST(index.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(foreign_file) {
+    index_file file;
+    {
+        std::ofstream out(file.path, std::ios::binary);
+        out << std::string(committee_index::HEADER_SIZE, 'x');
+    }
+    BOOST_CHECK_THROW(committee_index(file.path), std::invalid_argument);
+    // the file is left as it was
+    BOOST_TEST(file.size() == committee_index::HEADER_SIZE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+#define BOOST_TEST_MODULE ethereum_consensus_proof_hash_to_g2_test
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fp2.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/register_tables.hpp>
+#include <ethereum/consensus_proof/native/hash_to_field.hpp>
+#include <ethereum/consensus_proof/native/hash_to_g2.hpp>
+
+#include "hex.hpp"
+
+using namespace ethereum::consensus_proof::native;
+using ethereum::consensus_proof::test::to_hex;
+
+namespace {
+
+    const std::uint8_t *bytes_of(std::string_view s) {
+        return reinterpret_cast<const std::uint8_t *>(s.data());
+    }
+
+    std::string expand(std::string_view msg, std::string_view dst, std::size_t len_in_bytes) {
+        return to_hex(expand_message_xmd(bytes_of(msg), msg.size(), bytes_of(dst), dst.size(), len_in_bytes));
+    }
+
+    // hash_to_curve of RFC 9380 with an arbitrary DST: hash_to_field(msg, 2) then MapToG2
+    g2_point hash_to_g2(std::string_view msg, std::string_view dst) {
+        std::vector<std::uint8_t> bytes = expand_message_xmd(bytes_of(msg), msg.size(), bytes_of(dst), dst.size(), 256);
+        std::array<fp2, 2> u;
+        for (std::size_t i = 0; i < 2; i++) {
+            u[i].c0 = fp_from_bytes_be_wide(bytes.data() + (2 * i) * 64);
+            u[i].c1 = fp_from_bytes_be_wide(bytes.data() + (2 * i + 1) * 64);
+        }
+        return map_to_g2(u);
+    }
+
+    fp2 fp2_from_hex(fp_hex c0, fp_hex c1) {
+        return {fp_from_limbs(limbs_from_hex(c0)), fp_from_limbs(limbs_from_hex(c1))};
+    }
+
+    constexpr std::string_view XMD_DST = "QUUX-V01-CS02-with-expander-SHA256-128";
+    constexpr std::string_view G2_DST = "QUUX-V01-CS02-with-BLS12381G2_XMD:SHA-256_SSWU_RO_";
+
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(expand_message_xmd_test_suite)
+
+// RFC 9380, K.1 expand_message_xmd(SHA-256)
+BOOST_AUTO_TEST_CASE(rfc9380_k1_len_0x20) {
+    BOOST_TEST(expand("", XMD_DST, 0x20) == "68a985b87eb6b46952128911f2a4412bbc302a9d759667f87f7a21d803f07235");
+    BOOST_TEST(expand("abc", XMD_DST, 0x20) == "d8ccab23b5985ccea865c6c97b6e5b8350e794e603b4b97902f53a8a0d605615");
+    BOOST_TEST(expand("abcdef0123456789", XMD_DST, 0x20) ==
+               "eff31487c770a893cfb36f912fbfcbff40d5661771ca4b2cb4eafe524333f5c1");
+    BOOST_TEST(expand("q128_" + std::string(128, 'q'), XMD_DST, 0x20) ==
+               "b23a1d2b4d97b2ef7785562a7e8bac7eed54ed6e97e29aa51bfe3f12ddad1ff9");
+}
+
+BOOST_AUTO_TEST_CASE(rfc9380_k1_len_0x80) {
+    BOOST_TEST(expand("", XMD_DST, 0x80) ==
+               "af84c27ccfd45d41914fdff5df25293e221afc53d8ad2ac06d5e3e29485dadbee0d121587713a3e0dd4d5e69e93eb7cd4f"
+               "5df4cd103e188cf60cb02edc3edf18eda8576c412b18ffb658e3dd6ec849469b979d444cf7b26911a08e63cf31f9dcc541"
+               "708d3491184472c2c29bb749d4286b004ceb5ee6b9a7fa5b646c993f0ced");
+}
+
+BOOST_AUTO_TEST_CASE(invalid_lengths) {
+    BOOST_CHECK_THROW(expand("", XMD_DST, 256 * 32), std::invalid_argument);
+    BOOST_CHECK_THROW(expand("", std::string(256, 'd'), 0x20), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(hash_to_g2_test_suite)
+
+// RFC 9380, J.10.1 BLS12381G2_XMD:SHA-256_SSWU_RO_, P = (x0 + x1 I, y0 + y1 I)
+BOOST_AUTO_TEST_CASE(rfc9380_j10_1) {
+    struct test_vector {
+        std::string_view msg;
+        // x0, x1, y0, y1
+        std::array<fp_hex, 4> p;
+    };
+    const std::array<test_vector, 3> vectors = {{
+        {"",
+         {"0x0141ebfbdca40eb85b87142e130ab689c673cf60f1a3e98d69335266f30d9b8d4ac44c1038e9dcdd5393faf5c41fb78a",
+          "0x05cb8437535e20ecffaef7752baddf98034139c38452458baeefab379ba13dff5bf5dd71b72418717047f5b0f37da03d",
+          "0x0503921d7f6a12805e72940b963c0cf3471c7b2a524950ca195d11062ee75ec076daf2d4bc358c4b190c0c98064fdd92",
+          "0x12424ac32561493f3fe3c260708a12b7c620e7be00099a974e259ddc7d1f6395c3c811cdd19f1e8dbf3e9ecfdcbab8d6"}},
+        {"abc",
+         {"0x02c2d18e033b960562aae3cab37a27ce00d80ccd5ba4b7fe0e7a210245129dbec7780ccc7954725f4168aff2787776e6",
+          "0x139cddbccdc5e91b9623efd38c49f81a6f83f175e80b06fc374de9eb4b41dfe4ca3a230ed250fbe3a2acf73a41177fd8",
+          "0x1787327b68159716a37440985269cf584bcb1e621d3a7202be6ea05c4cfe244aeb197642555a0645fb87bf7466b2ba48",
+          "0x00aa65dae3c8d732d10ecd2c50f8a1baf3001578f71c694e03866e9f3d49ac1e1ce70dd94a733534f106d4cec0eddd16"}},
+        {"abcdef0123456789",
+         {"0x121982811d2491fde9ba7ed31ef9ca474f0e1501297f68c298e9f4c0028add35aea8bb83d53c08cfc007c1e005723cd0",
+          "0x190d119345b94fbd15497bcba94ecf7db2cbfd1e1fe7da034d26cbba169fb3968288b3fafb265f9ebd380512a71c3f2c",
+          "0x05571a0f8d3c08d094576981f4a3b8eda0a8e771fcdcc8ecceaf1356a6acf17574518acb506e435b639353c2e14827c8",
+          "0x0bb5e7572275c567462d91807de765611490205a941a5a6af3b1691bfe596c31225d3aabdf15faff860cb4ef17c7c3be"}}
+    }};
+    for (const test_vector &v : vectors) {
+        g2_point p = hash_to_g2(v.msg, G2_DST);
+        BOOST_TEST(!p.infinity);
+        BOOST_TEST((p.x == fp2_from_hex(v.p[0], v.p[1])));
+        BOOST_TEST((p.y == fp2_from_hex(v.p[2], v.p[3])));
+    }
+}
+
+// The trace of MapToG2 ends at the returned point, which lies in G2
+BOOST_AUTO_TEST_CASE(trace_and_subgroup) {
+    std::array<std::uint8_t, 32> msg {};
+    msg[0] = 1;
+    map_to_g2_trace trace;
+    g2_point p = map_to_g2(hash_to_field(msg.data(), msg.size()), &trace);
+    BOOST_TEST((trace.out == p));
+    BOOST_TEST(g2_in_subgroup(p));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,24 @@
+#ifndef ETHEREUM_CONSENSUS_PROOF_TESTS_HEX_HPP
+#define ETHEREUM_CONSENSUS_PROOF_TESTS_HEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ethereum::consensus_proof::test {
+
+    // Lower-case hex digits of bytes in memory order, as the test vectors are written
+    template<typename Bytes>
+    std::string to_hex(const Bytes &bytes) {
+        static const char digits[] = "0123456789abcdef";
+        std::string out;
+        for (std::uint8_t byte : bytes) {
+            out.push_back(digits[byte >> 4]);
+            out.push_back(digits[byte & 15]);
+        }
+        return out;
+    }
+
+}    // namespace ethereum::consensus_proof::test
+
+#endif    // ETHEREUM_CONSENSUS_PROOF_TESTS_HEX_HPP
@@ -0,0 +1,91 @@
+#define BOOST_TEST_MODULE ethereum_consensus_proof_poseidon_test
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ethereum/consensus_proof/native/fr.hpp>
+#include <ethereum/consensus_proof/native/poseidon_constants.hpp>
+#include <ethereum/consensus_proof/native/poseidon.hpp>
+
+using namespace ethereum::consensus_proof::native;
+
+namespace {
+
+    // state[0] of the permutation of (0, 1, 2, .., 16), i.e. PoseidonEx(16, 1) with initialState 0
+    // over 1..16: circomlibjs' poseidon of [1..16]
+    constexpr fr POSEIDON_KNOWN_ANSWER =
+        fr_from_hex("0x16159a551cbb66108281a48099fff949ae08afd7f1f2ec06de2ffb96b919b765");
+
+    poseidon_state known_answer_input() {
+        poseidon_state state {};
+        for (std::size_t i = 1; i < POSEIDON_WIDTH; i++) {
+            state[i] = fr_from_u64(i);
+        }
+        return state;
+    }
+
+    poseidon_state random_state(std::mt19937_64 &rng) {
+        poseidon_state state;
+        for (fr &x : state) {
+            x = fr_from_u64(rng());
+            for (std::size_t i = 0; i < 3; i++) {
+                x = x * fr_from_u64(rng()) + fr_from_u64(rng());
+            }
+        }
+        return state;
+    }
+
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(poseidon_test_suite)
+
+BOOST_AUTO_TEST_CASE(known_answer) {
+    poseidon_state reference = known_answer_input();
+    poseidon_permute_reference(reference);
+    BOOST_TEST((reference[0] == POSEIDON_KNOWN_ANSWER));
+
+    poseidon_state optimized = known_answer_input();
+    poseidon_permute(optimized);
+    BOOST_TEST((optimized == reference));
+
+    std::array<fr, POSEIDON_WIDTH - 1> inputs;
+    for (std::size_t i = 0; i < inputs.size(); i++) {
+        inputs[i] = fr_from_u64(i + 1);
+    }
+    BOOST_TEST((poseidon_ex(fr::zero(), inputs.data())[0] == POSEIDON_KNOWN_ANSWER));
+}
+
+// The sparse partial rounds compute the same permutation as the plain round structure
+BOOST_AUTO_TEST_CASE(optimized_matches_reference) {
+    std::mt19937_64 rng(3);
+    poseidon_optimized_tables tables = poseidon_optimize();
+    for (std::size_t n = 0; n < 16; n++) {
+        poseidon_state reference = random_state(rng);
+        poseidon_state optimized = reference;
+        poseidon_state shared = reference;
+        poseidon_permute_reference(reference);
+        poseidon_permute(optimized, tables);
+        poseidon_permute(shared);
+        BOOST_TEST((optimized == reference));
+        BOOST_TEST((shared == reference));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sponge) {
+    std::vector<fr> in(32);
+    for (std::size_t i = 0; i < in.size(); i++) {
+        in[i] = fr_from_u64(i + 1);
+    }
+    poseidon_state first = poseidon_ex(fr::zero(), in.data());
+    BOOST_TEST((poseidon_sponge(in.data(), in.size()) == poseidon_ex(first[0], in.data() + 16)[1]));
+    BOOST_CHECK_THROW(poseidon_sponge(in.data(), 0), std::invalid_argument);
+    BOOST_CHECK_THROW(poseidon_sponge(in.data(), 17), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,115 @@
+#define BOOST_TEST_MODULE ethereum_consensus_proof_poseidon_tree_test
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ethereum/consensus_proof/constants.hpp>
+#include <ethereum/consensus_proof/native/fp.hpp>
+#include <ethereum/consensus_proof/native/fr.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/poseidon.hpp>
+#include <ethereum/consensus_proof/native/thread_pool.hpp>
+
+/*
+ * Built once per ETHEREUM_CONSENSUS_PROOF_POSEIDON_TREE value: poseidon_tree
+ * must give the root PoseidonG1Tree computes in either mode, and
+ * poseidon_g1_commitment must be the sponge or that root as the mode says.
+ */
+
+using namespace ethereum::consensus_proof::native;
+
+namespace {
+
+    using g1_registers = std::array<std::array<std::size_t, NUM_REGISTERS>, 2>;
+
+    // PoseidonG1Tree of poseidon.hpp step by step: one level array rehashed DEPTH times, each
+    // parent over POSEIDON_TREE_ARITY children, zero padded. Kept apart from poseidon_tree so the
+    // two are independent.
+    template<std::size_t DEPTH>
+    fr poseidon_g1_tree_circuit(const std::vector<g1_registers> &pubkeys) {
+        std::vector<fr> level(pubkeys.size());
+        for (std::size_t i = 0; i < pubkeys.size(); i++) {
+            std::array<fr, POSEIDON_TREE_ARITY> inputs {};
+            for (std::size_t j = 0; j < POSEIDON_TREE_ARITY; j++) {
+                inputs[j] = j < 2 * NUM_REGISTERS ? fr_from_u64(pubkeys[i][j % 2][j / 2]) : fr::zero();
+            }
+            level[i] = poseidon_ex(fr_from_u64(POSEIDON_TREE_LEAF_DOMAIN), inputs.data())[0];
+        }
+
+        std::size_t width = level.size();
+        for (std::size_t d = 0; d < DEPTH; d++) {
+            std::size_t parents = (width + POSEIDON_TREE_ARITY - 1) / POSEIDON_TREE_ARITY;
+            for (std::size_t p = 0; p < parents; p++) {
+                std::array<fr, POSEIDON_TREE_ARITY> inputs {};
+                for (std::size_t c = 0; c < POSEIDON_TREE_ARITY; c++) {
+                    std::size_t child = p * POSEIDON_TREE_ARITY + c;
+                    inputs[c] = child < width ? level[child] : fr::zero();
+                }
+                level[p] = poseidon_ex(fr_from_u64(POSEIDON_TREE_NODE_DOMAIN), inputs.data())[0];
+            }
+            width = parents;
+        }
+        if (width != 1) {
+            throw std::invalid_argument("poseidon_g1_tree_circuit: too many pubkeys for the depth");
+        }
+        return level[0];
+    }
+
+    std::vector<g1_point> example_pubkeys() {
+        std::vector<g1_point> out;
+        for (std::uint64_t i = 0; i < SYNC_COMMITTEE_SIZE; i++) {
+            out.push_back(scalar_mul(g1_generator(), 7 + 3 * i, fp::zero()));
+        }
+        return out;
+    }
+
+    fr circuit_root(const std::vector<g1_point> &pubkeys) {
+        std::vector<g1_registers> registers(pubkeys.size());
+        for (std::size_t i = 0; i < pubkeys.size(); i++) {
+            registers[i] = to_registers<NUM_BITS_PER_REGISTER, NUM_REGISTERS>(pubkeys[i]);
+        }
+        return poseidon_g1_tree_circuit<SYNC_COMMITTEE_POSEIDON_TREE_DEPTH>(registers);
+    }
+
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(poseidon_tree_test_suite)
+
+BOOST_AUTO_TEST_CASE(tree_matches_circuit) {
+    std::vector<g1_point> pubkeys = example_pubkeys();
+    fr expected = circuit_root(pubkeys);
+
+    poseidon_tree tree = poseidon_tree::from_pubkeys(pubkeys);
+    BOOST_TEST(tree.depth() == SYNC_COMMITTEE_POSEIDON_TREE_DEPTH);
+    BOOST_TEST((tree.root() == expected));
+
+    thread_pool pool(4);
+    BOOST_TEST((poseidon_tree::from_pubkeys(pubkeys, &pool).root() == expected));
+}
+
+BOOST_AUTO_TEST_CASE(branches_open_to_the_root) {
+    std::vector<g1_point> pubkeys = example_pubkeys();
+    poseidon_tree tree = poseidon_tree::from_pubkeys(pubkeys);
+    for (std::size_t i : {0, 15, 16, 255, 256, 511}) {
+        BOOST_TEST((tree.leaf(i) == poseidon_g1_leaf(pubkeys[i])));
+        BOOST_TEST((poseidon_tree_root(tree.leaf(i), i, tree.branch(i)) == tree.root()));
+    }
+    BOOST_CHECK_THROW(tree.branch(SYNC_COMMITTEE_SIZE), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(commitment_follows_the_mode) {
+    std::vector<g1_point> pubkeys = example_pubkeys();
+    fr expected = SYNC_COMMITTEE_POSEIDON_TREE ? circuit_root(pubkeys) : poseidon_g1_array(pubkeys);
+    BOOST_TEST((poseidon_g1_commitment(pubkeys) == expected));
+
+    bytes32 expected_bytes;
+    fr_to_bytes_le(expected, expected_bytes.data());
+    BOOST_TEST((sync_committee_poseidon(pubkeys) == expected_bytes));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
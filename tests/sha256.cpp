@@ -0,0 +1,129 @@
+#define BOOST_TEST_MODULE ethereum_consensus_proof_sha256_test
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/sha256_batch.hpp>
+
+#include "hex.hpp"
+
+using namespace ethereum::consensus_proof::native;
+using ethereum::consensus_proof::test::to_hex;
+
+namespace {
+
+    bytes32 hash(const std::vector<std::uint8_t> &data, sha256_backend backend) {
+        sha256_hasher hasher(backend);
+        hasher.update(data.data(), data.size());
+        return hasher.finalize();
+    }
+
+    std::vector<std::uint8_t> random_bytes(std::mt19937_64 &rng, std::size_t size) {
+        std::vector<std::uint8_t> out(size);
+        for (std::uint8_t &byte : out) {
+            byte = std::uint8_t(rng());
+        }
+        return out;
+    }
+
+    // The backends this CPU runs, the portable ones first
+    std::vector<sha256_backend> sha256_backends() {
+        std::vector<sha256_backend> out = {sha256_backend::portable};
+        if (sha256_detect() == sha256_backend::sha_ni) {
+            out.push_back(sha256_backend::sha_ni);
+        }
+        return out;
+    }
+
+    std::vector<sha256_batch_backend> sha256_batch_backends() {
+        std::vector<sha256_batch_backend> out = {sha256_batch_backend::scalar};
+        sha256_batch_backend widest = sha256_batch_detect();
+        if (widest != sha256_batch_backend::scalar) {
+            out.push_back(sha256_batch_backend::avx2);
+        }
+        if (widest == sha256_batch_backend::avx512) {
+            out.push_back(sha256_batch_backend::avx512);
+        }
+        return out;
+    }
+
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(sha256_test_suite)
+
+// FIPS 180-2 examples
+BOOST_AUTO_TEST_CASE(known_answers) {
+    std::string_view abc = "abc";
+    std::string_view two_blocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    for (sha256_backend backend : sha256_backends()) {
+        BOOST_TEST(to_hex(hash({}, backend)) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+        BOOST_TEST(to_hex(hash({abc.begin(), abc.end()}, backend)) ==
+                   "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+        BOOST_TEST(to_hex(hash({two_blocks.begin(), two_blocks.end()}, backend)) ==
+                   "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    }
+}
+
+// Every length around the block and padding boundaries, split into uneven updates
+BOOST_AUTO_TEST_CASE(backends_agree_on_messages) {
+    std::mt19937_64 rng(1);
+    for (std::size_t size = 0; size <= 200; size++) {
+        std::vector<std::uint8_t> data = random_bytes(rng, size);
+        bytes32 expected = hash(data, sha256_backend::portable);
+        for (sha256_backend backend : sha256_backends()) {
+            sha256_hasher hasher(backend);
+            std::size_t half = size / 3;
+            hasher.update(data.data(), half);
+            hasher.update(data.data() + half, size - half);
+            BOOST_TEST(to_hex(hasher.finalize()) == to_hex(expected));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(zero_block_midstate) {
+    std::vector<std::uint8_t> data(64 + 45, 0);
+    data[70] = 3;
+    for (sha256_backend backend : sha256_backends()) {
+        sha256_hasher hasher(SHA256_ZERO_BLOCK_MIDSTATE, 64, backend);
+        hasher.update(data.data() + 64, data.size() - 64);
+        BOOST_TEST(to_hex(hasher.finalize()) == to_hex(hash(data, sha256_backend::portable)));
+    }
+}
+
+// sha256(a || b), the SSZ node hash, on every single-stream and multi-buffer backend
+BOOST_AUTO_TEST_CASE(backends_agree_on_pairs) {
+    std::mt19937_64 rng(2);
+    for (std::size_t count : {0, 1, 7, 8, 9, 15, 16, 17, 33, 64}) {
+        std::vector<bytes32> in(2 * count);
+        for (bytes32 &node : in) {
+            std::vector<std::uint8_t> bytes = random_bytes(rng, 32);
+            std::copy(bytes.begin(), bytes.end(), node.begin());
+        }
+        std::vector<bytes32> expected(count);
+        for (std::size_t i = 0; i < count; i++) {
+            std::vector<std::uint8_t> block(in[2 * i].begin(), in[2 * i].end());
+            block.insert(block.end(), in[2 * i + 1].begin(), in[2 * i + 1].end());
+            expected[i] = hash(block, sha256_backend::portable);
+            for (sha256_backend backend : sha256_backends()) {
+                BOOST_TEST(to_hex(sha256(in[2 * i], in[2 * i + 1], backend)) == to_hex(expected[i]));
+            }
+        }
+        for (sha256_batch_backend backend : sha256_batch_backends()) {
+            std::vector<bytes32> out(count);
+            sha256_pairs(out.data(), in.data(), count, backend);
+            for (std::size_t i = 0; i < count; i++) {
+                BOOST_TEST(to_hex(out[i]) == to_hex(expected[i]));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,114 @@
+#define BOOST_TEST_MODULE ethereum_consensus_proof_ssz_test
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ethereum/consensus_proof/native/sha256.hpp>
+#include <ethereum/consensus_proof/native/ssz.hpp>
+#include <ethereum/consensus_proof/native/sync_committee_tree.hpp>
+
+#include "hex.hpp"
+
+using namespace ethereum::consensus_proof::native;
+using ethereum::consensus_proof::test::to_hex;
+
+namespace {
+
+    bytes32 uint64_chunk(std::uint64_t value) {
+        bytes32 out {};
+        for (std::size_t i = 0; i < 8; i++) {
+            out[i] = std::uint8_t(value >> (8 * i));
+        }
+        return out;
+    }
+
+    template<typename F>
+    bytes32 chunk(F &&byte) {
+        bytes32 out;
+        for (std::size_t i = 0; i < out.size(); i++) {
+            out[i] = std::uint8_t(byte(i));
+        }
+        return out;
+    }
+
+    beacon_block_header example_header() {
+        return {uint64_chunk(0x1234), uint64_chunk(77), chunk([](std::size_t i) { return i; }),
+                chunk([](std::size_t i) { return 2 * i + 1; }), chunk([](std::size_t i) { return 255 - i; })};
+    }
+
+    // 512 arbitrary 48-byte strings; SSZ hashes them without reading them as points
+    std::vector<g1_bytes_type> example_pubkeys() {
+        std::vector<g1_bytes_type> out(512);
+        for (std::size_t i = 0; i < out.size(); i++) {
+            for (std::size_t j = 0; j < 48; j++) {
+                out[i][j] = std::uint8_t(i * 31 + j * 7 + 1);
+            }
+        }
+        return out;
+    }
+
+    g1_bytes_type example_aggregate_pubkey() {
+        g1_bytes_type out;
+        for (std::size_t j = 0; j < 48; j++) {
+            out[j] = std::uint8_t(j * 13 + 5);
+        }
+        return out;
+    }
+
+}    // namespace
+
+// Expected roots were computed with a plain Python merkleization over hashlib
+BOOST_AUTO_TEST_SUITE(ssz_test_suite)
+
+BOOST_AUTO_TEST_CASE(zero_hashes) {
+    const auto &zero = ssz_zero_hashes();
+    BOOST_TEST(to_hex(zero[0]) == to_hex(bytes32 {}));
+    BOOST_TEST(to_hex(zero[1]) == "f5a5fd42d16a20302798ef6ed309979b43003d2320d9f0e8ea9831a92759fb4b");
+    BOOST_TEST(to_hex(zero[4]) == "536d98837f2dd165a55d5eeae91485954472d56f246df256bf3cae19352a123c");
+    for (std::size_t d = 1; d < zero.size(); d++) {
+        BOOST_TEST(to_hex(zero[d]) == to_hex(sha256(zero[d - 1], zero[d - 1])));
+    }
+}
+
+// Padding chunks come from the zero hash table, the root is that of the full tree
+BOOST_AUTO_TEST_CASE(padded_merkleization) {
+    for (std::size_t count = 1; count <= 9; count++) {
+        std::vector<bytes32> chunks(count);
+        for (std::size_t i = 0; i < count; i++) {
+            chunks[i] = uint64_chunk(i + 1);
+        }
+        std::vector<bytes32> full = chunks;
+        full.resize(16);
+        BOOST_TEST(to_hex(ssz_merkleize(chunks, 4)) == to_hex(ssz_merkleize(full)));
+    }
+    BOOST_TEST(to_hex(ssz_merkleize({}, 5)) == to_hex(ssz_zero_hashes()[5]));
+    BOOST_CHECK_THROW(ssz_merkleize(std::vector<bytes32>(3), 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(beacon_block_header_and_signing_root) {
+    bytes32 header_root = ssz_beacon_block_header_root(example_header());
+    BOOST_TEST(to_hex(header_root) == "ba0947fd5ad5334e0a8b6408a8dd33e03887324bf3152e7750388a7c6a9bfec0");
+    bytes32 domain = chunk([](std::size_t i) { return 7 * i; });
+    BOOST_TEST(to_hex(ssz_signing_root(header_root, domain)) ==
+               "19d3885ca25b30ea06a647e0bda7cd71e205159c113881e83d8c256c455e2c83");
+}
+
+BOOST_AUTO_TEST_CASE(sync_committee_root) {
+    std::vector<g1_bytes_type> pubkeys = example_pubkeys();
+    g1_bytes_type aggregate_pubkey = example_aggregate_pubkey();
+    BOOST_TEST(to_hex(ssz_sync_committee_root(pubkeys, aggregate_pubkey)) ==
+               "0ee4cb29ee4d0a7db80fdec4c715210bff6c5f0841ce0be356016e6e3549e4f8");
+
+    sync_committee_tree tree(pubkeys, aggregate_pubkey);
+    BOOST_TEST(to_hex(tree.root()) == "0ee4cb29ee4d0a7db80fdec4c715210bff6c5f0841ce0be356016e6e3549e4f8");
+    BOOST_TEST(to_hex(tree.pubkeys_root()) == "632215912873255b6897a542621f3b93970aca5cf3bc302f4d1db44e67c77f34");
+    for (std::size_t i : {0, 1, 300, 511}) {
+        BOOST_TEST(to_hex(tree.leaf(i)) == to_hex(ssz_g1_point_root(pubkeys[i])));
+        BOOST_TEST(to_hex(ssz_restore_merkle_root(tree.leaf(i), tree.branch(i), i)) == to_hex(tree.root()));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,130 @@
+#define BOOST_TEST_MODULE ethereum_consensus_proof_step_witness_test
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ethereum/consensus_proof/constants.hpp>
+#include <ethereum/consensus_proof/native/curve.hpp>
+#include <ethereum/consensus_proof/native/ssz.hpp>
+#include <ethereum/consensus_proof/native/hash_to_field.hpp>
+#include <ethereum/consensus_proof/native/hash_to_g2.hpp>
+#include <ethereum/consensus_proof/native/poseidon.hpp>
+#include <ethereum/consensus_proof/native/step_witness.hpp>
+
+#include "hex.hpp"
+
+using namespace ethereum::consensus_proof::native;
+using ethereum::consensus_proof::test::to_hex;
+
+namespace {
+
+    // A Step input signed by validators with secret keys 1000 + i^2, every third one not
+    // participating. Validator 1 repeats validator 0's key, as the circuit allows.
+    struct example_step {
+        step_input in;
+        std::uint64_t aggregate_secret_key = 0;
+
+        example_step() {
+            for (std::size_t i = 0; i < 32; i++) {
+                in.execution_state_root[i] = std::uint8_t(i);
+                in.domain[i] = std::uint8_t(7 * i);
+            }
+            in.finality_branch.resize(FINALIZED_HEADER_DEPTH);
+            in.execution_state_branch.resize(EXECUTION_STATE_ROOT_DEPTH);
+            for (bytes32 &node : in.finality_branch) {
+                node[0] = 1;
+            }
+            for (bytes32 &node : in.execution_state_branch) {
+                node[1] = 2;
+            }
+            in.finalized_header.slot[0] = 5;
+            in.finalized_header.body_root = ssz_restore_merkle_root(
+                in.execution_state_root, in.execution_state_branch, EXECUTION_STATE_ROOT_INDEX);
+            in.attested_header.slot[0] = 9;
+            in.attested_header.state_root = ssz_restore_merkle_root(
+                ssz_beacon_block_header_root(in.finalized_header), in.finality_branch, FINALIZED_HEADER_INDEX);
+
+            for (std::uint64_t i = 0; i < SYNC_COMMITTEE_SIZE; i++) {
+                std::uint64_t secret_key = i == 1 ? 1000 : 1000 + i * i;
+                bool bit = i < 2 || i % 3 != 0;
+                in.pubkeys.push_back(scalar_mul(g1_generator(), secret_key, fp::zero()));
+                in.aggregation_bits.push_back(bit);
+                aggregate_secret_key += bit ? secret_key : 0;
+            }
+            in.sync_committee_poseidon = sync_committee_poseidon(in.pubkeys);
+            sign();
+        }
+
+        void sign() {
+            bytes32 signing_root = ssz_signing_root(ssz_beacon_block_header_root(in.attested_header), in.domain);
+            g2_point hm = map_to_g2(hash_to_field(signing_root.data(), signing_root.size()));
+            in.signature = scalar_mul(hm, aggregate_secret_key, fp2::zero());
+        }
+    };
+
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(step_witness_test_suite)
+
+BOOST_AUTO_TEST_CASE(known_witness) {
+    example_step example;
+    step_witness witness = generate_step_witness(example.in);
+
+    BOOST_TEST(witness.participation == 342);
+    BOOST_TEST((witness.aggregate_pubkey == scalar_mul(g1_generator(), example.aggregate_secret_key, fp::zero())));
+    BOOST_TEST(witness.final_exp_out.is_one());
+    // syncCommitteePoseidon, and so the root, depends on the commitment layout
+    BOOST_TEST(to_hex(witness.public_inputs_root) ==
+               (SYNC_COMMITTEE_POSEIDON_TREE ? "f1484fc2091da1b9b348512bfefbbad5c78d6792fc8347d3711425964ddba407"
+                                             : "62355be0bbb75aaff1760457e0e7dd33b776489a2eb2e54c0915cba6b0bedc09"));
+
+    step_witness_registers<> registers(example.in, witness);
+    BOOST_TEST(registers.aggregation_out.size() == LOG2_SYNC_COMMITTEE_SIZE);
+    BOOST_TEST((registers.aggregation_out.back()[0] == registers.aggregate_pubkey));
+    BOOST_TEST(registers.aggregation_out_bits.back()[0] == 1);
+    BOOST_TEST((registers.hm_trace.out == registers.hm));
+    BOOST_TEST((registers.final_exp_hard_part[0] == registers.final_exp_easy_part));
+}
+
+// The generator agrees with the same items checked one by one out of circuit
+BOOST_AUTO_TEST_CASE(signature_check) {
+    example_step example;
+    step_witness witness = generate_step_witness(example.in);
+    BOOST_TEST(final_exponentiate(miller_loop_two({negate(example.in.signature), witness.hm},
+                                                  {g1_generator_line_point(),
+                                                   prepare_line_point(witness.aggregate_pubkey)}))
+                   .is_one());
+
+    example.in.aggregation_bits[5] = !example.in.aggregation_bits[5];
+    BOOST_CHECK_THROW(generate_step_witness(example.in), std::invalid_argument);
+
+    example.in.aggregation_bits[5] = !example.in.aggregation_bits[5];
+    example.in.attested_header.proposer_index[0] ^= 1;
+    BOOST_CHECK_THROW(generate_step_witness(example.in), std::invalid_argument);
+    example.sign();
+    BOOST_TEST(generate_step_witness(example.in).final_exp_out.is_one());
+}
+
+BOOST_AUTO_TEST_CASE(inconsistent_inputs) {
+    example_step example;
+    step_input in = example.in;
+    in.sync_committee_poseidon[0] ^= 1;
+    BOOST_CHECK_THROW(generate_step_witness(in), std::invalid_argument);
+
+    in = example.in;
+    in.finality_branch[0][0] ^= 1;
+    BOOST_CHECK_THROW(generate_step_witness(in), std::invalid_argument);
+
+    in = example.in;
+    in.execution_state_root[0] ^= 1;
+    BOOST_CHECK_THROW(generate_step_witness(in), std::invalid_argument);
+
+    in = example.in;
+    in.aggregation_bits.assign(SYNC_COMMITTEE_SIZE, false);
+    BOOST_CHECK_THROW(generate_step_witness(in), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()